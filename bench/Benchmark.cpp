@@ -0,0 +1,801 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../src/SList.hpp"
+#include "../src/AdaptiveMutex.hpp"
+#include "../src/CachingAllocator.hpp"
+#include "../src/FlatCombiningSList.hpp"
+#include "../src/HeapAllocator.hpp"
+#include "../src/IndexedSList.hpp"
+#include "../src/IntrusiveSList.hpp"
+#include "../src/LockFreeSList.hpp"
+#include "../src/Mutex.hpp"
+#include "../src/ParallelForEach.hpp"
+#include "../src/ShardedSList.hpp"
+#include "../src/SimdSearch.hpp"
+#include "../src/UnrolledList.hpp"
+
+/**
+ * @class CountingAllocator
+ * Allocator which counts the bytes of all blocks in use in order to measure the memory footprint of a list.
+ */
+template<typename Base>
+class CountingAllocator : public Base
+{
+private:
+	// Size of a block in bytes as requested by the list
+	size_t m_blockSize;
+
+public:
+	// Bytes of all blocks in use by any instance of the allocator
+	static size_t s_bytesInUse;
+
+	CountingAllocator(size_t blockSize, size_t alignment) : Base(blockSize, alignment), m_blockSize(blockSize) {}
+
+	void* allocate()
+	{
+		s_bytesInUse += m_blockSize;
+		return Base::allocate();
+	}
+
+	void deallocate(void* block)
+	{
+		s_bytesInUse -= m_blockSize;
+		Base::deallocate(block);
+	}
+};
+
+template<typename Base>
+size_t CountingAllocator<Base>::s_bytesInUse = 0;
+
+/**
+ * Returns the time elapsed since a given point in time in nanoseconds.
+ * @param	start	Point in time to measure from
+ * @return			Elapsed time in nanoseconds
+ */
+static double elapsed_ns(const std::chrono::steady_clock::time_point& start)
+{
+	return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+/**
+ * Prints a result line of a benchmark.
+ * @param	name		Name of the benchmark
+ * @param	threads		Count of threads used by the benchmark
+ * @param	nsPerOp		Average time per operation in nanoseconds
+ */
+static void print_result(const char* name, unsigned int threads, double nsPerOp)
+{
+	std::cout << std::left << std::setw(40) << name << std::right << std::setw(4) << threads << " threads "
+		<< std::setw(10) << std::fixed << std::setprecision(1) << nsPerOp << " ns/op" << std::endl;
+}
+
+/**
+ * Prints a result line of a traversal benchmark.
+ * @param	name				Name of the benchmark
+ * @param	elements			Count of elements in the list
+ * @param	nsPerElement		Average time per visited element in nanoseconds
+ * @param	bytesPerElement		Memory used by the nodes of the list per element in bytes
+ */
+static void print_traversal_result(const char* name, size_t elements, double nsPerElement, double bytesPerElement)
+{
+	std::cout << std::left << std::setw(40) << name << std::right << std::setw(9) << elements << " elements "
+		<< std::setw(8) << std::fixed << std::setprecision(2) << nsPerElement << " ns/element "
+		<< std::setw(6) << std::setprecision(1) << bytesPerElement << " bytes/element" << std::endl;
+}
+
+/**
+ * Prints a result line of a sort benchmark.
+ * @param	name				Name of the benchmark
+ * @param	elements			Count of sorted elements
+ * @param	nsPerElement		Average time per element in nanoseconds
+ * @param	extraBytesPerElement	Memory allocated by the sort per element in bytes
+ */
+static void print_sort_result(const char* name, size_t elements, double nsPerElement, double extraBytesPerElement)
+{
+	std::cout << std::left << std::setw(40) << name << std::right << std::setw(9) << elements << " elements "
+		<< std::setw(8) << std::fixed << std::setprecision(2) << nsPerElement << " ns/element "
+		<< std::setw(6) << std::setprecision(1) << extraBytesPerElement << " extra bytes/element" << std::endl;
+}
+
+/**
+ * Prints a result line of a benchmark comparing a list with and without index.
+ * @param	name				Name of the benchmark
+ * @param	elements			Count of elements in the list
+ * @param	nsPerOp				Average time per operation in nanoseconds
+ * @param	indexBytesPerElement	Memory used by the index per element in bytes
+ */
+static void print_index_result(const char* name, size_t elements, double nsPerOp, double indexBytesPerElement)
+{
+	std::cout << std::left << std::setw(40) << name << std::right << std::setw(9) << elements << " elements "
+		<< std::setw(10) << std::fixed << std::setprecision(1) << nsPerOp << " ns/op "
+		<< std::setw(6) << std::setprecision(1) << indexBytesPerElement << " index bytes/element" << std::endl;
+}
+
+/**
+ * Prints a result line of a benchmark writing or reading a file.
+ * @param	name				Name of the benchmark
+ * @param	elements			Count of elements in the list
+ * @param	nsPerElement		Average time per element in nanoseconds
+ * @param	fileBytesPerElement	Size of the file per element in bytes
+ */
+static void print_file_result(const char* name, size_t elements, double nsPerElement, double fileBytesPerElement)
+{
+	std::cout << std::left << std::setw(40) << name << std::right << std::setw(9) << elements << " elements "
+		<< std::setw(8) << std::fixed << std::setprecision(2) << nsPerElement << " ns/element "
+		<< std::setw(6) << std::setprecision(1) << fileBytesPerElement << " file bytes/element" << std::endl;
+}
+
+/**
+ * Measures the cost of locking and unlocking a mutex which is not locked by any other thread.
+ * @param	name	Name of the mutex type
+ */
+template<typename MutexType>
+static void BenchmarkUncontendedLock(const char* name)
+{
+	const unsigned int iterations = 10000000;
+	MutexType mutex;
+	auto start = std::chrono::steady_clock::now();
+	for (unsigned int i = 0; i < iterations; i++)
+	{
+		mutex.lock();
+		mutex.unlock();
+	}
+	print_result(name, 1, elapsed_ns(start) / iterations);
+}
+
+/**
+ * Measures the cost of locking and unlocking a mutex used by several threads for a tiny critical section.
+ * @param	name	Name of the mutex type
+ * @param	threads	Count of threads
+ */
+template<typename MutexType>
+static void BenchmarkContendedLock(const char* name, unsigned int threads)
+{
+	const unsigned int iterations = 1000000;
+	MutexType mutex;
+	volatile unsigned long counter = 0;
+	std::vector<std::thread> workers;
+	auto start = std::chrono::steady_clock::now();
+	for (unsigned int t = 0; t < threads; t++)
+	{
+		workers.push_back(std::thread([&]() -> void
+		{
+			for (unsigned int i = 0; i < iterations; i++)
+			{
+				mutex.lock();
+				counter = counter + 1;
+				mutex.unlock();
+			}
+		}));
+	}
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+	print_result(name, threads, elapsed_ns(start) / (static_cast<double>(iterations) * threads));
+}
+
+/**
+ * Measures push_back/pop_front pairs on an SList shared by several threads.
+ * @param	name	Name of the mutex type
+ * @param	threads	Count of threads
+ */
+template<typename MutexType>
+static void BenchmarkSListQueue(const char* name, unsigned int threads)
+{
+	const unsigned int iterations = 500000;
+	SList<int, PoolAllocator<>, MutexType> slist;
+	std::vector<std::thread> workers;
+	auto start = std::chrono::steady_clock::now();
+	for (unsigned int t = 0; t < threads; t++)
+	{
+		workers.push_back(std::thread([&]() -> void
+		{
+			for (unsigned int i = 0; i < iterations; i++)
+			{
+				slist.push_back(static_cast<int>(i));
+				slist.pop_front();
+			}
+		}));
+	}
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+	print_result(name, threads, elapsed_ns(start) / (2.0 * iterations * threads));
+}
+
+/**
+ * Measures an SList of strings used as a queue between producer and consumer threads, so nodes are allocated by other
+ * threads than the ones freeing them. Half of the threads are producers, the other half consumers.
+ * @param	name	Name of the allocator
+ * @param	threads	Count of threads, at least 2
+ */
+template<typename Allocator>
+static void BenchmarkProducerConsumer(const char* name, unsigned int threads)
+{
+	const unsigned int iterations = 200000;
+	const unsigned int producers = threads / 2;
+	SList<std::string, Allocator, AdaptiveMutex> slist;
+	std::atomic<unsigned int> consumed(0);
+	std::vector<std::thread> workers;
+	auto start = std::chrono::steady_clock::now();
+	for (unsigned int t = 0; t < producers; t++)
+	{
+		workers.push_back(std::thread([&]() -> void
+		{
+			for (unsigned int i = 0; i < iterations; i++)
+			{
+				slist.emplace_back("element which does not fit into the small string buffer");
+			}
+		}));
+		workers.push_back(std::thread([&]() -> void
+		{
+			std::string element;
+			while (consumed.load(std::memory_order_relaxed) < producers * iterations)
+			{
+				if (slist.try_pop_front(element))
+				{
+					consumed.fetch_add(1, std::memory_order_relaxed);
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+		}));
+	}
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+	print_result(name, threads, elapsed_ns(start) / (2.0 * iterations * producers));
+}
+
+/**
+ * Message of 64 bytes which can be queued by an IntrusiveSList.
+ */
+struct BenchmarkMessage
+{
+	IntrusiveListHook<BenchmarkMessage>	m_hook;
+	char								m_payload[64 - sizeof(IntrusiveListHook<BenchmarkMessage>)];
+
+	// SList needs operator== for remove and comparisons
+	bool operator==(const BenchmarkMessage& other) const { return 0 == std::memcmp(m_payload, other.m_payload, sizeof(m_payload)); }
+};
+
+/**
+ * Measures push_back/pop_front pairs of messages on an SList, which copies the messages into its nodes, and on an
+ * IntrusiveSList, which links the messages of a pool owned by every thread.
+ * @param	threads	Count of threads
+ */
+static void BenchmarkIntrusiveQueue(unsigned int threads)
+{
+	const unsigned int iterations = 500000;
+	SList<BenchmarkMessage> slist;
+	std::vector<std::thread> workers;
+	auto start = std::chrono::steady_clock::now();
+	for (unsigned int t = 0; t < threads; t++)
+	{
+		workers.push_back(std::thread([&]() -> void
+		{
+			BenchmarkMessage message = BenchmarkMessage();
+			for (unsigned int i = 0; i < iterations; i++)
+			{
+				slist.push_back(message);
+				slist.try_pop_front(message);
+			}
+		}));
+	}
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+	print_result("SList<Msg> push_back/pop_front", threads, elapsed_ns(start) / (2.0 * iterations * threads));
+
+	std::vector<BenchmarkMessage> pool(threads);
+	IntrusiveSList<BenchmarkMessage, &BenchmarkMessage::m_hook> intrusive;
+	workers.clear();
+	start = std::chrono::steady_clock::now();
+	for (unsigned int t = 0; t < threads; t++)
+	{
+		workers.push_back(std::thread([&, t]() -> void
+		{
+			BenchmarkMessage* message = &pool[t];
+			for (unsigned int i = 0; i < iterations; i++)
+			{
+				intrusive.push_back(*message);
+				message = intrusive.pop_front();
+			}
+		}));
+	}
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+	print_result("IntrusiveSList<Msg> push_back/pop_front", threads,
+		elapsed_ns(start) / (2.0 * iterations * threads));
+}
+
+/**
+ * Measures read-only iteration and remove(const T&) of a list of ints as well as the memory used by its nodes.
+ * @tparam	ListType		Type of the list
+ * @tparam	AllocatorType	CountingAllocator used by the list
+ * @param	name		Name of the list type
+ * @param	elements	Count of elements in the list
+ */
+template<typename ListType, typename AllocatorType>
+static void BenchmarkTraversal(const char* name, size_t elements)
+{
+	const size_t visits = 20000000;
+	const size_t rounds = elements < visits ? visits / elements : 1;
+	// BULK_RELEASE allocators don't count blocks released along with their slabs, so measure the difference
+	const size_t bytesBefore = AllocatorType::s_bytesInUse;
+	ListType list;
+	for (size_t i = 0; i < elements; i++)
+	{
+		list.push_back(static_cast<int>(i));
+	}
+	double bytesPerElement = static_cast<double>(AllocatorType::s_bytesInUse - bytesBefore) / elements;
+
+	const ListType& constList = list;
+	volatile long sink = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (size_t round = 0; round < rounds; round++)
+	{
+		long sum = 0;
+		constList.iterate([&sum](const int& element) -> ListIterationAction
+		{
+			sum += element;
+			return ListIterationAction::ACTION_CONTINUE;
+		});
+		sink = sink + sum;
+	}
+	std::string label = std::string(name) + " iterate";
+	print_traversal_result(label.c_str(), elements, elapsed_ns(start) / (static_cast<double>(rounds) * elements),
+		bytesPerElement);
+
+	// Nothing is removed, every call compares all elements
+	start = std::chrono::steady_clock::now();
+	for (size_t round = 0; round < rounds; round++)
+	{
+		list.remove(-1);
+	}
+	label = std::string(name) + " remove";
+	print_traversal_result(label.c_str(), elements, elapsed_ns(start) / (static_cast<double>(rounds) * elements),
+		bytesPerElement);
+}
+
+/**
+ * Measures scans for an element which is not in the list: remove and count of List, which compare one node at a time,
+ * and remove and count of UnrolledList with every instruction set of SimdSearch supported by the processor.
+ * @param	typeName	Name of T
+ * @param	elements	Count of elements in the lists
+ */
+template<typename T>
+static void BenchmarkSearch(const char* typeName, size_t elements)
+{
+	typedef CountingAllocator<PoolAllocator<>> CountingPool;
+	const size_t visits = 50000000;
+	const size_t rounds = elements < visits ? visits / elements : 1;
+	const char* instructionSetNames[] = { "scalar", "SSE2", "AVX2" };
+
+	size_t bytesBefore = CountingPool::s_bytesInUse;
+	List<T, CountingPool> list;
+	for (size_t i = 0; i < elements; i++)
+	{
+		list.push_back(static_cast<T>(i % 1000 + 1));
+	}
+	double listBytesPerElement = static_cast<double>(CountingPool::s_bytesInUse - bytesBefore) / elements;
+	bytesBefore = CountingPool::s_bytesInUse;
+	UnrolledList<T, 64, CountingPool> unrolled;
+	for (size_t i = 0; i < elements; i++)
+	{
+		unrolled.push_back(static_cast<T>(i % 1000 + 1));
+	}
+	double unrolledBytesPerElement = static_cast<double>(CountingPool::s_bytesInUse - bytesBefore) / elements;
+
+	// Nothing is removed, every call compares all elements
+	auto start = std::chrono::steady_clock::now();
+	for (size_t round = 0; round < rounds; round++)
+	{
+		list.remove(static_cast<T>(0));
+	}
+	std::string label = std::string("List<") + typeName + "> remove";
+	print_traversal_result(label.c_str(), elements, elapsed_ns(start) / (static_cast<double>(rounds) * elements),
+		listBytesPerElement);
+
+	volatile size_t sink = 0;
+	start = std::chrono::steady_clock::now();
+	for (size_t round = 0; round < rounds; round++)
+	{
+		sink = sink + list.count(static_cast<T>(0));
+	}
+	label = std::string("List<") + typeName + "> count";
+	print_traversal_result(label.c_str(), elements, elapsed_ns(start) / (static_cast<double>(rounds) * elements),
+		listBytesPerElement);
+
+	SimdSearch::InstructionSet supported = SimdSearch::supported_instruction_set();
+	for (int instructionSet = SimdSearch::INSTRUCTION_SET_SCALAR; instructionSet <= supported; instructionSet++)
+	{
+		SimdSearch::set_instruction_set(static_cast<SimdSearch::InstructionSet>(instructionSet));
+		start = std::chrono::steady_clock::now();
+		for (size_t round = 0; round < rounds; round++)
+		{
+			unrolled.remove(static_cast<T>(0));
+		}
+		label = std::string("UnrolledList<") + typeName + "> remove " + instructionSetNames[instructionSet];
+		print_traversal_result(label.c_str(), elements, elapsed_ns(start) / (static_cast<double>(rounds) * elements),
+			unrolledBytesPerElement);
+
+		start = std::chrono::steady_clock::now();
+		for (size_t round = 0; round < rounds; round++)
+		{
+			sink = sink + unrolled.count(static_cast<T>(0));
+		}
+		label = std::string("UnrolledList<") + typeName + "> count " + instructionSetNames[instructionSet];
+		print_traversal_result(label.c_str(), elements, elapsed_ns(start) / (static_cast<double>(rounds) * elements),
+			unrolledBytesPerElement);
+	}
+	SimdSearch::set_instruction_set(supported);
+}
+
+/**
+ * Measures rebuilding a list by push_back compared to saving it to a file and loading it back.
+ * @param	name		Name of the list type
+ * @param	elements	Count of elements in the list
+ * @param	make		Function returning the element with a given index
+ */
+template<typename ListType, typename Make>
+static void BenchmarkSerialization(const char* name, size_t elements, const Make& make)
+{
+	const char* path = "Benchmark.slst";
+	auto start = std::chrono::steady_clock::now();
+	ListType list;
+	for (size_t i = 0; i < elements; i++)
+	{
+		list.push_back(make(i));
+	}
+	std::string label = std::string(name) + " push_back";
+	print_file_result(label.c_str(), elements, elapsed_ns(start) / elements, 0.0);
+
+	start = std::chrono::steady_clock::now();
+	list.save(path);
+	double saveNs = elapsed_ns(start);
+	std::FILE* file = std::fopen(path, "rb");
+	std::fseek(file, 0, SEEK_END);
+	double fileBytesPerElement = static_cast<double>(std::ftell(file)) / elements;
+	std::fclose(file);
+	label = std::string(name) + " save";
+	print_file_result(label.c_str(), elements, saveNs / elements, fileBytesPerElement);
+
+	start = std::chrono::steady_clock::now();
+	ListType loaded;
+	loaded.load(path);
+	label = std::string(name) + " load";
+	print_file_result(label.c_str(), elements, elapsed_ns(start) / elements, fileBytesPerElement);
+	std::remove(path);
+}
+
+/**
+ * Measures push_back/try_pop_front pairs on a FlatCombiningSList shared by several threads, the counterpart of
+ * BenchmarkSListQueue. The list has a slot for every thread.
+ * @param	name	Name of the mutex type
+ * @param	threads	Count of threads
+ */
+template<typename MutexType>
+static void BenchmarkFlatCombiningQueue(const char* name, unsigned int threads)
+{
+	const unsigned int iterations = 500000;
+	FlatCombiningSList<int, PoolAllocator<>, MutexType> slist(threads);
+	std::vector<std::thread> workers;
+	auto start = std::chrono::steady_clock::now();
+	for (unsigned int t = 0; t < threads; t++)
+	{
+		workers.push_back(std::thread([&]() -> void
+		{
+			int element;
+			for (unsigned int i = 0; i < iterations; i++)
+			{
+				slist.push_back(static_cast<int>(i));
+				slist.try_pop_front(element);
+			}
+		}));
+	}
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+	print_result(name, threads, elapsed_ns(start) / (2.0 * iterations * threads));
+}
+
+/**
+ * Measures push/try_pop pairs on a ShardedSList shared by several threads, the counterpart of BenchmarkSListQueue.
+ * @param	name	Name of the mutex type
+ * @param	threads	Count of threads
+ */
+template<typename MutexType>
+static void BenchmarkShardedSListQueue(const char* name, unsigned int threads)
+{
+	const unsigned int iterations = 500000;
+	ShardedSList<int, PoolAllocator<>, MutexType> slist;
+	std::vector<std::thread> workers;
+	auto start = std::chrono::steady_clock::now();
+	for (unsigned int t = 0; t < threads; t++)
+	{
+		workers.push_back(std::thread([&]() -> void
+		{
+			int element;
+			for (unsigned int i = 0; i < iterations; i++)
+			{
+				slist.push(static_cast<int>(i));
+				slist.try_pop(element);
+			}
+		}));
+	}
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+	print_result(name, threads, elapsed_ns(start) / (2.0 * iterations * threads));
+}
+
+/**
+ * Measures push_back/try_pop_front pairs on a LockFreeSList shared by several threads and on an SList for comparison.
+ * Running it with one thread and with more threads shows how the throughput scales with the count of threads.
+ * @param	threads	Count of threads
+ */
+static void BenchmarkLockFreeQueue(unsigned int threads)
+{
+	const unsigned int iterations = 500000;
+	BenchmarkSListQueue<Mutex>("SList<int, Mutex> push_back/pop_front", threads);
+
+	LockFreeSList<int> lockFree;
+	std::vector<std::thread> workers;
+	auto start = std::chrono::steady_clock::now();
+	for (unsigned int t = 0; t < threads; t++)
+	{
+		workers.push_back(std::thread([&]() -> void
+		{
+			int element;
+			for (unsigned int i = 0; i < iterations; i++)
+			{
+				lockFree.push_back(static_cast<int>(i));
+				lockFree.try_pop_front(element);
+			}
+		}));
+	}
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+	print_result("LockFreeSList<int> push_back/pop_front", threads, elapsed_ns(start) / (2.0 * iterations * threads));
+}
+
+/**
+ * Measures parallel_for_each with a callback doing some arithmetic for every element of a list.
+ * @param	threads	Count of threads
+ */
+static void BenchmarkParallelForEach(unsigned int threads)
+{
+	const size_t elements = 2000000;
+	List<double> list;
+	for (size_t i = 0; i < elements; i++)
+	{
+		list.push_back(static_cast<double>(i));
+	}
+	auto start = std::chrono::steady_clock::now();
+	parallel_for_each(list, [](double& element) -> void
+	{
+		for (int i = 0; i < 50; i++)
+		{
+			element = element * 0.999 + 1.0;
+		}
+	}, threads);
+	print_result("List<double> parallel_for_each", threads, elapsed_ns(start) / elements);
+}
+
+/**
+ * Measures cancelling a queued element and queueing it again in a list of a given size, once by scanning an SList and
+ * once by the index of an IndexedSList. The memory used by the index is printed per element.
+ * @param	elements	Count of elements in the list
+ */
+static void BenchmarkCancellation(size_t elements)
+{
+	const size_t iterations = elements < 100000 ? 1000000 / elements * 100 : 1000;
+	SList<int> slist;
+	IndexedSList<int> ilist;
+	for (size_t i = 0; i < elements; i++)
+	{
+		slist.push_back(static_cast<int>(i));
+		ilist.push_back(static_cast<int>(i));
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < iterations; i++)
+	{
+		int element = static_cast<int>(i * 7919 % elements);
+		slist.remove(element);
+		slist.push_back(element);
+	}
+	print_index_result("SList<int> remove/push_back", elements, elapsed_ns(start) / iterations, 0.0);
+
+	start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < iterations; i++)
+	{
+		int element = static_cast<int>(i * 7919 % elements);
+		ilist.remove(element);
+		ilist.push_back(element);
+	}
+	print_index_result("IndexedSList<int> remove/push_back", elements, elapsed_ns(start) / iterations,
+		static_cast<double>(ilist.index_memory()) / elements);
+}
+
+/**
+ * Measures sorting pseudo-random numbers by List<int>::sort, SList<int>::sort, std::list<int>::sort and by copying a
+ * List<int> into a std::vector, sorting it and rebuilding the list. Only the latter allocates memory while sorting.
+ * @param	elements	Count of elements to sort
+ */
+static void BenchmarkSort(size_t elements)
+{
+	std::vector<int> numbers;
+	unsigned int seed = 12345;
+	for (size_t i = 0; i < elements; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		numbers.push_back(static_cast<int>(seed >> 1));
+	}
+
+	List<int> list;
+	list.push_back(numbers.begin(), numbers.end());
+	auto start = std::chrono::steady_clock::now();
+	list.sort();
+	print_sort_result("List<int> sort", elements, elapsed_ns(start) / elements, 0.0);
+
+	SList<int> slist;
+	slist.push_back(numbers.begin(), numbers.end());
+	start = std::chrono::steady_clock::now();
+	slist.sort();
+	print_sort_result("SList<int> sort", elements, elapsed_ns(start) / elements, 0.0);
+
+	std::list<int> stdList(numbers.begin(), numbers.end());
+	start = std::chrono::steady_clock::now();
+	stdList.sort();
+	print_sort_result("std::list<int> sort", elements, elapsed_ns(start) / elements, 0.0);
+
+	List<int> copied;
+	copied.push_back(numbers.begin(), numbers.end());
+	start = std::chrono::steady_clock::now();
+	std::vector<int> vector(copied.begin(), copied.end());
+	std::sort(vector.begin(), vector.end());
+	copied.clear();
+	copied.push_back(vector.begin(), vector.end());
+	print_sort_result("List<int> via std::vector sort", elements, elapsed_ns(start) / elements, sizeof(int));
+}
+
+/**
+ * Main function of the program. Runs all benchmarks.
+ */
+int main(int /*argc*/, char* /*argv*/[])
+{
+	unsigned int cores = std::thread::hardware_concurrency();
+	if (0 == cores)
+	{
+		cores = 1;
+	}
+	std::vector<unsigned int> threadCounts;
+	for (unsigned int threads = 2; threads < 2 * cores; threads *= 2)
+	{
+		threadCounts.push_back(threads);
+	}
+	threadCounts.push_back(2 * cores);
+
+	BenchmarkUncontendedLock<Mutex>("Mutex uncontended lock/unlock");
+	BenchmarkUncontendedLock<AdaptiveMutex>("AdaptiveMutex uncontended lock/unlock");
+
+	for (unsigned int threads : threadCounts)
+	{
+		BenchmarkContendedLock<Mutex>("Mutex contended lock/unlock", threads);
+		BenchmarkContendedLock<AdaptiveMutex>("AdaptiveMutex contended lock/unlock", threads);
+	}
+
+	for (unsigned int threads : threadCounts)
+	{
+		BenchmarkSListQueue<Mutex>("SList<int, Mutex> push_back/pop_front", threads);
+		BenchmarkSListQueue<AdaptiveMutex>("SList<int, AdaptiveMutex> push_back/pop_front", threads);
+		BenchmarkShardedSListQueue<Mutex>("ShardedSList<int, Mutex> push/try_pop", threads);
+		BenchmarkShardedSListQueue<AdaptiveMutex>("ShardedSList<int, AdaptiveMutex> push/try_pop", threads);
+		BenchmarkFlatCombiningQueue<Mutex>("FlatCombiningSList<int, Mutex> push/pop", threads);
+		BenchmarkFlatCombiningQueue<AdaptiveMutex>("FlatCombiningSList<int, AdaptiveMutex> push/pop", threads);
+	}
+
+	// Flat combining pays off for heavy contention, so compare the queues with 16 and more threads on every machine
+	for (unsigned int threads = 16; threads <= 32; threads *= 2)
+	{
+		if (threads <= 2 * cores)
+		{
+			continue;
+		}
+		BenchmarkSListQueue<Mutex>("SList<int, Mutex> push_back/pop_front", threads);
+		BenchmarkSListQueue<AdaptiveMutex>("SList<int, AdaptiveMutex> push_back/pop_front", threads);
+		BenchmarkFlatCombiningQueue<Mutex>("FlatCombiningSList<int, Mutex> push/pop", threads);
+		BenchmarkFlatCombiningQueue<AdaptiveMutex>("FlatCombiningSList<int, AdaptiveMutex> push/pop", threads);
+	}
+
+	for (unsigned int threads : threadCounts)
+	{
+		BenchmarkProducerConsumer<PoolAllocator<>>("SList<string, PoolAllocator> queue", threads);
+		BenchmarkProducerConsumer<HeapAllocator>("SList<string, HeapAllocator> queue", threads);
+		CachingAllocator::reset_statistics();
+		BenchmarkProducerConsumer<CachingAllocator>("SList<string, CachingAllocator> queue", threads);
+		CacheStatistics statistics = CachingAllocator::statistics();
+		std::cout << "  CachingAllocator hit rate " << std::setprecision(1)
+			<< 100.0 * statistics.m_cacheHits / std::max<uint64_t>(statistics.m_allocations, 1) << " %, "
+			<< statistics.m_heapAllocations << " heap allocations, " << statistics.m_depotTransfers
+			<< " depot transfers" << std::endl;
+	}
+
+	BenchmarkIntrusiveQueue(1);
+	for (unsigned int threads : threadCounts)
+	{
+		BenchmarkIntrusiveQueue(threads);
+	}
+
+	BenchmarkLockFreeQueue(1);
+	for (unsigned int threads : threadCounts)
+	{
+		BenchmarkLockFreeQueue(threads);
+	}
+
+	BenchmarkParallelForEach(1);
+	for (unsigned int threads : threadCounts)
+	{
+		BenchmarkParallelForEach(threads);
+	}
+
+	typedef CountingAllocator<PoolAllocator<>> CountingPool;
+	for (size_t elements = 1000; elements <= 10000000; elements *= 10)
+	{
+		BenchmarkTraversal<List<int, CountingPool>, CountingPool>("List<int>", elements);
+		BenchmarkTraversal<UnrolledList<int, 16, CountingPool>, CountingPool>("UnrolledList<int, 16>", elements);
+		BenchmarkTraversal<UnrolledList<int, 64, CountingPool>, CountingPool>("UnrolledList<int, 64>", elements);
+	}
+
+	for (size_t elements = 1000; elements <= 1000000; elements *= 1000)
+	{
+		BenchmarkSearch<int>("int", elements);
+		BenchmarkSearch<float>("float", elements);
+		BenchmarkSearch<uint64_t>("uint64_t", elements);
+	}
+
+	for (size_t elements = 1000000; elements <= 4000000; elements *= 4)
+	{
+		BenchmarkSerialization<List<int>>("List<int>", elements, [](size_t i) { return static_cast<int>(i); });
+		BenchmarkSerialization<SList<int>>("SList<int>", elements, [](size_t i) { return static_cast<int>(i); });
+		BenchmarkSerialization<SList<std::string>>("SList<string>", elements, [](size_t i)
+		{
+			return std::to_string(i);
+		});
+	}
+
+	for (size_t elements = 100; elements <= 100000; elements *= 10)
+	{
+		BenchmarkCancellation(elements);
+	}
+
+	for (size_t elements = 1000000; elements <= 4000000; elements *= 2)
+	{
+		BenchmarkSort(elements);
+	}
+
+	return 0;
+}
@@ -0,0 +1,458 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../src/List.hpp"
+#include "../src/SList.hpp"
+#include "../src/AdaptiveMutex.hpp"
+#include "../src/Mutex.hpp"
+#include "../src/RWMutex.hpp"
+
+/**
+ * Element of 64 bytes, the counterpart of int for elements which are expensive to copy.
+ */
+struct Payload
+{
+	int		m_value;
+	char	m_padding[64 - sizeof(int)];
+
+	Payload(int value = 0) : m_value(value) { std::memset(m_padding, 0, sizeof(m_padding)); }
+	bool operator==(const Payload& other) const { return m_value == other.m_value; }
+};
+
+/**
+ * Returns the value of an element, so the benchmarks can sum up elements of any type.
+ * @param	element	Element to return the value of
+ * @return			The value of the element
+ */
+static long value_of(int element)
+{
+	return element;
+}
+
+/**
+ * Returns the value of an element, so the benchmarks can sum up elements of any type.
+ * @param	element	Element to return the value of
+ * @return			The value of the element
+ */
+static long value_of(const Payload& element)
+{
+	return element.m_value;
+}
+
+/**
+ * Returns the name of an element type for the results.
+ */
+template<typename T> const char* element_name();
+template<> const char* element_name<int>() { return "int"; }
+template<> const char* element_name<Payload>() { return "payload64"; }
+
+/**
+ * @class ListAdapter
+ * Adapter for List, it is only benchmarked with a single thread since List is not thread-safe.
+ */
+template<typename T>
+class ListAdapter
+{
+private:
+	List<T> m_list;
+
+public:
+	static const bool THREAD_SAFE = false;
+	static const char* name() { return "List"; }
+
+	void push_back(const T& element) { m_list.push_back(element); }
+	bool pop_front(T& element) { return m_list.try_pop_front(element); }
+	void remove(const T& element) { m_list.remove(element); }
+
+	long sum() const
+	{
+		long sum = 0;
+		m_list.iterate([&sum](const T& element) -> ListIterationAction
+		{
+			sum += value_of(element);
+			return ListIterationAction::ACTION_CONTINUE;
+		});
+		return sum;
+	}
+};
+
+/**
+ * @class SListAdapter
+ * Adapter for SList, read-only iteration locks the list in shared mode.
+ */
+template<typename T, typename MutexType>
+class SListAdapter
+{
+private:
+	SList<T, PoolAllocator<>, MutexType> m_list;
+
+public:
+	static const bool THREAD_SAFE = true;
+	static const char* name();
+
+	void push_back(const T& element) { m_list.push_back(element); }
+	bool pop_front(T& element) { return m_list.try_pop_front(element); }
+	void remove(const T& element) { m_list.remove(element); }
+
+	long sum() const
+	{
+		long sum = 0;
+		m_list.iterate([&sum](const T& element) -> ListIterationAction
+		{
+			sum += value_of(element);
+			return ListIterationAction::ACTION_CONTINUE;
+		});
+		return sum;
+	}
+};
+template<> const char* SListAdapter<int, Mutex>::name() { return "SList<Mutex>"; }
+template<> const char* SListAdapter<Payload, Mutex>::name() { return "SList<Mutex>"; }
+template<> const char* SListAdapter<int, RWMutex>::name() { return "SList<RWMutex>"; }
+template<> const char* SListAdapter<Payload, RWMutex>::name() { return "SList<RWMutex>"; }
+template<> const char* SListAdapter<int, AdaptiveMutex>::name() { return "SList<AdaptiveMutex>"; }
+template<> const char* SListAdapter<Payload, AdaptiveMutex>::name() { return "SList<AdaptiveMutex>"; }
+
+/**
+ * @class StdAdapter
+ * Adapter for a container of the STL guarded by a std::mutex.
+ */
+template<typename T, typename Container>
+class StdAdapter
+{
+private:
+	mutable std::mutex	m_mutex;
+	Container			m_container;
+
+public:
+	static const bool THREAD_SAFE = true;
+	static const char* name();
+
+	void push_back(const T& element)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_container.push_back(element);
+	}
+
+	bool pop_front(T& element)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_container.empty())
+		{
+			return false;
+		}
+		element = std::move(m_container.front());
+		m_container.pop_front();
+		return true;
+	}
+
+	void remove(const T& element)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_container.erase(std::remove(m_container.begin(), m_container.end(), element), m_container.end());
+	}
+
+	long sum() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		long sum = 0;
+		for (const T& element : m_container)
+		{
+			sum += value_of(element);
+		}
+		return sum;
+	}
+};
+template<> const char* StdAdapter<int, std::list<int>>::name() { return "std::list+std::mutex"; }
+template<> const char* StdAdapter<Payload, std::list<Payload>>::name() { return "std::list+std::mutex"; }
+template<> const char* StdAdapter<int, std::deque<int>>::name() { return "std::deque+std::mutex"; }
+template<> const char* StdAdapter<Payload, std::deque<Payload>>::name() { return "std::deque+std::mutex"; }
+
+/**
+ * Mix of operations run by every thread of a benchmark, the percentages add up to 100.
+ */
+struct Workload
+{
+	const char*		m_name;
+	unsigned int	m_push;
+	unsigned int	m_pop;
+	unsigned int	m_iterate;
+	unsigned int	m_remove;
+};
+
+/**
+ * Result of a single benchmark.
+ */
+struct Result
+{
+	std::string		m_container;
+	std::string		m_element;
+	std::string		m_workload;
+	size_t			m_size;
+	unsigned int	m_threads;
+	uint64_t		m_ops;
+	double			m_seconds;
+	double			m_p50;
+	double			m_p90;
+	double			m_p99;
+	double			m_max;
+};
+
+/**
+ * Returns a percentile of sorted latencies.
+ * @param	latencies	Latencies in ascending order
+ * @param	percentile	Percentile between 0 and 100
+ * @return				The latency of the percentile in nanoseconds
+ */
+static double percentile_of(const std::vector<uint32_t>& latencies, double percentile)
+{
+	if (latencies.empty())
+	{
+		return 0.0;
+	}
+	size_t index = static_cast<size_t>(percentile / 100.0 * (latencies.size() - 1) + 0.5);
+	return latencies[index];
+}
+
+/**
+ * Runs a workload on a list prefilled with a given count of elements with several threads for a given time. Every
+ * thread measures the latency of every operation.
+ * @tparam	Adapter		Adapter of the list to benchmark
+ * @tparam	T			Type of the elements
+ * @param	workload	Mix of operations
+ * @param	size		Count of elements added before the benchmark starts
+ * @param	threads		Count of threads
+ * @param	durationMs	Duration of the benchmark in milliseconds
+ * @return				Result of the benchmark
+ */
+template<typename Adapter, typename T>
+static Result run(const Workload& workload, size_t size, unsigned int threads, unsigned int durationMs)
+{
+	Adapter list;
+	for (size_t i = 0; i < size; i++)
+	{
+		list.push_back(T(static_cast<int>(i)));
+	}
+
+	std::atomic<unsigned int> ready(0);
+	std::atomic<bool> go(false);
+	std::atomic<bool> stop(false);
+	std::vector<std::vector<uint32_t>> latencies(threads);
+	std::vector<std::thread> workers;
+	volatile long sink = 0;
+	for (unsigned int t = 0; t < threads; t++)
+	{
+		workers.push_back(std::thread([&, t]() -> void
+		{
+			std::vector<uint32_t>& samples = latencies[t];
+			samples.reserve(1 << 20);
+			uint32_t random = 2463534242u + t * 7919u;
+			T element;
+			ready++;
+			while (!go.load(std::memory_order_acquire))
+			{
+				std::this_thread::yield();
+			}
+
+			while (!stop.load(std::memory_order_relaxed))
+			{
+				// xorshift32
+				random ^= random << 13;
+				random ^= random >> 17;
+				random ^= random << 5;
+				unsigned int choice = random % 100;
+				auto start = std::chrono::steady_clock::now();
+				if (choice < workload.m_push)
+				{
+					list.push_back(T(static_cast<int>(random % (2 * size + 1))));
+				}
+				else if (choice < workload.m_push + workload.m_pop)
+				{
+					list.pop_front(element);
+				}
+				else if (choice < workload.m_push + workload.m_pop + workload.m_iterate)
+				{
+					sink = sink + list.sum();
+				}
+				else
+				{
+					list.remove(T(static_cast<int>(random % (2 * size + 1))));
+				}
+				auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+				samples.push_back(static_cast<uint32_t>(std::min<long long>(ns, UINT32_MAX)));
+			}
+		}));
+	}
+
+	while (ready.load() < threads)
+	{
+		std::this_thread::yield();
+	}
+	auto start = std::chrono::steady_clock::now();
+	go.store(true, std::memory_order_release);
+	std::this_thread::sleep_for(std::chrono::milliseconds(durationMs));
+	stop.store(true);
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	std::vector<uint32_t> all;
+	for (const auto& samples : latencies)
+	{
+		all.insert(all.end(), samples.begin(), samples.end());
+	}
+	std::sort(all.begin(), all.end());
+
+	Result result;
+	result.m_container = Adapter::name();
+	result.m_element = element_name<T>();
+	result.m_workload = workload.m_name;
+	result.m_size = size;
+	result.m_threads = threads;
+	result.m_ops = all.size();
+	result.m_seconds = seconds;
+	result.m_p50 = percentile_of(all, 50.0);
+	result.m_p90 = percentile_of(all, 90.0);
+	result.m_p99 = percentile_of(all, 99.0);
+	result.m_max = all.empty() ? 0.0 : all.back();
+	return result;
+}
+
+/**
+ * Runs all workloads, list sizes and thread counts for a list and an element type.
+ * @tparam	Adapter		Adapter of the list to benchmark
+ * @tparam	T			Type of the elements
+ * @param	threadCounts	Thread counts to benchmark, only the first one is used if Adapter is not thread-safe
+ * @param	durationMs		Duration of every benchmark in milliseconds
+ * @param	results			Receives the results
+ */
+template<typename Adapter, typename T>
+static void run_all(const std::vector<unsigned int>& threadCounts, unsigned int durationMs, std::vector<Result>& results)
+{
+	static const Workload workloads[] =
+	{
+		{ "queue",			50, 50,  0,  0 },
+		{ "read-mostly",	 5,  5, 90,  0 },
+		{ "mixed",			30, 30, 20, 20 },
+	};
+	static const size_t sizes[] = { 16, 1024, 65536 };
+
+	for (const Workload& workload : workloads)
+	{
+		for (size_t size : sizes)
+		{
+			for (unsigned int threads : threadCounts)
+			{
+				if (!Adapter::THREAD_SAFE && 1 != threads)
+				{
+					continue;
+				}
+				results.push_back(run<Adapter, T>(workload, size, threads, durationMs));
+				const Result& result = results.back();
+				std::cerr << result.m_container << " " << result.m_element << " " << result.m_workload << " size "
+					<< result.m_size << " threads " << result.m_threads << ": "
+					<< static_cast<uint64_t>(result.m_ops / result.m_seconds) << " ops/s, p99 " << result.m_p99
+					<< " ns" << std::endl;
+			}
+		}
+	}
+}
+
+/**
+ * Writes the results as JSON.
+ * @param	out			Stream to write to
+ * @param	results		Results of all benchmarks
+ * @param	cores		Count of cores of the machine
+ * @param	durationMs	Duration of every benchmark in milliseconds
+ */
+static void write_json(std::ostream& out, const std::vector<Result>& results, unsigned int cores, unsigned int durationMs)
+{
+	out << "{\n  \"cores\": " << cores << ",\n  \"duration_ms\": " << durationMs << ",\n  \"results\": [\n";
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		const Result& result = results[i];
+		out << "    {\"container\": \"" << result.m_container << "\", \"element\": \"" << result.m_element
+			<< "\", \"workload\": \"" << result.m_workload << "\", \"size\": " << result.m_size
+			<< ", \"threads\": " << result.m_threads << ", \"ops\": " << result.m_ops
+			<< ", \"ops_per_sec\": " << static_cast<uint64_t>(result.m_ops / result.m_seconds)
+			<< ", \"latency_ns\": {\"p50\": " << result.m_p50 << ", \"p90\": " << result.m_p90
+			<< ", \"p99\": " << result.m_p99 << ", \"max\": " << result.m_max << "}}"
+			<< (i + 1 < results.size() ? ",\n" : "\n");
+	}
+	out << "  ]\n}\n";
+}
+
+/**
+ * Main function of the program. Runs all benchmarks and writes the results as JSON to stdout or to a file, progress
+ * is written to stderr.
+ * Usage: BenchmarkSuite [--duration-ms N] [--output FILE]
+ */
+int main(int argc, char* argv[])
+{
+	unsigned int durationMs = 200;
+	const char* output = nullptr;
+	for (int i = 1; i < argc; i++)
+	{
+		if (0 == std::strcmp(argv[i], "--duration-ms") && i + 1 < argc)
+		{
+			durationMs = static_cast<unsigned int>(std::atoi(argv[++i]));
+		}
+		else if (0 == std::strcmp(argv[i], "--output") && i + 1 < argc)
+		{
+			output = argv[++i];
+		}
+		else
+		{
+			std::cerr << "Usage: " << argv[0] << " [--duration-ms N] [--output FILE]" << std::endl;
+			return 1;
+		}
+	}
+
+	unsigned int cores = std::thread::hardware_concurrency();
+	if (0 == cores)
+	{
+		cores = 1;
+	}
+	std::vector<unsigned int> threadCounts;
+	for (unsigned int threads = 1; threads < cores; threads *= 2)
+	{
+		threadCounts.push_back(threads);
+	}
+	threadCounts.push_back(cores);
+
+	std::vector<Result> results;
+	run_all<ListAdapter<int>, int>(threadCounts, durationMs, results);
+	run_all<SListAdapter<int, Mutex>, int>(threadCounts, durationMs, results);
+	run_all<SListAdapter<int, RWMutex>, int>(threadCounts, durationMs, results);
+	run_all<SListAdapter<int, AdaptiveMutex>, int>(threadCounts, durationMs, results);
+	run_all<StdAdapter<int, std::list<int>>, int>(threadCounts, durationMs, results);
+	run_all<StdAdapter<int, std::deque<int>>, int>(threadCounts, durationMs, results);
+	run_all<ListAdapter<Payload>, Payload>(threadCounts, durationMs, results);
+	run_all<SListAdapter<Payload, Mutex>, Payload>(threadCounts, durationMs, results);
+	run_all<StdAdapter<Payload, std::list<Payload>>, Payload>(threadCounts, durationMs, results);
+	run_all<StdAdapter<Payload, std::deque<Payload>>, Payload>(threadCounts, durationMs, results);
+
+	if (output)
+	{
+		std::ofstream file(output);
+		write_json(file, results, cores, durationMs);
+	}
+	else
+	{
+		write_json(std::cout, results, cores, durationMs);
+	}
+	return 0;
+}
@@ -0,0 +1,126 @@
+/**
+ * @file AdaptiveMutex.cpp
+ * @date 17.10.2026
+ */
+
+#include "AdaptiveMutex.hpp"
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <windows.h>
+#pragma comment(lib, "Synchronization.lib")
+#endif
+
+// Count of backoff rounds before the thread is parked, the n-th round spins 2^n times
+static const unsigned int SPIN_ROUNDS = 7;
+
+/**
+ * Tells the processor that the calling thread is spinning.
+ */
+static inline void cpu_relax()
+{
+#if defined(_WIN32)
+	YieldProcessor();
+#elif defined(__i386__) || defined(__x86_64__)
+	__builtin_ia32_pause();
+#elif defined(__aarch64__)
+	__asm__ __volatile__("yield");
+#endif
+}
+
+/**
+ * Parks the calling thread as long as the value at an address equals an expected value.
+ * @param	address		Address to wait on
+ * @param	expected	Expected value at the address
+ */
+static inline void park(std::atomic<int>* address, int expected)
+{
+#ifdef __linux__
+	syscall(SYS_futex, reinterpret_cast<int*>(address), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+#elif defined(_WIN32)
+	WaitOnAddress(address, &expected, sizeof(expected), INFINITE);
+#endif
+}
+
+/**
+ * Wakes a thread parked on an address.
+ * @param	address	Address the thread is waiting on
+ */
+static inline void unpark_one(std::atomic<int>* address)
+{
+#ifdef __linux__
+	syscall(SYS_futex, reinterpret_cast<int*>(address), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#elif defined(_WIN32)
+	WakeByAddressSingle(address);
+#endif
+}
+
+void AdaptiveMutex::lock_contended()
+{
+	// Spin with exponential backoff, the owner usually leaves short critical sections within a few hundred cycles
+	for (unsigned int round = 0; round < SPIN_ROUNDS; round++)
+	{
+		for (unsigned int i = 0; i < (1u << round); i++)
+		{
+			cpu_relax();
+		}
+		int expected = STATE_UNLOCKED;
+		if (m_state.load(std::memory_order_relaxed) == STATE_UNLOCKED &&
+			m_state.compare_exchange_weak(expected, STATE_LOCKED, std::memory_order_acquire, std::memory_order_relaxed))
+		{
+			return;
+		}
+	}
+
+	// Park the thread. The state is set to STATE_CONTENDED so the owner knows it has to wake a thread when unlocking.
+	while (m_state.exchange(STATE_CONTENDED, std::memory_order_acquire) != STATE_UNLOCKED)
+	{
+		park(&m_state, STATE_CONTENDED);
+	}
+}
+
+AdaptiveMutex::AdaptiveMutex() : m_state(STATE_UNLOCKED)
+{
+	// Nothing to do yet
+}
+
+void AdaptiveMutex::lock()
+{
+	int expected = STATE_UNLOCKED;
+	if (!m_state.compare_exchange_strong(expected, STATE_LOCKED, std::memory_order_acquire, std::memory_order_relaxed))
+	{
+		lock_contended();
+	}
+}
+
+void AdaptiveMutex::unlock()
+{
+	if (m_state.exchange(STATE_UNLOCKED, std::memory_order_release) == STATE_CONTENDED)
+	{
+		unpark_one(&m_state);
+	}
+}
+
+bool AdaptiveMutex::try_lock()
+{
+	int expected = STATE_UNLOCKED;
+	return m_state.compare_exchange_strong(expected, STATE_LOCKED, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+void AdaptiveMutex::lock_shared()
+{
+	lock();
+}
+
+void AdaptiveMutex::unlock_shared()
+{
+	unlock();
+}
+
+bool AdaptiveMutex::try_lock_shared()
+{
+	return try_lock();
+}
@@ -0,0 +1,87 @@
+/**
+ * @file AdaptiveMutex.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef ADAPTIVEMUTEX_HPP
+#define ADAPTIVEMUTEX_HPP
+
+
+#include <atomic>
+
+
+/**
+ * @class AdaptiveMutex
+ * Mutex implementation for short critical sections. Locking an unlocked mutex takes a single compare-and-swap
+ * operation. If the mutex is locked, the calling thread spins for a short time with exponential backoff and parks in
+ * the kernel (futex on Linux, WaitOnAddress on Windows) only if the mutex is still locked afterwards.
+ * In contrast to Mutex the AdaptiveMutex is not recursive. A thread must not lock it again while it is holding it.
+ */
+class AdaptiveMutex
+{
+private:
+	/**
+	 * @enum State
+	 * States of the mutex.
+	 */
+	enum State : int
+	{
+		STATE_UNLOCKED	= 0,
+		STATE_LOCKED	= 1,
+		STATE_CONTENDED	= 2
+	};
+
+	// State of the mutex, one of the values of the State enumeration
+	std::atomic<int> m_state;
+
+	/**
+	 * Spins and finally parks the calling thread until the mutex can be locked.
+	 */
+	void lock_contended();
+
+public:
+	/**
+	 * Constructor for instances of the class AdaptiveMutex.
+	 */
+	AdaptiveMutex();
+
+	/**
+	 * Blocks until the mutex can be locked. Locks the mutex for the calling thread.
+	 */
+	void lock();
+
+	/**
+	 * Unlocks the mutex.
+	 */
+	void unlock();
+
+	/**
+	 * Tries to lock the mutex. The method returns immediately.
+	 * @return	true if the mutex is locked, false otherwise
+	 */
+	bool try_lock();
+
+	/**
+	 * Same as lock. AdaptiveMutex doesn't distinguish between shared and exclusive locking, the method exists in order
+	 * to use it interchangeably with Mutex and RWMutex.
+	 */
+	void lock_shared();
+
+	/**
+	 * Same as unlock.
+	 */
+	void unlock_shared();
+
+	/**
+	 * Same as try_lock.
+	 * @return	true if the mutex is locked, false otherwise
+	 */
+	bool try_lock_shared();
+
+	// Instances of AdaptiveMutex can't be copied
+	AdaptiveMutex(const AdaptiveMutex&) = delete;
+	AdaptiveMutex& operator=(const AdaptiveMutex&) = delete;
+};
+
+
+#endif // #ifndef ADAPTIVEMUTEX_HPP
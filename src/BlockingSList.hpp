@@ -0,0 +1,284 @@
+/**
+ * @file BlockingSList.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef BLOCKINGSLIST_HPP
+#define BLOCKINGSLIST_HPP
+
+
+#include "List.hpp"
+#include "ConditionVariable.hpp"
+#include "Mutex.hpp"
+
+
+/**
+ * @class BlockingMutex
+ * Lock policy of BlockingSList. It is a Mutex with condition variables for threads waiting for elements or for space,
+ * they are notified whenever the count of elements changes while the mutex is locked. This way every method of the
+ * list wakes waiting threads, including the methods of BasicList which don't know about waiting threads.
+ */
+class BlockingMutex : public Mutex
+{
+public:
+	// Condition variable notified when elements are added to the list or the list is closed
+	ConditionVariable	m_notEmpty;
+	// Condition variable notified when elements are removed from the list or the list is closed
+	ConditionVariable	m_notFull;
+
+	/**
+	 * Wakes as many threads waiting for elements or for space as elements or space were added, but not all of them if
+	 * only one can proceed. Notifying a condition variable without waiting threads is cheap.
+	 * @param	before	Count of elements before the change
+	 * @param	after	Count of elements after the change
+	 */
+	void count_changed(size_t before, size_t after)
+	{
+		ConditionVariable& condition = after > before ? m_notEmpty : m_notFull;
+		if (1 == (after > before ? after - before : before - after))
+		{
+			condition.notify_one();
+		}
+		else
+		{
+			condition.notify_all();
+		}
+	}
+};
+
+
+/**
+ * @class LockPolicyTraits<BlockingMutex>
+ * Properties of the lock policy BlockingMutex. Changes of the count of elements wake waiting threads.
+ */
+template<>
+struct LockPolicyTraits<BlockingMutex>
+{
+	static const bool SYNCHRONIZED = true;
+
+	static void count_changed(BlockingMutex& lock, size_t before, size_t after) { lock.count_changed(before, after); }
+};
+
+
+/**
+ * @class BlockingSList
+ * A thread-safe double-linked list class for usage as a work queue. In addition to the methods of SList it provides
+ * methods which wait until an element can be removed from the list, an optional capacity which makes the methods adding
+ * elements wait until the list has space left (backpressure), and a close method which wakes all waiting threads on
+ * shutdown.
+ * Every added element wakes only one thread waiting for an element and every removed element wakes only one thread
+ * waiting for space, no matter which method added or removed it.
+ * BlockingSList inherits BasicList privately and provides only the methods of SList which respect the capacity, so
+ * elements can't be added behind its back, e.g. by merge, swap, load or through a reference to BasicList.
+ * IMPORTANT: The callback functions of the iterate methods must not call methods of the same list which wait, since
+ * the mutex of the list can't be released while it is locked recursively.
+ */
+template<typename T, typename Allocator = PoolAllocator<>>
+class BlockingSList : private BasicList<T, Allocator, BlockingMutex>
+{
+private:
+	typedef BasicList<T, Allocator, BlockingMutex> Base;
+
+	// Maximum count of elements in the list, 0 if the count of elements is not limited
+	size_t				m_capacity;
+	// true if the list was closed
+	bool				m_closed;
+
+	/**
+	 * Blocks until the list has space left for another element or the list is closed. m_lock has to be locked.
+	 * @param	stamp	Stamp of the lock of m_lock, the hold is suspended while waiting
+	 */
+	void wait_for_space(LockStamp& stamp);
+
+	/**
+	 * Blocks until the list contains an element or the list is closed. m_lock has to be locked.
+	 * @param	stamp			Stamp of the lock of m_lock, the hold is suspended while waiting
+	 * @param	timed			true if the method should return after the timeout expired
+	 * @param	milliseconds	Timeout in milliseconds, it is only used if timed is true
+	 * @return					true if the list contains an element, false otherwise
+	 */
+	bool wait_for_element(LockStamp& stamp, bool timed, unsigned long milliseconds);
+
+	/**
+	 * Adds an element to the back or to the front of the list. Blocks until the list has space left unless the list is
+	 * closed.
+	 * @param	back	true to add the element to the back of the list, false to add it to the front
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	void push(bool back, Args&&... args);
+
+public:
+	typedef typename Base::IterationFunction IterationFunction;
+	typedef typename Base::ConstIterationFunction ConstIterationFunction;
+	typedef typename Base::ConstLockedView ConstLockedView;
+
+	// Methods of SList which don't add elements
+	using Base::size;
+	using Base::empty;
+	using Base::clear;
+	using Base::pop_back;
+	using Base::try_pop_back;
+	using Base::try_lock_pop_back;
+	using Base::pop_front;
+	using Base::try_pop_front;
+	using Base::try_lock_pop_front;
+	using Base::pop_front_n;
+	using Base::remove_if;
+	using Base::count;
+	using Base::contains;
+	using Base::iterate;
+	using Base::sort;
+	using Base::unique;
+	using Base::reverse;
+	using Base::reserve;
+	using Base::save;
+#ifdef SLIST_INSTRUMENTATION
+	using Base::statistics;
+	using Base::reset_statistics;
+#endif
+
+	/**
+	 * Constructor for instances of the class BlockingSList.
+	 * @param	capacity	Maximum count of elements in the list, 0 if the count of elements should not be limited
+	 */
+	explicit BlockingSList(size_t capacity = 0);
+
+	/**
+	 * Destructor for instances of the class BlockingSList.
+	 */
+	~BlockingSList();
+
+	/**
+	 * Returns the maximum count of elements in the list.
+	 * @return	The maximum count of elements in the list, 0 if the count of elements is not limited
+	 */
+	size_t capacity() const;
+
+	/**
+	 * Closes the list and wakes all waiting threads. Threads waiting for an element return once the list is empty,
+	 * methods adding elements don't wait for space anymore.
+	 */
+	void close();
+
+	/**
+	 * Checks if the list was closed.
+	 * @return	true if the list was closed, otherwise false
+	 */
+	bool closed();
+
+	/**
+	 * Adds an element to the back of the list. Blocks until the list has space left unless the list is closed.
+	 * @param	element	Element to add to the list
+	 */
+	void push_back(const T& element);
+
+	/**
+	 * Adds an element to the back of the list by moving it into the list. Blocks until the list has space left unless
+	 * the list is closed.
+	 * @param	element	Element to add to the list
+	 */
+	void push_back(T&& element);
+
+	/**
+	 * Adds an element to the back of the list which is constructed in place. Blocks until the list has space left
+	 * unless the list is closed.
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	void emplace_back(Args&&... args);
+
+	/**
+	 * Adds the elements of a range to the back of the list. Blocks whenever the list is full until it has space left
+	 * unless the list is closed. Elements added so far can already be removed by other threads while blocking.
+	 * @param	first	Iterator to the first element of the range
+	 * @param	last	Iterator behind the last element of the range
+	 */
+	template<typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+	void push_back(InputIt first, InputIt last);
+
+	/**
+	 * Moves the elements of another list to the back of the list. Without capacity the nodes of the other list are
+	 * linked in constant time like SList::append. With capacity the elements are moved one by one like by the range
+	 * push_back, blocking whenever the list is full unless the list is closed.
+	 * @param	other	List to move the elements from, it is empty afterwards
+	 */
+	void append(List<T, Allocator>&& other);
+
+	/**
+	 * Adds an element to the front of the list. Blocks until the list has space left unless the list is closed.
+	 * @param	element	Element to add to the list
+	 */
+	void push_front(const T& element);
+
+	/**
+	 * Adds an element to the front of the list by moving it into the list. Blocks until the list has space left
+	 * unless the list is closed.
+	 * @param	element	Element to add to the list
+	 */
+	void push_front(T&& element);
+
+	/**
+	 * Adds an element to the front of the list which is constructed in place. Blocks until the list has space left
+	 * unless the list is closed.
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	void emplace_front(Args&&... args);
+
+	/**
+	 * Blocks until the list contains an element and removes the last element from the list.
+	 * @param	element	Receives the removed last element, it is left unchanged if no element was removed
+	 * @return			true if an element was removed, false if the list is closed and empty
+	 */
+	bool wait_pop_back(T& element);
+
+	/**
+	 * Blocks until the list contains an element or the timeout expires and removes the last element from the list.
+	 * @param	element			Receives the removed last element, it is left unchanged if no element was removed
+	 * @param	milliseconds	Timeout in milliseconds
+	 * @return					true if an element was removed, false if the timeout expired or the list is closed and
+	 *							empty
+	 */
+	bool wait_pop_back(T& element, unsigned long milliseconds);
+
+	/**
+	 * Blocks until the list contains an element and removes the first element from the list.
+	 * @param	element	Receives the removed first element, it is left unchanged if no element was removed
+	 * @return			true if an element was removed, false if the list is closed and empty
+	 */
+	bool wait_pop_front(T& element);
+
+	/**
+	 * Blocks until the list contains an element or the timeout expires and removes the first element from the list.
+	 * @param	element			Receives the removed first element, it is left unchanged if no element was removed
+	 * @param	milliseconds	Timeout in milliseconds
+	 * @return					true if an element was removed, false if the timeout expired or the list is closed and
+	 *							empty
+	 */
+	bool wait_pop_front(T& element, unsigned long milliseconds);
+
+	/**
+	 * Removes elements from the list.
+	 * @param	element	Element to remove from the list
+	 */
+	void remove(const T& element);
+
+	/**
+	 * Returns a read-only view which keeps the list locked in shared mode as long as it exists, see
+	 * SList::locked_view. There is no mutable view since it would give access to all methods of BasicList.
+	 * @return	Read-only view of the list
+	 */
+	ConstLockedView locked_view() const;
+
+	// Instances of BlockingSList can't be copied or moved since other threads might wait for them
+	BlockingSList(const BlockingSList&) = delete;
+	BlockingSList& operator=(const BlockingSList&) = delete;
+};
+
+
+// Include implementation of BlockingSList
+#include "BlockingSList.tpp"
+
+
+#endif // #ifndef BLOCKINGSLIST_HPP
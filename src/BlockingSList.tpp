@@ -0,0 +1,257 @@
+/**
+ * @file BlockingSList.tpp
+ * @date 17.10.2026
+ */
+
+#ifndef BLOCKINGSLIST_HPP
+#error BLOCKINGSLIST_HPP undefined
+#endif
+
+#include <chrono>
+
+template<typename T, typename Allocator>
+void BlockingSList<T, Allocator>::wait_for_space(LockStamp& stamp)
+{
+	while (m_capacity && this->size() >= m_capacity && !m_closed)
+	{
+		this->suspend_hold(stamp);
+		this->m_lock.m_notFull.wait(this->m_lock);
+		this->resume_hold(stamp);
+	}
+}
+
+template<typename T, typename Allocator>
+bool BlockingSList<T, Allocator>::wait_for_element(LockStamp& stamp, bool timed, unsigned long milliseconds)
+{
+	const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() +
+		std::chrono::milliseconds(milliseconds);
+	while (this->empty() && !m_closed)
+	{
+		if (!timed)
+		{
+			this->suspend_hold(stamp);
+			this->m_lock.m_notEmpty.wait(this->m_lock);
+			this->resume_hold(stamp);
+			continue;
+		}
+
+		// Wait for the remaining time only, the thread may have been woken up without getting an element
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		if (now >= deadline)
+		{
+			break;
+		}
+		unsigned long remaining = static_cast<unsigned long>(
+			std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count()) + 1;
+		this->suspend_hold(stamp);
+		this->m_lock.m_notEmpty.wait_for(this->m_lock, remaining);
+		this->resume_hold(stamp);
+	}
+	return !this->empty();
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+void BlockingSList<T, Allocator>::push(bool back, Args&&... args)
+{
+	LockStamp stamp = this->lock(OPERATION_PUSH);
+	try
+	{
+		wait_for_space(stamp);
+		if (back)
+		{
+			this->emplace_back_unlocked(std::forward<Args>(args)...);
+		}
+		else
+		{
+			this->emplace_front_unlocked(std::forward<Args>(args)...);
+		}
+	}
+	catch (...)
+	{
+		this->unlock(stamp);
+		throw;
+	}
+	this->update_count();
+	this->unlock(stamp);
+}
+
+template<typename T, typename Allocator>
+BlockingSList<T, Allocator>::BlockingSList(size_t capacity) : BasicList<T, Allocator, BlockingMutex>(),
+	m_capacity(capacity), m_closed(false)
+{
+	// Nothing to do yet
+}
+
+template<typename T, typename Allocator>
+BlockingSList<T, Allocator>::~BlockingSList()
+{
+	// Nothing to do yet
+}
+
+template<typename T, typename Allocator>
+size_t BlockingSList<T, Allocator>::capacity() const
+{
+	return m_capacity;
+}
+
+template<typename T, typename Allocator>
+void BlockingSList<T, Allocator>::close()
+{
+	LockStamp stamp = this->lock(OPERATION_OTHER);
+	m_closed = true;
+	this->m_lock.m_notEmpty.notify_all();
+	this->m_lock.m_notFull.notify_all();
+	this->unlock(stamp);
+}
+
+template<typename T, typename Allocator>
+bool BlockingSList<T, Allocator>::closed()
+{
+	LockStamp stamp = this->lock(OPERATION_OTHER);
+	bool ret = m_closed;
+	this->unlock(stamp);
+	return ret;
+}
+
+template<typename T, typename Allocator>
+void BlockingSList<T, Allocator>::push_back(const T& element)
+{
+	push(true, element);
+}
+
+template<typename T, typename Allocator>
+void BlockingSList<T, Allocator>::push_back(T&& element)
+{
+	push(true, std::move(element));
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+void BlockingSList<T, Allocator>::emplace_back(Args&&... args)
+{
+	push(true, std::forward<Args>(args)...);
+}
+
+template<typename T, typename Allocator>
+template<typename InputIt, typename>
+void BlockingSList<T, Allocator>::push_back(InputIt first, InputIt last)
+{
+	LockStamp stamp = this->lock(OPERATION_PUSH);
+	try
+	{
+		for (; first != last; ++first)
+		{
+			wait_for_space(stamp);
+			this->emplace_back_unlocked(*first);
+			this->update_count();
+		}
+	}
+	catch (...)
+	{
+		this->update_count();
+		this->unlock(stamp);
+		throw;
+	}
+	this->unlock(stamp);
+}
+
+template<typename T, typename Allocator>
+void BlockingSList<T, Allocator>::append(List<T, Allocator>&& other)
+{
+	if (0 == m_capacity)
+	{
+		Base::append(std::move(other));
+		return;
+	}
+
+	LockStamp stamp = this->lock(OPERATION_PUSH);
+	try
+	{
+		while (!other.empty())
+		{
+			wait_for_space(stamp);
+			this->emplace_back_unlocked(std::move(*other.begin()));
+			other.erase(other.begin());
+			this->update_count();
+		}
+	}
+	catch (...)
+	{
+		this->update_count();
+		this->unlock(stamp);
+		throw;
+	}
+	this->unlock(stamp);
+}
+
+template<typename T, typename Allocator>
+void BlockingSList<T, Allocator>::push_front(const T& element)
+{
+	push(false, element);
+}
+
+template<typename T, typename Allocator>
+void BlockingSList<T, Allocator>::push_front(T&& element)
+{
+	push(false, std::move(element));
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+void BlockingSList<T, Allocator>::emplace_front(Args&&... args)
+{
+	push(false, std::forward<Args>(args)...);
+}
+
+template<typename T, typename Allocator>
+bool BlockingSList<T, Allocator>::wait_pop_back(T& element)
+{
+	LockStamp stamp = this->lock(OPERATION_POP);
+	bool ret = wait_for_element(stamp, false, 0) && this->try_pop_back_unlocked(element);
+	this->update_count();
+	this->unlock(stamp);
+	return ret;
+}
+
+template<typename T, typename Allocator>
+bool BlockingSList<T, Allocator>::wait_pop_back(T& element, unsigned long milliseconds)
+{
+	LockStamp stamp = this->lock(OPERATION_POP);
+	bool ret = wait_for_element(stamp, true, milliseconds) && this->try_pop_back_unlocked(element);
+	this->update_count();
+	this->unlock(stamp);
+	return ret;
+}
+
+template<typename T, typename Allocator>
+bool BlockingSList<T, Allocator>::wait_pop_front(T& element)
+{
+	LockStamp stamp = this->lock(OPERATION_POP);
+	bool ret = wait_for_element(stamp, false, 0) && this->try_pop_front_unlocked(element);
+	this->update_count();
+	this->unlock(stamp);
+	return ret;
+}
+
+template<typename T, typename Allocator>
+bool BlockingSList<T, Allocator>::wait_pop_front(T& element, unsigned long milliseconds)
+{
+	LockStamp stamp = this->lock(OPERATION_POP);
+	bool ret = wait_for_element(stamp, true, milliseconds) && this->try_pop_front_unlocked(element);
+	this->update_count();
+	this->unlock(stamp);
+	return ret;
+}
+
+template<typename T, typename Allocator>
+void BlockingSList<T, Allocator>::remove(const T& element)
+{
+	Base::remove(element);
+}
+
+template<typename T, typename Allocator>
+typename BlockingSList<T, Allocator>::ConstLockedView BlockingSList<T, Allocator>::locked_view() const
+{
+	return Base::locked_view();
+}
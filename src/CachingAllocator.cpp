@@ -0,0 +1,443 @@
+/**
+ * @file CachingAllocator.cpp
+ * @date 17.10.2026
+ */
+
+#include "CachingAllocator.hpp"
+#include <atomic>
+#include <cassert>
+#include <new>
+#include <utility>
+#include "AdaptiveMutex.hpp"
+
+/**
+ * @class Magazine
+ * Stack of free blocks of the same size class.
+ */
+struct CachingAllocator::Magazine
+{
+	// Count of blocks in the magazine
+	size_t		m_count;
+	// Next magazine in a list of the depot
+	Magazine*	m_next;
+	// Blocks of the magazine
+	void*		m_blocks[MAGAZINE_SIZE];
+
+	/**
+	 * Constructor for instances of the class Magazine. The magazine is empty.
+	 */
+	Magazine() : m_count(0), m_next(nullptr) {}
+};
+
+/**
+ * @class Depot
+ * Magazines of a size class which are not used by any thread. The padding keeps the mutexes of neighbouring depots in
+ * different cache lines.
+ */
+struct CachingAllocator::Depot
+{
+	// Mutex guarding the lists of magazines
+	AdaptiveMutex	m_mutex;
+	// Magazines containing at least one block
+	Magazine*		m_filled;
+	// Empty magazines
+	Magazine*		m_empty;
+	// Padding against false sharing
+	char			m_padding[64];
+
+	/**
+	 * Constructor for instances of the class Depot.
+	 */
+	Depot() : m_mutex(), m_filled(nullptr), m_empty(nullptr) {}
+};
+
+/**
+ * @class SharedStatistics
+ * Counters added by all threads.
+ */
+struct SharedStatistics
+{
+	std::atomic<uint64_t>	m_allocations;
+	std::atomic<uint64_t>	m_deallocations;
+	std::atomic<uint64_t>	m_cacheHits;
+	std::atomic<uint64_t>	m_depotTransfers;
+	std::atomic<uint64_t>	m_heapAllocations;
+	std::atomic<uint64_t>	m_heapFrees;
+	std::atomic<uint64_t>	m_magazineAllocations;
+
+	/**
+	 * Constructor for instances of the class SharedStatistics. All counters are zero.
+	 */
+	SharedStatistics()
+	{
+		reset();
+	}
+
+	/**
+	 * Adds counters of a thread.
+	 * @param	statistics	Counters to add
+	 */
+	void add(const CacheStatistics& statistics)
+	{
+		m_allocations.fetch_add(statistics.m_allocations, std::memory_order_relaxed);
+		m_deallocations.fetch_add(statistics.m_deallocations, std::memory_order_relaxed);
+		m_cacheHits.fetch_add(statistics.m_cacheHits, std::memory_order_relaxed);
+		m_depotTransfers.fetch_add(statistics.m_depotTransfers, std::memory_order_relaxed);
+		m_heapAllocations.fetch_add(statistics.m_heapAllocations, std::memory_order_relaxed);
+		m_heapFrees.fetch_add(statistics.m_heapFrees, std::memory_order_relaxed);
+		m_magazineAllocations.fetch_add(statistics.m_magazineAllocations, std::memory_order_relaxed);
+	}
+
+	/**
+	 * Returns a snapshot of the counters.
+	 * @return	Snapshot of the counters
+	 */
+	CacheStatistics load() const
+	{
+		CacheStatistics statistics;
+		statistics.m_allocations = m_allocations.load(std::memory_order_relaxed);
+		statistics.m_deallocations = m_deallocations.load(std::memory_order_relaxed);
+		statistics.m_cacheHits = m_cacheHits.load(std::memory_order_relaxed);
+		statistics.m_depotTransfers = m_depotTransfers.load(std::memory_order_relaxed);
+		statistics.m_heapAllocations = m_heapAllocations.load(std::memory_order_relaxed);
+		statistics.m_heapFrees = m_heapFrees.load(std::memory_order_relaxed);
+		statistics.m_magazineAllocations = m_magazineAllocations.load(std::memory_order_relaxed);
+		return statistics;
+	}
+
+	/**
+	 * Sets all counters to zero.
+	 */
+	void reset()
+	{
+		m_allocations.store(0, std::memory_order_relaxed);
+		m_deallocations.store(0, std::memory_order_relaxed);
+		m_cacheHits.store(0, std::memory_order_relaxed);
+		m_depotTransfers.store(0, std::memory_order_relaxed);
+		m_heapAllocations.store(0, std::memory_order_relaxed);
+		m_heapFrees.store(0, std::memory_order_relaxed);
+		m_magazineAllocations.store(0, std::memory_order_relaxed);
+	}
+};
+
+/**
+ * Returns the counters added by all threads.
+ * @return	Shared counters
+ */
+static SharedStatistics& shared_statistics()
+{
+	static SharedStatistics statistics;
+	return statistics;
+}
+
+// true once the cache of the calling thread was destroyed, later calls of the thread bypass the magazines
+static thread_local bool threadCacheDestroyed = false;
+
+/**
+ * @class ThreadCache
+ * Magazines and counters of a thread. The magazines are passed to the depots when the thread exits.
+ */
+struct CachingAllocator::ThreadCache
+{
+	// Magazine to allocate from and to deallocate to per size class
+	Magazine*		m_loaded[SIZE_CLASSES];
+	// Magazine used when the loaded magazine is empty or full per size class
+	Magazine*		m_previous[SIZE_CLASSES];
+	// Counters not added to the shared counters yet
+	CacheStatistics	m_statistics;
+
+	/**
+	 * Constructor for instances of the class ThreadCache. The thread has no magazines yet.
+	 */
+	ThreadCache() : m_loaded(), m_previous(), m_statistics()
+	{
+		// Nothing to do yet
+	}
+
+	/**
+	 * Destructor for instances of the class ThreadCache. Passes the magazines to the depots and adds the counters to
+	 * the shared counters. Destructors of other thread-local objects may run afterwards, they must not see the
+	 * magazines anymore.
+	 */
+	~ThreadCache()
+	{
+		Depot* depot = depots();
+		for (size_t i = 0; i < SIZE_CLASSES; i++)
+		{
+			Magazine* magazines[] = { m_loaded[i], m_previous[i] };
+			depot[i].m_mutex.lock();
+			for (Magazine* magazine : magazines)
+			{
+				if (!magazine)
+				{
+					continue;
+				}
+				Magazine*& list = magazine->m_count ? depot[i].m_filled : depot[i].m_empty;
+				magazine->m_next = list;
+				list = magazine;
+			}
+			depot[i].m_mutex.unlock();
+			m_loaded[i] = nullptr;
+			m_previous[i] = nullptr;
+		}
+		flush();
+		threadCacheDestroyed = true;
+	}
+
+	/**
+	 * Adds the counters to the shared counters and sets them to zero.
+	 */
+	void flush()
+	{
+		shared_statistics().add(m_statistics);
+		m_statistics = CacheStatistics();
+	}
+};
+
+CachingAllocator::Depot* CachingAllocator::depots()
+{
+	static Depot depot[SIZE_CLASSES];
+	return depot;
+}
+
+CachingAllocator::ThreadCache* CachingAllocator::thread_cache()
+{
+	if (threadCacheDestroyed)
+	{
+		return nullptr;
+	}
+	static thread_local ThreadCache cache;
+	return &cache;
+}
+
+void* CachingAllocator::allocate_slow(ThreadCache& cache)
+{
+	Depot& depot = depots()[m_sizeClass];
+	Magazine*& loaded = cache.m_loaded[m_sizeClass];
+	Magazine*& previous = cache.m_previous[m_sizeClass];
+
+	depot.m_mutex.lock();
+	Magazine* filled = depot.m_filled;
+	if (filled)
+	{
+		// Both magazines of the thread are empty, keep one for deallocations and pass the other one to the depot
+		depot.m_filled = filled->m_next;
+		if (previous)
+		{
+			previous->m_next = depot.m_empty;
+			depot.m_empty = previous;
+		}
+		previous = loaded;
+		loaded = filled;
+	}
+	depot.m_mutex.unlock();
+
+	if (filled)
+	{
+		cache.m_statistics.m_depotTransfers++;
+		cache.flush();
+		return loaded->m_blocks[--loaded->m_count];
+	}
+	cache.m_statistics.m_heapAllocations++;
+	return ::operator new(m_blockSize);
+}
+
+void CachingAllocator::deallocate_slow(ThreadCache& cache, void* block)
+{
+	Depot& depot = depots()[m_sizeClass];
+	Magazine*& loaded = cache.m_loaded[m_sizeClass];
+	Magazine*& previous = cache.m_previous[m_sizeClass];
+
+	depot.m_mutex.lock();
+	if (previous)
+	{
+		// Both magazines of the thread are full, pass one to the depot and continue with an empty one
+		previous->m_next = depot.m_filled;
+		depot.m_filled = previous;
+		previous = nullptr;
+		cache.m_statistics.m_depotTransfers++;
+	}
+	Magazine* empty = depot.m_empty;
+	if (empty)
+	{
+		depot.m_empty = empty->m_next;
+	}
+	depot.m_mutex.unlock();
+
+	if (!empty)
+	{
+		empty = new Magazine();
+		cache.m_statistics.m_magazineAllocations++;
+	}
+	previous = loaded;
+	loaded = empty;
+	loaded->m_blocks[loaded->m_count++] = block;
+	cache.flush();
+}
+
+CachingAllocator::CachingAllocator(size_t blockSize, size_t alignment) : m_blockSize(blockSize),
+	m_sizeClass(SIZE_CLASSES)
+{
+	assert(alignment <= alignof(std::max_align_t));
+	(void)alignment;
+
+	// operator new returns blocks aligned for every fundamental type, so only the size decides the size class
+	size_t sizeClass = (0 == blockSize) ? 0 : (blockSize - 1) / SIZE_GRANULARITY;
+	if (sizeClass < SIZE_CLASSES)
+	{
+		// Blocks of a size class are interchangeable, so all of them have the largest size of the class
+		m_sizeClass = sizeClass;
+		m_blockSize = (sizeClass + 1) * SIZE_GRANULARITY;
+	}
+}
+
+void* CachingAllocator::allocate()
+{
+	ThreadCache* cache = thread_cache();
+	if (!cache)
+	{
+		// The thread exits, blocks of any size class can be deallocated to the heap later
+		CacheStatistics statistics = CacheStatistics();
+		statistics.m_allocations = 1;
+		statistics.m_heapAllocations = 1;
+		shared_statistics().add(statistics);
+		return ::operator new(m_blockSize);
+	}
+
+	cache->m_statistics.m_allocations++;
+	if (SIZE_CLASSES == m_sizeClass)
+	{
+		cache->m_statistics.m_heapAllocations++;
+		return ::operator new(m_blockSize);
+	}
+
+	Magazine*& loaded = cache->m_loaded[m_sizeClass];
+	Magazine*& previous = cache->m_previous[m_sizeClass];
+	if (!(loaded && loaded->m_count) && previous && previous->m_count)
+	{
+		std::swap(loaded, previous);
+	}
+	if (loaded && loaded->m_count)
+	{
+		cache->m_statistics.m_cacheHits++;
+		return loaded->m_blocks[--loaded->m_count];
+	}
+	return allocate_slow(*cache);
+}
+
+void CachingAllocator::deallocate(void* block)
+{
+	ThreadCache* cache = thread_cache();
+	if (!cache)
+	{
+		// The thread exits, every block was allocated by operator new
+		CacheStatistics statistics = CacheStatistics();
+		statistics.m_deallocations = 1;
+		statistics.m_heapFrees = 1;
+		shared_statistics().add(statistics);
+		::operator delete(block);
+		return;
+	}
+
+	cache->m_statistics.m_deallocations++;
+	if (SIZE_CLASSES == m_sizeClass)
+	{
+		cache->m_statistics.m_heapFrees++;
+		::operator delete(block);
+		return;
+	}
+
+	Magazine*& loaded = cache->m_loaded[m_sizeClass];
+	Magazine*& previous = cache->m_previous[m_sizeClass];
+	if (!(loaded && loaded->m_count < MAGAZINE_SIZE) && previous && previous->m_count < MAGAZINE_SIZE)
+	{
+		std::swap(loaded, previous);
+	}
+	if (loaded && loaded->m_count < MAGAZINE_SIZE)
+	{
+		loaded->m_blocks[loaded->m_count++] = block;
+		return;
+	}
+	deallocate_slow(*cache, block);
+}
+
+void CachingAllocator::reserve(size_t /*blocks*/)
+{
+	// Nothing to do, blocks are taken from the magazines one by one
+}
+
+void CachingAllocator::release()
+{
+	// Nothing to do, blocks are deallocated separately
+}
+
+void CachingAllocator::splice(CachingAllocator& /*other*/)
+{
+	// Nothing to do, blocks are not owned by a specific allocator
+}
+
+void CachingAllocator::swap(CachingAllocator& /*other*/)
+{
+	// Nothing to do, blocks are not owned by a specific allocator
+}
+
+void CachingAllocator::trim()
+{
+	CacheStatistics statistics = CacheStatistics();
+	Depot* depot = depots();
+	for (size_t i = 0; i < SIZE_CLASSES; i++)
+	{
+		depot[i].m_mutex.lock();
+		Magazine* filled = depot[i].m_filled;
+		Magazine* empty = depot[i].m_empty;
+		depot[i].m_filled = nullptr;
+		depot[i].m_empty = nullptr;
+		depot[i].m_mutex.unlock();
+
+		Magazine* magazines[] = { filled, empty };
+		for (Magazine* magazine : magazines)
+		{
+			while (magazine)
+			{
+				Magazine* next = magazine->m_next;
+				for (size_t j = 0; j < magazine->m_count; j++)
+				{
+					::operator delete(magazine->m_blocks[j]);
+				}
+				statistics.m_heapFrees += magazine->m_count;
+				delete magazine;
+				magazine = next;
+			}
+		}
+	}
+	shared_statistics().add(statistics);
+}
+
+CacheStatistics CachingAllocator::statistics()
+{
+	CacheStatistics statistics = shared_statistics().load();
+	ThreadCache* cache = thread_cache();
+	if (!cache)
+	{
+		return statistics;
+	}
+	const CacheStatistics& local = cache->m_statistics;
+	statistics.m_allocations += local.m_allocations;
+	statistics.m_deallocations += local.m_deallocations;
+	statistics.m_cacheHits += local.m_cacheHits;
+	statistics.m_depotTransfers += local.m_depotTransfers;
+	statistics.m_heapAllocations += local.m_heapAllocations;
+	statistics.m_heapFrees += local.m_heapFrees;
+	statistics.m_magazineAllocations += local.m_magazineAllocations;
+	return statistics;
+}
+
+void CachingAllocator::reset_statistics()
+{
+	shared_statistics().reset();
+	ThreadCache* cache = thread_cache();
+	if (cache)
+	{
+		cache->m_statistics = CacheStatistics();
+	}
+}
@@ -0,0 +1,168 @@
+/**
+ * @file CachingAllocator.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef CACHINGALLOCATOR_HPP
+#define CACHINGALLOCATOR_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+
+
+/**
+ * @class CacheStatistics
+ * Snapshot of the counters of CachingAllocator.
+ */
+struct CacheStatistics
+{
+	// Count of allocated blocks
+	uint64_t	m_allocations;
+	// Count of deallocated blocks
+	uint64_t	m_deallocations;
+	// Count of allocations served by the magazines of the allocating thread without touching the depot or the heap
+	uint64_t	m_cacheHits;
+	// Count of magazines exchanged between the threads and the depot
+	uint64_t	m_depotTransfers;
+	// Count of blocks allocated on the heap since no magazine held a block
+	uint64_t	m_heapAllocations;
+	// Count of blocks returned to the heap, only blocks too large for the magazines and blocks freed by trim
+	uint64_t	m_heapFrees;
+	// Count of magazines allocated on the heap
+	uint64_t	m_magazineAllocations;
+};
+
+
+/**
+ * @class CachingAllocator
+ * Thread-safe allocator for fixed-size blocks which keeps freed blocks in magazines of the freeing thread. Every thread
+ * owns two magazines per block size, allocating and deallocating only touches these magazines. If both are empty (or
+ * full), a whole magazine is exchanged with a global depot, so blocks freed by consumer threads reach producer threads
+ * in batches of MAGAZINE_SIZE blocks. Once enough blocks circulate, adding and removing elements doesn't call the heap
+ * at all. All instances with the same block size share the magazines, blocks are never returned to the heap unless
+ * trim is called.
+ * Blocks larger than the largest size class are allocated on the heap directly.
+ */
+class CachingAllocator
+{
+private:
+	// Count of blocks in a magazine
+	static const size_t MAGAZINE_SIZE = 64;
+	// Block sizes are rounded up to multiples of the granularity
+	static const size_t SIZE_GRANULARITY = 16;
+	// Count of size classes, larger blocks are not cached
+	static const size_t SIZE_CLASSES = 32;
+
+	struct Magazine;
+	struct Depot;
+	struct ThreadCache;
+
+	// Size of a block in bytes
+	size_t	m_blockSize;
+	// Size class of the blocks, SIZE_CLASSES if the blocks are too large to be cached
+	size_t	m_sizeClass;
+
+	/**
+	 * Returns the depots of all size classes.
+	 * @return	Array of SIZE_CLASSES depots
+	 */
+	static Depot* depots();
+
+	/**
+	 * Returns the magazines and counters of the calling thread.
+	 * @return	Cache of the calling thread, nullptr if the thread exits and its cache was destroyed already
+	 */
+	static ThreadCache* thread_cache();
+
+	/**
+	 * Allocates a block when both magazines of the calling thread are empty. Takes a filled magazine from the depot
+	 * or allocates the block on the heap.
+	 * @param	cache	Cache of the calling thread
+	 * @return			Pointer to the block
+	 */
+	void* allocate_slow(ThreadCache& cache);
+
+	/**
+	 * Deallocates a block when both magazines of the calling thread are full. Passes a full magazine to the depot.
+	 * @param	cache	Cache of the calling thread
+	 * @param	block	Block to deallocate
+	 */
+	void deallocate_slow(ThreadCache& cache, void* block);
+
+public:
+	/**
+	 * true if all blocks can be returned at once by calling release, so they don't need to be deallocated one by one.
+	 */
+	static constexpr bool BULK_RELEASE = false;
+
+	/**
+	 * true if blocks can be deallocated by any thread without locking the owner of the allocator.
+	 */
+	static constexpr bool THREAD_SAFE = true;
+
+	/**
+	 * Constructor for instances of the class CachingAllocator. Destructors of thread-local objects may still allocate
+	 * and deallocate blocks after the magazines of the exiting thread were destroyed, these blocks bypass the magazines.
+	 * @param	blockSize	Size of the blocks in bytes
+	 * @param	alignment	Alignment of the blocks in bytes, it must not exceed the alignment of std::max_align_t
+	 */
+	explicit CachingAllocator(size_t blockSize, size_t alignment = alignof(std::max_align_t));
+
+	/**
+	 * Allocates a block of the size passed to the constructor, preferably from the magazines of the calling thread.
+	 * @return	Pointer to the block
+	 */
+	void* allocate();
+
+	/**
+	 * Puts a block into the magazines of the calling thread. The block may have been allocated by another thread or by
+	 * another CachingAllocator with the same block size.
+	 * @param	block	Block returned by allocate
+	 */
+	void deallocate(void* block);
+
+	/**
+	 * Does nothing, every block is allocated separately.
+	 * @param	blocks	Count of blocks to reserve
+	 */
+	void reserve(size_t blocks);
+
+	/**
+	 * Does nothing, every block has to be deallocated separately.
+	 */
+	void release();
+
+	/**
+	 * Does nothing, blocks allocated by another CachingAllocator can be deallocated by this allocator.
+	 * @param	other	Allocator to take the blocks from
+	 */
+	void splice(CachingAllocator& other);
+
+	/**
+	 * Does nothing, blocks allocated by another CachingAllocator can be deallocated by this allocator.
+	 * @param	other	Allocator to swap with
+	 */
+	void swap(CachingAllocator& other);
+
+	/**
+	 * Returns the blocks of the filled magazines in the depot and all empty magazines in the depot to the heap. The
+	 * magazines of the threads are kept.
+	 */
+	static void trim();
+
+	/**
+	 * Returns a snapshot of the counters of all threads. Threads add their counters when they exchange a magazine with
+	 * the depot and when they exit, the counters of the calling thread are always included.
+	 * @return	Snapshot of the counters
+	 */
+	static CacheStatistics statistics();
+
+	/**
+	 * Sets the counters of the calling thread and the counters already added by other threads to zero.
+	 */
+	static void reset_statistics();
+};
+
+
+#endif // #ifndef CACHINGALLOCATOR_HPP
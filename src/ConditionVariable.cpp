@@ -0,0 +1,79 @@
+/**
+ * @file ConditionVariable.cpp
+ * @date 17.10.2026
+ */
+
+#include "ConditionVariable.hpp"
+
+#ifdef __linux__
+#include <cerrno>
+#include <ctime>
+#endif
+
+ConditionVariable::ConditionVariable()
+{
+#ifdef __linux__
+	// Use the monotonic clock for timeouts, so they are not affected by changes of the system time
+	pthread_condattr_t attr;
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_cond_init(&m_condition, &attr);
+	pthread_condattr_destroy(&attr);
+#elif defined(_WIN32)
+	InitializeConditionVariable(&m_condition);
+#endif
+}
+
+ConditionVariable::~ConditionVariable()
+{
+#ifdef __linux__
+	pthread_cond_destroy(&m_condition);
+#elif defined(_WIN32)
+	// Nothing to do, condition variables don't need to be destroyed
+#endif
+}
+
+void ConditionVariable::wait(Mutex& mutex)
+{
+#ifdef __linux__
+	pthread_cond_wait(&m_condition, &mutex.m_mutex);
+#elif defined(_WIN32)
+	SleepConditionVariableCS(&m_condition, &mutex.m_section, INFINITE);
+#endif
+}
+
+bool ConditionVariable::wait_for(Mutex& mutex, unsigned long milliseconds)
+{
+#ifdef __linux__
+	timespec deadline;
+	clock_gettime(CLOCK_MONOTONIC, &deadline);
+	deadline.tv_sec += static_cast<time_t>(milliseconds / 1000);
+	deadline.tv_nsec += static_cast<long>(milliseconds % 1000) * 1000000L;
+	if (deadline.tv_nsec >= 1000000000L)
+	{
+		deadline.tv_sec++;
+		deadline.tv_nsec -= 1000000000L;
+	}
+	return (ETIMEDOUT != pthread_cond_timedwait(&m_condition, &mutex.m_mutex, &deadline));
+#elif defined(_WIN32)
+	return (0 != SleepConditionVariableCS(&m_condition, &mutex.m_section, static_cast<DWORD>(milliseconds)));
+#endif
+}
+
+void ConditionVariable::notify_one()
+{
+#ifdef __linux__
+	pthread_cond_signal(&m_condition);
+#elif defined(_WIN32)
+	WakeConditionVariable(&m_condition);
+#endif
+}
+
+void ConditionVariable::notify_all()
+{
+#ifdef __linux__
+	pthread_cond_broadcast(&m_condition);
+#elif defined(_WIN32)
+	WakeAllConditionVariable(&m_condition);
+#endif
+}
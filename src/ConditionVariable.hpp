@@ -0,0 +1,77 @@
+/**
+ * @file ConditionVariable.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef CONDITIONVARIABLE_HPP
+#define CONDITIONVARIABLE_HPP
+
+
+#ifdef __linux__
+#include <pthread.h>
+#elif defined(_WIN32)
+#include <windows.h>
+#endif
+#include "Mutex.hpp"
+
+
+/**
+ * @class ConditionVariable
+ * Condition variable implementation like the std::condition_variable class of the STL. It is used together with the
+ * Mutex class.
+ * IMPORTANT: Mutex is recursive, but the mutex passed to the wait methods must be locked exactly once by the calling
+ * thread. Otherwise it is not released while the thread is waiting.
+ */
+class ConditionVariable
+{
+private:
+#ifdef __linux__
+	// Condition variable object of the ConditionVariable class
+	pthread_cond_t m_condition;
+#elif defined(_WIN32)
+	// Condition variable object of the ConditionVariable class
+	CONDITION_VARIABLE m_condition;
+#endif
+
+public:
+	/**
+	 * Constructor for instances of the class ConditionVariable.
+	 */
+	ConditionVariable();
+
+	/**
+	 * Destructor for instances of the class ConditionVariable.
+	 */
+	virtual ~ConditionVariable();
+
+	/**
+	 * Unlocks the mutex and blocks until the condition variable is notified. The mutex is locked again before the
+	 * method returns. The method may return without being notified (spurious wakeup), so the waited-for condition has
+	 * to be checked again afterwards.
+	 * @param	mutex	Mutex locked by the calling thread
+	 */
+	void wait(Mutex& mutex);
+
+	/**
+	 * Unlocks the mutex and blocks until the condition variable is notified or the timeout expires. The mutex is
+	 * locked again before the method returns. The method may return without being notified (spurious wakeup), so the
+	 * waited-for condition has to be checked again afterwards.
+	 * @param	mutex			Mutex locked by the calling thread
+	 * @param	milliseconds	Timeout in milliseconds
+	 * @return					false if the timeout expired, true otherwise
+	 */
+	bool wait_for(Mutex& mutex, unsigned long milliseconds);
+
+	/**
+	 * Wakes one of the threads waiting for the condition variable.
+	 */
+	void notify_one();
+
+	/**
+	 * Wakes all threads waiting for the condition variable.
+	 */
+	void notify_all();
+};
+
+
+#endif // #ifndef CONDITIONVARIABLE_HPP
@@ -0,0 +1,255 @@
+/**
+ * @file FlatCombiningSList.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef FLATCOMBININGSLIST_HPP
+#define FLATCOMBININGSLIST_HPP
+
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include "List.hpp"
+#include "Mutex.hpp"
+
+
+/**
+ * @class FlatCombiningSList
+ * A thread-safe list class for many threads adding and removing single elements at the ends of the list. Instead of
+ * locking the list for every operation, a thread publishes its operation in its own slot and tries to lock the list.
+ * The thread which gets the lock (the combiner) executes the pending operations of all slots in one pass and passes
+ * the results back through the slots, while the other threads wait for their slot to be done. The list, its size and
+ * the mutex stay in the cache of the combiner instead of moving between the cores for every operation.
+ * Threads are assigned to slots round-robin. If a thread finds its slot used by another thread, it locks the list and
+ * executes its operation itself.
+ * @tparam	T			Type of the elements of the list
+ * @tparam	Allocator	Allocator for the nodes of the list, e.g. PoolAllocator (default) or HeapAllocator
+ * @tparam	MutexType	Mutex used to lock the list, e.g. Mutex (default) or AdaptiveMutex
+ */
+template<typename T, typename Allocator = PoolAllocator<>, typename MutexType = Mutex>
+class FlatCombiningSList
+{
+private:
+	/**
+	 * @enum Operation
+	 * Operations which can be published in a slot.
+	 */
+	enum Operation : unsigned char
+	{
+		OPERATION_PUSH_BACK		= 0,
+		OPERATION_PUSH_FRONT	= 1,
+		OPERATION_POP_BACK		= 2,
+		OPERATION_POP_FRONT		= 3
+	};
+
+	/**
+	 * @enum SlotState
+	 * States of a slot.
+	 */
+	enum SlotState : unsigned char
+	{
+		// The slot is not used by any thread
+		SLOT_FREE		= 0,
+		// A thread writes its operation to the slot
+		SLOT_CLAIMED	= 1,
+		// The operation waits for a combiner
+		SLOT_PENDING	= 2,
+		// The operation was executed, the result can be read
+		SLOT_DONE		= 3
+	};
+
+	/**
+	 * @class Slot
+	 * Operation published by a thread. The padding keeps neighbouring slots in different cache lines, so every thread
+	 * waits on its own cache line.
+	 */
+	struct Slot
+	{
+		// State of the slot, one of the values of the SlotState enumeration
+		std::atomic<unsigned char>	m_state;
+		// Published operation
+		Operation					m_operation;
+		// true if the operation succeeded, pop operations fail if the list is empty
+		bool						m_result;
+		// Element to move into the list or receiving the removed element, it belongs to the publishing thread
+		T*							m_element;
+		// Exception thrown by the operation, it is rethrown by the publishing thread
+		std::exception_ptr			m_exception;
+		// Padding against false sharing
+		char						m_padding[64];
+
+		/**
+		 * Constructor for instances of the class Slot.
+		 */
+		Slot() : m_state(SLOT_FREE), m_operation(OPERATION_PUSH_BACK), m_result(false), m_element(nullptr) {}
+	};
+
+	// Maximum count of passes over the slots of one combiner, it bounds the time a combiner works for other threads
+	static const size_t COMBINING_PASSES = 3;
+
+	// Elements of the list
+	List<T, Allocator>	m_list;
+	// Mutex guarding m_list
+	mutable MutexType	m_mutex;
+	// Count of elements in m_list, it can be read without locking m_mutex
+	std::atomic<size_t>	m_count;
+	// Slots of the threads
+	Slot*				m_slots;
+	// Count of slots
+	size_t				m_slotCount;
+
+	/**
+	 * Returns the index of the slot of the calling thread. Threads are assigned to slots round-robin on their first
+	 * call.
+	 * @return	Index of the slot of the calling thread
+	 */
+	size_t local_slot() const;
+
+	/**
+	 * Executes an operation on m_list. m_mutex has to be locked.
+	 * @param	operation	Operation to execute
+	 * @param	element		Element to move into the list or receiving the removed element
+	 * @return				true if the operation succeeded, false if a pop operation found the list empty
+	 */
+	bool execute(Operation operation, T* element);
+
+	/**
+	 * Executes the pending operations of all slots and updates m_count. m_mutex has to be locked.
+	 */
+	void combine();
+
+	/**
+	 * Publishes an operation in the slot of the calling thread and waits until it was executed by a combiner, which
+	 * is the calling thread itself if it gets the lock. Exceptions thrown by the operation are rethrown.
+	 * @param	operation	Operation to execute
+	 * @param	element		Element to move into the list or receiving the removed element
+	 * @return				true if the operation succeeded, false if a pop operation found the list empty
+	 */
+	bool run(Operation operation, T* element);
+
+public:
+	/**
+	 * Constructor for instances of the class FlatCombiningSList.
+	 * @param	slots	Count of slots, 0 to use two slots per core. Threads sharing a slot lock the list themselves
+	 *					while the slot is used by the other thread, so there should be a slot for every thread.
+	 */
+	explicit FlatCombiningSList(size_t slots = 0);
+
+	/**
+	 * Destructor for instances of the class FlatCombiningSList.
+	 */
+	~FlatCombiningSList();
+
+	/**
+	 * Returns the count of slots.
+	 * @return	The count of slots
+	 */
+	size_t slot_count() const;
+
+	/**
+	 * Returns the count of elements in the list at the time of the call without locking the list.
+	 * @return	The count of elements in the list
+	 */
+	size_t size() const;
+
+	/**
+	 * Checks if the list is empty at the time of the call without locking the list.
+	 * @return	true if the list is empty, otherwise false
+	 */
+	bool empty() const;
+
+	/**
+	 * Removes all elements from the list. The elements are destroyed after unlocking the list.
+	 */
+	void clear();
+
+	/**
+	 * Adds an element to the back of the list. The element is copied before its operation is published.
+	 * @param	element	Element to add to the list
+	 */
+	void push_back(const T& element);
+
+	/**
+	 * Adds an element to the back of the list by moving it into the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_back(T&& element);
+
+	/**
+	 * Adds an element to the back of the list. The element is constructed before its operation is published and moved
+	 * into the list.
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	void emplace_back(Args&&... args);
+
+	/**
+	 * Adds an element to the front of the list. The element is copied before its operation is published.
+	 * @param	element	Element to add to the list
+	 */
+	void push_front(const T& element);
+
+	/**
+	 * Adds an element to the front of the list by moving it into the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_front(T&& element);
+
+	/**
+	 * Adds an element to the front of the list. The element is constructed before its operation is published and
+	 * moved into the list.
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	void emplace_front(Args&&... args);
+
+	/**
+	 * Removes the last element from the list if the list is not empty. The element is moved out of the list.
+	 * @param	element	Receives the removed last element, it is left unchanged if the list is empty
+	 * @return			true if an element was removed, false if the list is empty
+	 */
+	bool try_pop_back(T& element);
+
+	/**
+	 * Removes the first element from the list if the list is not empty. The element is moved out of the list.
+	 * @param	element	Receives the removed first element, it is left unchanged if the list is empty
+	 * @return			true if an element was removed, false if the list is empty
+	 */
+	bool try_pop_front(T& element);
+
+	/**
+	 * Removes the last element from the list and returns it. The element is moved out of the list.
+	 * @return	The removed last element or a value-initialized element if the list is empty
+	 */
+	T pop_back();
+
+	/**
+	 * Removes the first element from the list and returns it. The element is moved out of the list.
+	 * @return	The removed first element or a value-initialized element if the list is empty
+	 */
+	T pop_front();
+
+	/**
+	 * Iterates from the front to the back of the list using a lambda function as callback function for every element
+	 * in the list. The list is locked for the whole iteration, pending operations are executed before. The callback
+	 * lambda function should have the following signature:
+	 * auto func = [your lambda capture list goes here](T& element) -> ListInterationAction { your code goes here };
+	 * The callback function must not call methods of the same list.
+	 * @param	func	Callback lambda function called for every element in the list. It receives a reference to the
+	 *					current element as a parameter.
+	 */
+	template<typename Lambda>
+	void iterate(const Lambda& func);
+
+	// Instances of FlatCombiningSList can't be copied since other threads might access them during the copy
+	FlatCombiningSList(const FlatCombiningSList&) = delete;
+	FlatCombiningSList& operator=(const FlatCombiningSList&) = delete;
+};
+
+
+// Include implementation of FlatCombiningSList
+#include "FlatCombiningSList.tpp"
+
+
+#endif // #ifndef FLATCOMBININGSLIST_HPP
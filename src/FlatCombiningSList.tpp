@@ -0,0 +1,260 @@
+/**
+ * @file FlatCombiningSList.tpp
+ * @date 17.10.2026
+ */
+
+#ifndef FLATCOMBININGSLIST_HPP
+#error FLATCOMBININGSLIST_HPP undefined
+#endif
+
+#include <thread>
+#include <utility>
+
+template<typename T, typename Allocator, typename MutexType>
+size_t FlatCombiningSList<T, Allocator, MutexType>::local_slot() const
+{
+	// Hashing the thread id distributes badly since thread ids are often aligned addresses, count the threads instead
+	static std::atomic<size_t> nextThread(0);
+	static thread_local size_t threadIndex = nextThread.fetch_add(1, std::memory_order_relaxed);
+	return threadIndex % m_slotCount;
+}
+
+template<typename T, typename Allocator, typename MutexType>
+bool FlatCombiningSList<T, Allocator, MutexType>::execute(Operation operation, T* element)
+{
+	switch (operation)
+	{
+	case OPERATION_PUSH_BACK:
+		m_list.push_back(std::move(*element));
+		return true;
+	case OPERATION_PUSH_FRONT:
+		m_list.push_front(std::move(*element));
+		return true;
+	case OPERATION_POP_BACK:
+		return m_list.try_pop_back(*element);
+	case OPERATION_POP_FRONT:
+		return m_list.try_pop_front(*element);
+	}
+	return false;
+}
+
+template<typename T, typename Allocator, typename MutexType>
+void FlatCombiningSList<T, Allocator, MutexType>::combine()
+{
+	for (size_t pass = 0; pass < COMBINING_PASSES; pass++)
+	{
+		size_t executed = 0;
+		for (size_t i = 0; i < m_slotCount; i++)
+		{
+			Slot& slot = m_slots[i];
+			if (SLOT_PENDING == slot.m_state.load(std::memory_order_acquire))
+			{
+				try
+				{
+					slot.m_result = execute(slot.m_operation, slot.m_element);
+				}
+				catch (...)
+				{
+					// The operation belongs to another thread, pass the exception to it
+					slot.m_result = false;
+					slot.m_exception = std::current_exception();
+				}
+				slot.m_state.store(SLOT_DONE, std::memory_order_release);
+				executed++;
+			}
+		}
+
+		// Another pass only pays off if several threads are waiting for the list
+		if (executed < 2)
+		{
+			break;
+		}
+	}
+	m_count.store(m_list.size(), std::memory_order_release);
+}
+
+template<typename T, typename Allocator, typename MutexType>
+bool FlatCombiningSList<T, Allocator, MutexType>::run(Operation operation, T* element)
+{
+	Slot& slot = m_slots[local_slot()];
+	unsigned char state = SLOT_FREE;
+	if (!slot.m_state.compare_exchange_strong(state, SLOT_CLAIMED, std::memory_order_acquire,
+		std::memory_order_relaxed))
+	{
+		// Another thread shares the slot and uses it right now, execute the operation directly
+		bool result = false;
+		m_mutex.lock();
+		try
+		{
+			result = execute(operation, element);
+		}
+		catch (...)
+		{
+			m_count.store(m_list.size(), std::memory_order_release);
+			m_mutex.unlock();
+			throw;
+		}
+		combine();
+		m_mutex.unlock();
+		return result;
+	}
+
+	slot.m_operation = operation;
+	slot.m_element = element;
+	slot.m_state.store(SLOT_PENDING, std::memory_order_release);
+	while (SLOT_DONE != slot.m_state.load(std::memory_order_acquire))
+	{
+		if (m_mutex.try_lock())
+		{
+			// Become the combiner, the operation of the calling thread is executed along with all others
+			combine();
+			m_mutex.unlock();
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	bool result = slot.m_result;
+	std::exception_ptr exception = slot.m_exception;
+	slot.m_exception = nullptr;
+	slot.m_state.store(SLOT_FREE, std::memory_order_release);
+	if (exception)
+	{
+		std::rethrow_exception(exception);
+	}
+	return result;
+}
+
+template<typename T, typename Allocator, typename MutexType>
+FlatCombiningSList<T, Allocator, MutexType>::FlatCombiningSList(size_t slots) : m_list(), m_mutex(), m_count(0),
+	m_slots(nullptr), m_slotCount(slots)
+{
+	if (0 == m_slotCount)
+	{
+		m_slotCount = 2 * std::thread::hardware_concurrency();
+		if (0 == m_slotCount)
+		{
+			m_slotCount = 2;
+		}
+	}
+	m_slots = new Slot[m_slotCount];
+}
+
+template<typename T, typename Allocator, typename MutexType>
+FlatCombiningSList<T, Allocator, MutexType>::~FlatCombiningSList()
+{
+	delete[] m_slots;
+}
+
+template<typename T, typename Allocator, typename MutexType>
+size_t FlatCombiningSList<T, Allocator, MutexType>::slot_count() const
+{
+	return m_slotCount;
+}
+
+template<typename T, typename Allocator, typename MutexType>
+size_t FlatCombiningSList<T, Allocator, MutexType>::size() const
+{
+	return m_count.load(std::memory_order_acquire);
+}
+
+template<typename T, typename Allocator, typename MutexType>
+bool FlatCombiningSList<T, Allocator, MutexType>::empty() const
+{
+	return 0 == m_count.load(std::memory_order_acquire);
+}
+
+template<typename T, typename Allocator, typename MutexType>
+void FlatCombiningSList<T, Allocator, MutexType>::clear()
+{
+	// Take over the nodes in constant time, they are destroyed after unlocking
+	List<T, Allocator> detached;
+	m_mutex.lock();
+	combine();
+	detached.swap(m_list);
+	m_count.store(0, std::memory_order_release);
+	m_mutex.unlock();
+}
+
+template<typename T, typename Allocator, typename MutexType>
+void FlatCombiningSList<T, Allocator, MutexType>::push_back(const T& element)
+{
+	T copy(element);
+	run(OPERATION_PUSH_BACK, &copy);
+}
+
+template<typename T, typename Allocator, typename MutexType>
+void FlatCombiningSList<T, Allocator, MutexType>::push_back(T&& element)
+{
+	run(OPERATION_PUSH_BACK, &element);
+}
+
+template<typename T, typename Allocator, typename MutexType>
+template<typename... Args>
+void FlatCombiningSList<T, Allocator, MutexType>::emplace_back(Args&&... args)
+{
+	T element(std::forward<Args>(args)...);
+	run(OPERATION_PUSH_BACK, &element);
+}
+
+template<typename T, typename Allocator, typename MutexType>
+void FlatCombiningSList<T, Allocator, MutexType>::push_front(const T& element)
+{
+	T copy(element);
+	run(OPERATION_PUSH_FRONT, &copy);
+}
+
+template<typename T, typename Allocator, typename MutexType>
+void FlatCombiningSList<T, Allocator, MutexType>::push_front(T&& element)
+{
+	run(OPERATION_PUSH_FRONT, &element);
+}
+
+template<typename T, typename Allocator, typename MutexType>
+template<typename... Args>
+void FlatCombiningSList<T, Allocator, MutexType>::emplace_front(Args&&... args)
+{
+	T element(std::forward<Args>(args)...);
+	run(OPERATION_PUSH_FRONT, &element);
+}
+
+template<typename T, typename Allocator, typename MutexType>
+bool FlatCombiningSList<T, Allocator, MutexType>::try_pop_back(T& element)
+{
+	return run(OPERATION_POP_BACK, &element);
+}
+
+template<typename T, typename Allocator, typename MutexType>
+bool FlatCombiningSList<T, Allocator, MutexType>::try_pop_front(T& element)
+{
+	return run(OPERATION_POP_FRONT, &element);
+}
+
+template<typename T, typename Allocator, typename MutexType>
+T FlatCombiningSList<T, Allocator, MutexType>::pop_back()
+{
+	T element = T();
+	run(OPERATION_POP_BACK, &element);
+	return element;
+}
+
+template<typename T, typename Allocator, typename MutexType>
+T FlatCombiningSList<T, Allocator, MutexType>::pop_front()
+{
+	T element = T();
+	run(OPERATION_POP_FRONT, &element);
+	return element;
+}
+
+template<typename T, typename Allocator, typename MutexType>
+template<typename Lambda>
+void FlatCombiningSList<T, Allocator, MutexType>::iterate(const Lambda& func)
+{
+	m_mutex.lock();
+	combine();
+	m_list.iterate(func);
+	m_count.store(m_list.size(), std::memory_order_release);
+	m_mutex.unlock();
+}
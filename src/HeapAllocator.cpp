@@ -0,0 +1,42 @@
+/**
+ * @file HeapAllocator.cpp
+ * @date 17.10.2026
+ */
+
+#include "HeapAllocator.hpp"
+#include <new>
+
+HeapAllocator::HeapAllocator(size_t blockSize, size_t /*alignment*/) : m_blockSize(blockSize)
+{
+	// Nothing to do yet, operator new returns blocks aligned for every fundamental type
+}
+
+void* HeapAllocator::allocate()
+{
+	return ::operator new(m_blockSize);
+}
+
+void HeapAllocator::deallocate(void* block)
+{
+	::operator delete(block);
+}
+
+void HeapAllocator::reserve(size_t /*blocks*/)
+{
+	// Nothing to do, blocks are allocated separately
+}
+
+void HeapAllocator::release()
+{
+	// Nothing to do, blocks are deallocated separately
+}
+
+void HeapAllocator::splice(HeapAllocator& /*other*/)
+{
+	// Nothing to do, blocks are not owned by a specific allocator
+}
+
+void HeapAllocator::swap(HeapAllocator& /*other*/)
+{
+	// Nothing to do, blocks are not owned by a specific allocator
+}
@@ -0,0 +1,79 @@
+/**
+ * @file HeapAllocator.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef HEAPALLOCATOR_HPP
+#define HEAPALLOCATOR_HPP
+
+
+#include <cstddef>
+
+
+/**
+ * @class HeapAllocator
+ * Allocator for fixed-size blocks which allocates every block separately on the heap. It can be used as allocator of
+ * List and SList instead of PoolAllocator if nodes should be returned to the heap as soon as they are removed.
+ */
+class HeapAllocator
+{
+private:
+	// Size of a block in bytes
+	size_t m_blockSize;
+
+public:
+	/**
+	 * true if all blocks can be returned at once by calling release, so they don't need to be deallocated one by one.
+	 */
+	static constexpr bool BULK_RELEASE = false;
+
+	/**
+	 * true if blocks can be deallocated by any thread without locking the owner of the allocator.
+	 */
+	static constexpr bool THREAD_SAFE = true;
+
+	/**
+	 * Constructor for instances of the class HeapAllocator.
+	 * @param	blockSize	Size of the blocks in bytes
+	 * @param	alignment	Alignment of the blocks in bytes, it must not exceed the alignment of std::max_align_t
+	 */
+	explicit HeapAllocator(size_t blockSize, size_t alignment = alignof(std::max_align_t));
+
+	/**
+	 * Allocates a block of the size passed to the constructor on the heap.
+	 * @return	Pointer to the block
+	 */
+	void* allocate();
+
+	/**
+	 * Returns a block to the heap.
+	 * @param	block	Block returned by allocate
+	 */
+	void deallocate(void* block);
+
+	/**
+	 * Does nothing, every block is allocated separately.
+	 * @param	blocks	Count of blocks to reserve
+	 */
+	void reserve(size_t blocks);
+
+	/**
+	 * Does nothing, every block has to be deallocated separately.
+	 */
+	void release();
+
+	/**
+	 * Does nothing, blocks allocated by another HeapAllocator can be deallocated by this allocator.
+	 * @param	other	Allocator to take the blocks from
+	 */
+	void splice(HeapAllocator& other);
+
+	/**
+	 * Does nothing, blocks allocated by another HeapAllocator can be deallocated by this allocator.
+	 * @param	other	Allocator to swap with
+	 */
+	void swap(HeapAllocator& other);
+};
+
+
+#endif // #ifndef HEAPALLOCATOR_HPP
@@ -0,0 +1,342 @@
+/**
+ * @file IndexedList.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef INDEXEDLIST_HPP
+#define INDEXEDLIST_HPP
+
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include "List.hpp"
+#include "LockPolicy.hpp"
+#include "PoolAllocator.hpp"
+
+
+/**
+ * @class IdentityKey
+ * Key extractor which uses the element itself as key of an IndexedList.
+ * @tparam	T	Type of the elements of the list
+ */
+template<typename T>
+struct IdentityKey
+{
+	const T& operator()(const T& element) const { return element; }
+};
+
+
+/**
+ * @class BasicIndexedList
+ * A double-linked list class which maintains a hash index from the keys of its elements to their nodes. contains,
+ * count, find and remove take expected constant time per matching element instead of scanning the whole list, while
+ * the elements are still iterated in the order in which they were added. The list is locked by a lock policy like
+ * BasicList: IndexedList doesn't lock at all and IndexedSList locks every method, so the index is searched while the
+ * list is locked for expected constant time. No method is virtual.
+ * The key of an element is extracted by KeyOf, so elements can be indexed by a member, e.g. by the id of a queued
+ * job. Elements can't be changed while they are part of the list since changing them could change their keys.
+ * @tparam	T			Type of the elements of the list
+ * @tparam	Key			Type of the keys of the elements
+ * @tparam	KeyOf		Function object returning the key of an element, IdentityKey (default) uses the element
+ * @tparam	Hash		Function object hashing the keys
+ * @tparam	Allocator	Allocator for the nodes of the list, e.g. PoolAllocator (default) or HeapAllocator
+ * @tparam	LockPolicy	Lock of the list, NoLock (default) or a mutex like Mutex, RWMutex or AdaptiveMutex, see BasicList
+ */
+template<typename T, typename Key = T, typename KeyOf = IdentityKey<T>, typename Hash = std::hash<Key>,
+	typename Allocator = PoolAllocator<>, typename LockPolicy = NoLock>
+class BasicIndexedList
+{
+private:
+	template<typename, typename, typename, typename, typename, typename> friend class BasicIndexedList;
+
+	typedef typename List<T, Allocator>::iterator				iterator;
+	typedef std::unordered_multimap<Key, iterator, Hash>		Index;
+
+	/**
+	 * @class ExclusiveLock
+	 * Locks m_lock exclusively while it exists. m_count is updated before unlocking, also if the locked method throws.
+	 */
+	class ExclusiveLock
+	{
+	private:
+		// List to lock
+		BasicIndexedList*	m_list;
+
+	public:
+		explicit ExclusiveLock(BasicIndexedList* list) : m_list(list) { m_list->m_lock.lock(); }
+		~ExclusiveLock() { m_list->update_count(); m_list->m_lock.unlock(); }
+		ExclusiveLock(const ExclusiveLock&) = delete;
+		ExclusiveLock& operator=(const ExclusiveLock&) = delete;
+	};
+
+	/**
+	 * @class SharedLock
+	 * Locks m_lock in shared mode while it exists.
+	 */
+	class SharedLock
+	{
+	private:
+		// List to lock
+		const BasicIndexedList*	m_list;
+
+	public:
+		explicit SharedLock(const BasicIndexedList* list) : m_list(list) { m_list->m_lock.lock_shared(); }
+		~SharedLock() { m_list->m_lock.unlock_shared(); }
+		SharedLock(const SharedLock&) = delete;
+		SharedLock& operator=(const SharedLock&) = delete;
+	};
+
+	// List containing the elements in the order in which they were added
+	List<T, Allocator>	m_list;
+	// Index from the keys of the elements to their positions in m_list
+	Index				m_index;
+	// Key extractor for the elements
+	KeyOf				m_keyOf;
+	// Lock of the list
+	mutable LockPolicy	m_lock;
+	// Count of elements in the list. It is updated while m_lock is locked exclusively and can be read without locking
+	// m_lock, lists whose lock policy doesn't synchronize don't update it.
+	std::atomic<size_t>	m_count;
+
+	/**
+	 * Updates m_count after the list was changed and informs the lock policy about the change by
+	 * LockPolicyTraits::count_changed. m_lock has to be locked exclusively.
+	 */
+	void update_count();
+
+	/**
+	 * Adds the position of an element to the index. The element is removed from the list again if the index can't be
+	 * extended.
+	 * @param	position	Position of the element in m_list
+	 */
+	void index(iterator position);
+
+	/**
+	 * Removes the position of an element from the index.
+	 * @param	position	Position of the element in m_list
+	 */
+	void unindex(iterator position);
+
+public:
+	/**
+	 * Function pointer to pass to the iterate method for usage as callback function for every element in the list.
+	 * The elements are passed as const references since changing them could change their keys.
+	 */
+	typedef typename List<T, Allocator>::ConstIterationFunction ConstIterationFunction;
+
+	/**
+	 * Default constructor for instances of the class BasicIndexedList.
+	 * @param	keyOf	Key extractor for the elements
+	 * @param	hash	Function object hashing the keys
+	 */
+	explicit BasicIndexedList(const KeyOf& keyOf = KeyOf(), const Hash& hash = Hash());
+
+	/**
+	 * Destructor for instances of the class BasicIndexedList.
+	 */
+	~BasicIndexedList();
+
+	/**
+	 * Returns the count of elements in the list. Synchronized lists return the count at the time of the call without
+	 * locking the list.
+	 * @return	The count of elements in the list
+	 */
+	size_t size() const;
+
+	/**
+	 * Checks if the list is empty (= does not contain any elements). Synchronized lists don't lock the list.
+	 * @return	true if the list is empty, otherwise false
+	 */
+	bool empty() const;
+
+	/**
+	 * Removes all elements from the list.
+	 */
+	void clear();
+
+	/**
+	 * Adds an element to the back of the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_back(const T& element);
+
+	/**
+	 * Adds an element to the back of the list by moving it into the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_back(T&& element);
+
+	/**
+	 * Adds an element to the back of the list which is constructed in place.
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	void emplace_back(Args&&... args);
+
+	/**
+	 * Adds an element to the front of the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_front(const T& element);
+
+	/**
+	 * Adds an element to the front of the list by moving it into the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_front(T&& element);
+
+	/**
+	 * Adds an element to the front of the list which is constructed in place.
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	void emplace_front(Args&&... args);
+
+	/**
+	 * Removes the last element from the list and returns it. The element is moved out of the list.
+	 * @return	The removed last element or a value-initialized element if the list is empty
+	 */
+	T pop_back();
+
+	/**
+	 * Removes the last element from the list if the list is not empty. The element is moved out of the list.
+	 * @param	element	Receives the removed last element, it is left unchanged if the list is empty
+	 * @return			true if an element was removed, false if the list is empty
+	 */
+	bool try_pop_back(T& element);
+
+	/**
+	 * Removes the first element from the list and returns it. The element is moved out of the list.
+	 * @return	The removed first element or a value-initialized element if the list is empty
+	 */
+	T pop_front();
+
+	/**
+	 * Removes the first element from the list if the list is not empty. The element is moved out of the list.
+	 * @param	element	Receives the removed first element, it is left unchanged if the list is empty
+	 * @return			true if an element was removed, false if the list is empty
+	 */
+	bool try_pop_front(T& element);
+
+	/**
+	 * Removes all elements with a given key from the list in expected constant time per removed element.
+	 * @param	key	Key of the elements to remove
+	 * @return		The count of removed elements
+	 */
+	size_t remove(const Key& key);
+
+	/**
+	 * Checks if the list contains an element with a given key in expected constant time. m_lock is locked in shared
+	 * mode.
+	 * @param	key	Key to search for
+	 * @return		true if the list contains an element with the key, otherwise false
+	 */
+	bool contains(const Key& key) const;
+
+	/**
+	 * Returns the count of elements with a given key in expected constant time per matching element. m_lock is locked
+	 * in shared mode.
+	 * @param	key	Key to search for
+	 * @return		The count of elements with the key
+	 */
+	size_t count(const Key& key) const;
+
+	/**
+	 * Copies an element with a given key in expected constant time. If several elements have the key, any of them is
+	 * copied. m_lock is locked in shared mode.
+	 * @param	key		Key to search for
+	 * @param	element	Receives the found element, it is left unchanged if no element has the key
+	 * @return			true if an element was found, otherwise false
+	 */
+	bool find(const Key& key, T& element) const;
+
+	/**
+	 * Iterates from the front to the back of the list using a function pointer as callback function for every element
+	 * in the list. The callback function may return ACTION_REMOVE.
+	 * @param	func		Pointer to a callback function called for every element in the list
+	 * @param	parameter	A user-defined parameter to be passed to the callback function, can be NULL
+	 */
+	void iterate(const ConstIterationFunction& func, void* parameter = nullptr);
+
+	/**
+	 * Iterates from the front to the back of the list without changing it using a function pointer as callback function
+	 * for every element in the list. ACTION_REMOVE is ignored. m_lock is locked in shared mode.
+	 * @param	func		Pointer to a callback function called for every element in the list
+	 * @param	parameter	A user-defined parameter to be passed to the callback function, can be NULL
+	 */
+	void iterate(const ConstIterationFunction& func, void* parameter = nullptr) const;
+
+	/**
+	 * Iterates from the front to the back of the list using a lambda function as callback function for every element
+	 * in the list. The callback lambda function may return ACTION_REMOVE and should have the following signature:
+	 * auto func = [your lambda capture list goes here](const T& element) -> ListInterationAction { your code goes here };
+	 * @param	func	Callback lambda function called for every element in the list. It receives a const reference to
+	 *					the current element as a parameter.
+	 */
+	template<typename Lambda>
+	void iterate(const Lambda& func);
+
+	/**
+	 * Iterates from the front to the back of the list without changing it using a lambda function as callback function
+	 * for every element in the list. ACTION_REMOVE is ignored. m_lock is locked in shared mode. The callback lambda
+	 * function should have the following signature:
+	 * auto func = [your lambda capture list goes here](const T& element) -> ListInterationAction { your code goes here };
+	 * @param	func	Callback lambda function called for every element in the list. It receives a const reference to
+	 *					the current element as a parameter.
+	 */
+	template<typename Lambda>
+	void iterate(const Lambda& func) const;
+
+	/**
+	 * Returns the approximate count of bytes used by the index in addition to the nodes of the list, i.e. the bucket
+	 * array and one entry per element. m_lock is locked in shared mode.
+	 * @return	The approximate memory overhead of the index in bytes
+	 */
+	size_t index_memory() const;
+
+	/**
+	 * Checks if the elements of the list are equal to the elements of another list and if they are sorted in the same
+	 * order. Both lists are locked in shared mode in the order of their addresses. Lists of different sizes are
+	 * unequal without comparing any element.
+	 * @param	other	List to compare to
+	 * @return			true if the lists contain equal elements in the same order, false otherwise
+	 */
+	template<typename OtherLock>
+	bool operator==(const BasicIndexedList<T, Key, KeyOf, Hash, Allocator, OtherLock>& other) const;
+
+	/**
+	 * Checks if the elements of the list are unequal to the elements of another list or if they are sorted in a different
+	 * order. Both lists are locked in shared mode in the order of their addresses.
+	 * @param	other	List to compare to
+	 * @return			true if the lists contain unequal elements or if they are sorted in a different order,
+	 *					false otherwise
+	 */
+	template<typename OtherLock>
+	bool operator!=(const BasicIndexedList<T, Key, KeyOf, Hash, Allocator, OtherLock>& other) const;
+
+	// Instances of BasicIndexedList can't be copied since the index refers to the nodes of the list
+	BasicIndexedList(const BasicIndexedList&) = delete;
+	BasicIndexedList& operator=(const BasicIndexedList&) = delete;
+};
+
+
+/**
+ * An indexed list class which doesn't lock at all. It must not be used by several threads at the same time.
+ * @tparam	T			Type of the elements of the list
+ * @tparam	Key			Type of the keys of the elements
+ * @tparam	KeyOf		Function object returning the key of an element, IdentityKey (default) uses the element
+ * @tparam	Hash		Function object hashing the keys
+ * @tparam	Allocator	Allocator for the nodes of the list, e.g. PoolAllocator (default) or HeapAllocator
+ */
+template<typename T, typename Key = T, typename KeyOf = IdentityKey<T>, typename Hash = std::hash<Key>,
+	typename Allocator = PoolAllocator<>>
+using IndexedList = BasicIndexedList<T, Key, KeyOf, Hash, Allocator, NoLock>;
+
+
+// Include implementation of BasicIndexedList
+#include "IndexedList.tpp"
+
+
+#endif // #ifndef INDEXEDLIST_HPP
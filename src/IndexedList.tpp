@@ -0,0 +1,317 @@
+/**
+ * @file IndexedList.tpp
+ * @date 17.10.2026
+ */
+
+#ifndef INDEXEDLIST_HPP
+#error INDEXEDLIST_HPP undefined
+#endif
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+void BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::update_count()
+{
+	if (LockPolicyTraits<LockPolicy>::SYNCHRONIZED)
+	{
+		size_t before = m_count.load(std::memory_order_relaxed);
+		size_t after = m_list.size();
+		m_count.store(after, std::memory_order_release);
+		if (before != after)
+		{
+			LockPolicyTraits<LockPolicy>::count_changed(m_lock, before, after);
+		}
+	}
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+void BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::index(iterator position)
+{
+	try
+	{
+		m_index.emplace(m_keyOf(*position), position);
+	}
+	catch (...)
+	{
+		m_list.erase(position);
+		throw;
+	}
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+void BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::unindex(iterator position)
+{
+	// Elements with equal keys share a range of the index, search the entry of this node within the range
+	auto range = m_index.equal_range(m_keyOf(*position));
+	for (auto current = range.first; current != range.second; ++current)
+	{
+		if (current->second == position)
+		{
+			m_index.erase(current);
+			return;
+		}
+	}
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::BasicIndexedList(const KeyOf& keyOf, const Hash& hash) : m_list(),
+	m_index(0, hash), m_keyOf(keyOf), m_lock(), m_count(0)
+{
+	// Nothing to do yet
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::~BasicIndexedList()
+{
+	// Nothing to do yet
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+size_t BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::size() const
+{
+	if (LockPolicyTraits<LockPolicy>::SYNCHRONIZED)
+	{
+		return m_count.load(std::memory_order_acquire);
+	}
+	return m_list.size();
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+bool BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::empty() const
+{
+	return 0 == size();
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+void BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::clear()
+{
+	ExclusiveLock lock(this);
+	m_index.clear();
+	m_list.clear();
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+void BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::push_back(const T& element)
+{
+	ExclusiveLock lock(this);
+	m_list.push_back(element);
+	index(--m_list.end());
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+void BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::push_back(T&& element)
+{
+	ExclusiveLock lock(this);
+	m_list.push_back(std::move(element));
+	index(--m_list.end());
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+template<typename... Args>
+void BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::emplace_back(Args&&... args)
+{
+	ExclusiveLock lock(this);
+	m_list.emplace_back(std::forward<Args>(args)...);
+	index(--m_list.end());
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+void BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::push_front(const T& element)
+{
+	ExclusiveLock lock(this);
+	m_list.push_front(element);
+	index(m_list.begin());
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+void BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::push_front(T&& element)
+{
+	ExclusiveLock lock(this);
+	m_list.push_front(std::move(element));
+	index(m_list.begin());
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+template<typename... Args>
+void BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::emplace_front(Args&&... args)
+{
+	ExclusiveLock lock(this);
+	m_list.emplace_front(std::forward<Args>(args)...);
+	index(m_list.begin());
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+T BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::pop_back()
+{
+	T element = T();
+	try_pop_back(element);
+	return element;
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+bool BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::try_pop_back(T& element)
+{
+	ExclusiveLock lock(this);
+	if (m_list.empty())
+	{
+		return false;
+	}
+	unindex(--m_list.end());
+	return m_list.try_pop_back(element);
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+T BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::pop_front()
+{
+	T element = T();
+	try_pop_front(element);
+	return element;
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+bool BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::try_pop_front(T& element)
+{
+	ExclusiveLock lock(this);
+	if (m_list.empty())
+	{
+		return false;
+	}
+	unindex(m_list.begin());
+	return m_list.try_pop_front(element);
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+size_t BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::remove(const Key& key)
+{
+	ExclusiveLock lock(this);
+	auto range = m_index.equal_range(key);
+	size_t count = 0;
+	for (auto current = range.first; current != range.second; ++current)
+	{
+		m_list.erase(current->second);
+		count++;
+	}
+	m_index.erase(range.first, range.second);
+	return count;
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+bool BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::contains(const Key& key) const
+{
+	SharedLock lock(this);
+	return m_index.end() != m_index.find(key);
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+size_t BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::count(const Key& key) const
+{
+	SharedLock lock(this);
+	return m_index.count(key);
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+bool BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::find(const Key& key, T& element) const
+{
+	SharedLock lock(this);
+	auto found = m_index.find(key);
+	if (m_index.end() == found)
+	{
+		return false;
+	}
+	element = *found->second;
+	return true;
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+void BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::iterate(const ConstIterationFunction& func, void* parameter)
+{
+	auto callFunction = [&func, parameter](const T& element) -> ListIterationAction
+	{
+		return func(element, parameter);
+	};
+	iterate(callFunction);
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+void BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::iterate(const ConstIterationFunction& func, void* parameter) const
+{
+	SharedLock lock(this);
+	m_list.iterate(func, parameter);
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+template<typename Lambda>
+void BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::iterate(const Lambda& func)
+{
+	ExclusiveLock lock(this);
+	iterator current = m_list.begin();
+	while (m_list.end() != current)
+	{
+		ListIterationAction action = func(static_cast<const T&>(*current));
+		if (action & ListIterationAction::ACTION_REMOVE)
+		{
+			unindex(current);
+			current = m_list.erase(current);
+		}
+		else
+		{
+			++current;
+		}
+
+		if (action & ListIterationAction::ACTION_BREAK)
+		{
+			break;
+		}
+	}
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+template<typename Lambda>
+void BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::iterate(const Lambda& func) const
+{
+	SharedLock lock(this);
+	m_list.iterate(func);
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+size_t BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::index_memory() const
+{
+	SharedLock lock(this);
+	// Every entry is a node of the hash table containing the key, the iterator, the next pointer and the cached hash
+	return m_index.bucket_count() * sizeof(void*) +
+		m_index.size() * (sizeof(typename Index::value_type) + sizeof(void*) + sizeof(size_t));
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+bool BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::operator==(const BasicIndexedList<T, Key, KeyOf, Hash, Allocator, OtherLock>& other) const
+{
+	if (static_cast<const void*>(this) == static_cast<const void*>(&other))
+	{
+		return true;
+	}
+
+	// Lock both lists in the order of their addresses, so threads comparing the same two lists can't deadlock
+	bool otherFirst = std::less<const void*>()(&other, this);
+	otherFirst ? other.m_lock.lock_shared() : m_lock.lock_shared();
+	otherFirst ? m_lock.lock_shared() : other.m_lock.lock_shared();
+	bool ret = false;
+	try
+	{
+		ret = m_list == other.m_list;
+	}
+	catch (...)
+	{
+		m_lock.unlock_shared();
+		other.m_lock.unlock_shared();
+		throw;
+	}
+	m_lock.unlock_shared();
+	other.m_lock.unlock_shared();
+	return ret;
+}
+
+template<typename T, typename Key, typename KeyOf, typename Hash, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+bool BasicIndexedList<T, Key, KeyOf, Hash, Allocator, LockPolicy>::operator!=(const BasicIndexedList<T, Key, KeyOf, Hash, Allocator, OtherLock>& other) const
+{
+	return !operator==(other);
+}
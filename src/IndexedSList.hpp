@@ -0,0 +1,31 @@
+/**
+ * @file IndexedSList.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef INDEXEDSLIST_HPP
+#define INDEXEDSLIST_HPP
+
+
+#include "IndexedList.hpp"
+#include "Mutex.hpp"
+
+
+/**
+ * A thread-safe indexed list class. It provides the same methods as IndexedList, so contains, count, find and remove
+ * keep the list locked for expected constant time instead of scanning the whole list. IndexedSList is a
+ * BasicIndexedList whose lock policy is a mutex, so every method locks the list, including the lambda iterate methods,
+ * and size() and empty() don't lock the list.
+ * @tparam	T			Type of the elements of the list
+ * @tparam	Key			Type of the keys of the elements
+ * @tparam	KeyOf		Function object returning the key of an element, IdentityKey (default) uses the element
+ * @tparam	Hash		Function object hashing the keys
+ * @tparam	Allocator	Allocator for the nodes of the list, e.g. PoolAllocator (default) or HeapAllocator
+ * @tparam	MutexType	Mutex used to lock the list, e.g. Mutex (default), RWMutex or AdaptiveMutex
+ */
+template<typename T, typename Key = T, typename KeyOf = IdentityKey<T>, typename Hash = std::hash<Key>,
+	typename Allocator = PoolAllocator<>, typename MutexType = Mutex>
+using IndexedSList = BasicIndexedList<T, Key, KeyOf, Hash, Allocator, MutexType>;
+
+
+#endif // #ifndef INDEXEDSLIST_HPP
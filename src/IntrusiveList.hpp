@@ -0,0 +1,287 @@
+/**
+ * @file IntrusiveList.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef INTRUSIVELIST_HPP
+#define INTRUSIVELIST_HPP
+
+
+#include <atomic>
+#include <cstddef>
+#include "List.hpp"
+#include "LockPolicy.hpp"
+
+
+/**
+ * @class IntrusiveListHook
+ * Links of an element of an IntrusiveList. Classes whose instances are added to an IntrusiveList contain one hook per
+ * list they can be part of at the same time, e.g.
+ * struct Message { IntrusiveListHook<Message> m_hook; ... }; IntrusiveList<Message, &Message::m_hook> list;
+ * @tparam	T	Type of the class containing the hook
+ */
+template<typename T>
+struct IntrusiveListHook
+{
+	// Previous element of the list
+	T*			m_prev;
+	// Next element of the list
+	T*			m_next;
+	// List the element is part of, nullptr if the element is not part of any list
+	const void*	m_list;
+
+	IntrusiveListHook() : m_prev(nullptr), m_next(nullptr), m_list(nullptr) {}
+
+	// Copies of an element are not part of the list of the original element
+	IntrusiveListHook(const IntrusiveListHook&) : m_prev(nullptr), m_next(nullptr), m_list(nullptr) {}
+	IntrusiveListHook& operator=(const IntrusiveListHook&) { return *this; }
+
+	/**
+	 * Checks if the element of the hook is part of a list.
+	 * @return	true if the element is part of a list, otherwise false
+	 */
+	bool is_linked() const { return nullptr != m_list; }
+};
+
+
+/**
+ * @class BasicIntrusiveList
+ * A double-linked list class which stores its links inside of the elements (intrusive list). Adding and removing
+ * elements only relinks pointers, nothing is allocated or copied, and an element known to the caller can be removed in
+ * constant time. The list is locked by a lock policy like BasicList: IntrusiveList doesn't lock at all and
+ * IntrusiveSList locks every method, including the lambda iterate methods. No method is virtual.
+ * The list doesn't own its elements, it only refers to them. Elements must stay alive as long as they are part of
+ * the list and they are unlinked but not destroyed when they are removed from the list or when the list is destroyed.
+ * An element can only be part of one list per hook.
+ * @tparam	T			Type of the elements of the list
+ * @tparam	Hook		Member of T which stores the links of the element
+ * @tparam	LockPolicy	Lock of the list, NoLock (default) or a mutex like Mutex, RWMutex or AdaptiveMutex, see BasicList
+ */
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy = NoLock>
+class BasicIntrusiveList
+{
+private:
+	/**
+	 * @class ExclusiveLock
+	 * Locks m_lock exclusively while it exists. m_count is updated before unlocking, also if the locked method throws.
+	 */
+	class ExclusiveLock
+	{
+	private:
+		// List to lock
+		BasicIntrusiveList*	m_list;
+
+	public:
+		explicit ExclusiveLock(BasicIntrusiveList* list) : m_list(list) { m_list->m_lock.lock(); }
+		~ExclusiveLock() { m_list->update_count(); m_list->m_lock.unlock(); }
+		ExclusiveLock(const ExclusiveLock&) = delete;
+		ExclusiveLock& operator=(const ExclusiveLock&) = delete;
+	};
+
+	/**
+	 * @class SharedLock
+	 * Locks m_lock in shared mode while it exists.
+	 */
+	class SharedLock
+	{
+	private:
+		// List to lock
+		const BasicIntrusiveList*	m_list;
+
+	public:
+		explicit SharedLock(const BasicIntrusiveList* list) : m_list(list) { m_list->m_lock.lock_shared(); }
+		~SharedLock() { m_list->m_lock.unlock_shared(); }
+		SharedLock(const SharedLock&) = delete;
+		SharedLock& operator=(const SharedLock&) = delete;
+	};
+
+	// First element of the list
+	T*		m_first;
+	// Last element of the list
+	T*		m_last;
+	// Count of elements in the list
+	size_t	m_size;
+	// Lock of the list
+	mutable LockPolicy	m_lock;
+	// Count of elements in the list. It is updated while m_lock is locked exclusively and can be read without locking
+	// m_lock, lists whose lock policy doesn't synchronize don't update it.
+	std::atomic<size_t>	m_count;
+
+	/**
+	 * Returns the hook of an element.
+	 * @param	element	Element to return the hook of
+	 * @return			The hook of the element
+	 */
+	static IntrusiveListHook<T>& hook(T& element) { return element.*Hook; }
+
+	/**
+	 * Returns the hook of an element.
+	 * @param	element	Element to return the hook of
+	 * @return			The hook of the element
+	 */
+	static const IntrusiveListHook<T>& hook(const T& element) { return element.*Hook; }
+
+	/**
+	 * Updates m_count after the list was changed and informs the lock policy about the change by
+	 * LockPolicyTraits::count_changed. m_lock has to be locked exclusively.
+	 */
+	void update_count();
+
+	/**
+	 * Unlinks an element of the list and resets its hook.
+	 * @param	element	Element to unlink, it has to be part of the list
+	 */
+	void unlink(T& element);
+
+	/**
+	 * Unlinks all elements from the list without destroying them. m_lock has to be locked exclusively.
+	 */
+	void unlink_all();
+
+public:
+	/**
+	 * Function pointer to pass to the iterate method for usage as callback function for every element in the list.
+	 */
+	typedef ListIterationAction (*IterationFunction)(T& element, void* parameter);
+
+	/**
+	 * Function pointer to pass to the read-only iterate method for usage as callback function for every element in the
+	 * list. ACTION_REMOVE is ignored.
+	 */
+	typedef ListIterationAction (*ConstIterationFunction)(const T& element, void* parameter);
+
+	/**
+	 * Default constructor for instances of the class BasicIntrusiveList.
+	 */
+	BasicIntrusiveList();
+
+	/**
+	 * Destructor for instances of the class BasicIntrusiveList. Unlinks all elements without destroying them.
+	 */
+	~BasicIntrusiveList();
+
+	/**
+	 * Returns the count of elements in the list. Synchronized lists return the count at the time of the call without
+	 * locking the list.
+	 * @return	The count of elements in the list
+	 */
+	size_t size() const;
+
+	/**
+	 * Checks if the list is empty (= does not contain any elements). Synchronized lists don't lock the list.
+	 * @return	true if the list is empty, otherwise false
+	 */
+	bool empty() const;
+
+	/**
+	 * Unlinks all elements from the list without destroying them.
+	 */
+	void clear();
+
+	/**
+	 * Links an element to the back of the list.
+	 * @param	element	Element to add to the list
+	 * @return			true if the element was added, false if it is part of a list already
+	 */
+	bool push_back(T& element);
+
+	/**
+	 * Links an element to the front of the list.
+	 * @param	element	Element to add to the list
+	 * @return			true if the element was added, false if it is part of a list already
+	 */
+	bool push_front(T& element);
+
+	/**
+	 * Unlinks the last element from the list and returns it.
+	 * @return	The removed last element or nullptr if the list is empty
+	 */
+	T* pop_back();
+
+	/**
+	 * Unlinks the first element from the list and returns it.
+	 * @return	The removed first element or nullptr if the list is empty
+	 */
+	T* pop_front();
+
+	/**
+	 * Unlinks an element from the list in constant time.
+	 * @param	element	Element to remove from the list
+	 * @return			true if the element was removed, false if it is not part of the list
+	 */
+	bool remove(T& element);
+
+	/**
+	 * Checks if an element is part of the list in constant time. m_lock is locked in shared mode.
+	 * @param	element	Element to search for
+	 * @return			true if the element is part of the list, otherwise false
+	 */
+	bool contains(const T& element) const;
+
+	/**
+	 * Iterates from the front to the back of the list using a function pointer as callback function for every element
+	 * in the list. Elements for which the callback function returns ACTION_REMOVE are unlinked.
+	 * @param	func		Pointer to a callback function called for every element in the list
+	 * @param	parameter	A user-defined parameter to be passed to the callback function, can be NULL
+	 */
+	void iterate(const IterationFunction& func, void* parameter = nullptr);
+
+	/**
+	 * Iterates from the front to the back of the list without changing it using a function pointer as callback function
+	 * for every element in the list. m_lock is locked in shared mode.
+	 * @param	func		Pointer to a callback function called for every element in the list
+	 * @param	parameter	A user-defined parameter to be passed to the callback function, can be NULL
+	 */
+	void iterate(const ConstIterationFunction& func, void* parameter = nullptr) const;
+
+	/**
+	 * Iterates a non-const list without changing it using a function pointer as callback function for every element in
+	 * the list, like the const overload. Without it a ConstIterationFunction passed without parameter would be taken
+	 * for a lambda function.
+	 * @param	func		Pointer to a callback function called for every element in the list
+	 * @param	parameter	A user-defined parameter to be passed to the callback function, can be NULL
+	 */
+	void iterate(const ConstIterationFunction& func, void* parameter = nullptr);
+
+	/**
+	 * Iterates from the front to the back of the list using a lambda function as callback function for every element
+	 * in the list. Elements for which the callback function returns ACTION_REMOVE are unlinked. The callback lambda
+	 * function should have the following signature:
+	 * auto func = [your lambda capture list goes here](T& element) -> ListInterationAction { your code goes here };
+	 * @param	func	Callback lambda function called for every element in the list. It receives a reference to the
+	 *					current element as a parameter.
+	 */
+	template<typename Lambda>
+	void iterate(const Lambda& func);
+
+	/**
+	 * Iterates from the front to the back of the list without changing it using a lambda function as callback function
+	 * for every element in the list. ACTION_REMOVE is ignored. m_lock is locked in shared mode. The callback lambda
+	 * function should have the following signature:
+	 * auto func = [your lambda capture list goes here](const T& element) -> ListInterationAction { your code goes here };
+	 * @param	func	Callback lambda function called for every element in the list. It receives a const reference to
+	 *					the current element as a parameter.
+	 */
+	template<typename Lambda>
+	void iterate(const Lambda& func) const;
+
+	// Instances of BasicIntrusiveList can't be copied since every element stores the list it is part of
+	BasicIntrusiveList(const BasicIntrusiveList&) = delete;
+	BasicIntrusiveList& operator=(const BasicIntrusiveList&) = delete;
+};
+
+
+/**
+ * An intrusive list class which doesn't lock at all. It must not be used by several threads at the same time.
+ * @tparam	T		Type of the elements of the list
+ * @tparam	Hook	Member of T which stores the links of the element
+ */
+template<typename T, IntrusiveListHook<T> T::*Hook>
+using IntrusiveList = BasicIntrusiveList<T, Hook, NoLock>;
+
+
+// Include implementation of BasicIntrusiveList
+#include "IntrusiveList.tpp"
+
+
+#endif // #ifndef INTRUSIVELIST_HPP
@@ -0,0 +1,267 @@
+/**
+ * @file IntrusiveList.tpp
+ * @date 17.10.2026
+ */
+
+#ifndef INTRUSIVELIST_HPP
+#error INTRUSIVELIST_HPP undefined
+#endif
+
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy>
+void BasicIntrusiveList<T, Hook, LockPolicy>::update_count()
+{
+	if (LockPolicyTraits<LockPolicy>::SYNCHRONIZED)
+	{
+		size_t before = m_count.load(std::memory_order_relaxed);
+		m_count.store(m_size, std::memory_order_release);
+		if (before != m_size)
+		{
+			LockPolicyTraits<LockPolicy>::count_changed(m_lock, before, m_size);
+		}
+	}
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy>
+void BasicIntrusiveList<T, Hook, LockPolicy>::unlink(T& element)
+{
+	IntrusiveListHook<T>& links = hook(element);
+	if (links.m_prev)
+	{
+		hook(*links.m_prev).m_next = links.m_next;
+	}
+	else
+	{
+		// element is m_first, set new m_first to its next element
+		m_first = links.m_next;
+	}
+
+	if (links.m_next)
+	{
+		hook(*links.m_next).m_prev = links.m_prev;
+	}
+	else
+	{
+		// element is m_last, set new m_last to its previous element
+		m_last = links.m_prev;
+	}
+
+	links.m_prev = nullptr;
+	links.m_next = nullptr;
+	links.m_list = nullptr;
+	m_size--;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy>
+void BasicIntrusiveList<T, Hook, LockPolicy>::unlink_all()
+{
+	T* current = m_first;
+	while (current)
+	{
+		IntrusiveListHook<T>& links = hook(*current);
+		T* next = links.m_next;
+		links.m_prev = nullptr;
+		links.m_next = nullptr;
+		links.m_list = nullptr;
+		current = next;
+	}
+	m_first = nullptr;
+	m_last = nullptr;
+	m_size = 0;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy>
+BasicIntrusiveList<T, Hook, LockPolicy>::BasicIntrusiveList() : m_first(nullptr), m_last(nullptr), m_size(0), m_lock(), m_count(0)
+{
+	// Nothing to do yet
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy>
+BasicIntrusiveList<T, Hook, LockPolicy>::~BasicIntrusiveList()
+{
+	unlink_all();
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy>
+size_t BasicIntrusiveList<T, Hook, LockPolicy>::size() const
+{
+	if (LockPolicyTraits<LockPolicy>::SYNCHRONIZED)
+	{
+		return m_count.load(std::memory_order_acquire);
+	}
+	return m_size;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy>
+bool BasicIntrusiveList<T, Hook, LockPolicy>::empty() const
+{
+	return 0 == size();
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy>
+void BasicIntrusiveList<T, Hook, LockPolicy>::clear()
+{
+	ExclusiveLock lock(this);
+	unlink_all();
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy>
+bool BasicIntrusiveList<T, Hook, LockPolicy>::push_back(T& element)
+{
+	ExclusiveLock lock(this);
+	IntrusiveListHook<T>& links = hook(element);
+	if (links.is_linked())
+	{
+		return false;
+	}
+
+	links.m_prev = m_last;
+	links.m_next = nullptr;
+	links.m_list = this;
+	if (m_last)
+	{
+		// List is not empty
+		hook(*m_last).m_next = &element;
+	}
+	else
+	{
+		// List is empty
+		m_first = &element;
+	}
+	m_last = &element;
+	m_size++;
+	return true;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy>
+bool BasicIntrusiveList<T, Hook, LockPolicy>::push_front(T& element)
+{
+	ExclusiveLock lock(this);
+	IntrusiveListHook<T>& links = hook(element);
+	if (links.is_linked())
+	{
+		return false;
+	}
+
+	links.m_prev = nullptr;
+	links.m_next = m_first;
+	links.m_list = this;
+	if (m_first)
+	{
+		// List is not empty
+		hook(*m_first).m_prev = &element;
+	}
+	else
+	{
+		// List is empty
+		m_last = &element;
+	}
+	m_first = &element;
+	m_size++;
+	return true;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy>
+T* BasicIntrusiveList<T, Hook, LockPolicy>::pop_back()
+{
+	ExclusiveLock lock(this);
+	T* element = m_last;
+	if (element)
+	{
+		unlink(*element);
+	}
+	return element;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy>
+T* BasicIntrusiveList<T, Hook, LockPolicy>::pop_front()
+{
+	ExclusiveLock lock(this);
+	T* element = m_first;
+	if (element)
+	{
+		unlink(*element);
+	}
+	return element;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy>
+bool BasicIntrusiveList<T, Hook, LockPolicy>::remove(T& element)
+{
+	ExclusiveLock lock(this);
+	if (this != hook(element).m_list)
+	{
+		return false;
+	}
+	unlink(element);
+	return true;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy>
+bool BasicIntrusiveList<T, Hook, LockPolicy>::contains(const T& element) const
+{
+	SharedLock lock(this);
+	return this == hook(element).m_list;
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy>
+void BasicIntrusiveList<T, Hook, LockPolicy>::iterate(const IterationFunction& func, void* parameter)
+{
+	auto callFunction = [&func, parameter](T& element) -> ListIterationAction
+	{
+		return func(element, parameter);
+	};
+	iterate(callFunction);
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy>
+void BasicIntrusiveList<T, Hook, LockPolicy>::iterate(const ConstIterationFunction& func, void* parameter) const
+{
+	auto callFunction = [&func, parameter](const T& element) -> ListIterationAction
+	{
+		return func(element, parameter);
+	};
+	iterate(callFunction);
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy>
+void BasicIntrusiveList<T, Hook, LockPolicy>::iterate(const ConstIterationFunction& func, void* parameter)
+{
+	static_cast<const BasicIntrusiveList*>(this)->iterate(func, parameter);
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy>
+template<typename Lambda>
+void BasicIntrusiveList<T, Hook, LockPolicy>::iterate(const Lambda& func)
+{
+	ExclusiveLock lock(this);
+	T* current = m_first;
+	while (current)
+	{
+		// Get the next element before the current element is unlinked
+		T* next = hook(*current).m_next;
+		ListIterationAction action = func(*current);
+		if (action & ListIterationAction::ACTION_REMOVE)
+		{
+			unlink(*current);
+		}
+		if (action & ListIterationAction::ACTION_BREAK)
+		{
+			break;
+		}
+		current = next;
+	}
+}
+
+template<typename T, IntrusiveListHook<T> T::*Hook, typename LockPolicy>
+template<typename Lambda>
+void BasicIntrusiveList<T, Hook, LockPolicy>::iterate(const Lambda& func) const
+{
+	SharedLock lock(this);
+	for (const T* current = m_first; current; current = hook(*current).m_next)
+	{
+		if (func(*current) & ListIterationAction::ACTION_BREAK)
+		{
+			break;
+		}
+	}
+}
@@ -0,0 +1,29 @@
+/**
+ * @file IntrusiveSList.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef INTRUSIVESLIST_HPP
+#define INTRUSIVESLIST_HPP
+
+
+#include "IntrusiveList.hpp"
+#include "Mutex.hpp"
+
+
+/**
+ * A thread-safe intrusive list class. It provides the same methods as IntrusiveList, so the list is only locked for
+ * relinking a few pointers and never while allocating memory or copying elements. IntrusiveSList is a
+ * BasicIntrusiveList whose lock policy is a mutex, so every method locks the list, including the lambda iterate
+ * methods, and size() and empty() don't lock the list.
+ * IMPORTANT: remove and contains read the hook of the element while only this list is locked, so don't add the same
+ * element to another list using the same hook at the same time.
+ * @tparam	T			Type of the elements of the list
+ * @tparam	Hook		Member of T which stores the links of the element
+ * @tparam	MutexType	Mutex used to lock the list, e.g. Mutex (default), RWMutex or AdaptiveMutex
+ */
+template<typename T, IntrusiveListHook<T> T::*Hook, typename MutexType = Mutex>
+using IntrusiveSList = BasicIntrusiveList<T, Hook, MutexType>;
+
+
+#endif // #ifndef INTRUSIVESLIST_HPP
@@ -8,6 +8,19 @@
 #define LIST_HPP
 
 
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "ListFile.hpp"
+#include "ListStatistics.hpp"
+#include "LockPolicy.hpp"
+#include "PoolAllocator.hpp"
+
 /**
  * @enum ListIterationAction
  * Actions for the lists iterate methods after a callback function was called for the current element of the iteration.
@@ -28,34 +41,84 @@ enum ListIterationAction : unsigned char
 
 
 /**
- * @class List
- * A double-linked list class. It provides methods similar to the class std::list of the STL.
- * IMPORTANT: Do not declare methods that you want to override in the derived class SList as const. It would change the
- * methods signature and therefore break the inheritance. The derived class SList does change its state on every function call.
+ * @class ListNode
+ * Class for nodes of BasicList. They contain the actual elements of the list as well as pointers to the previous and
+ * next nodes in the list.
+ * @tparam	T	Type of the element of the node
  */
 template<typename T>
-class List
+struct ListNode
+{
+	// Previous node of the list
+	ListNode*	m_prev;
+	// Next node of the list
+	ListNode*	m_next;
+	// Element of the node
+	T			m_element;
+
+	/**
+	 * Constructor for instances of the class ListNode. The element is constructed in place.
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	ListNode(Args&&... args) : m_prev(nullptr), m_next(nullptr), m_element(std::forward<Args>(args)...) {}
+};
+
+
+/**
+ * @class BasicList
+ * A double-linked list class. It provides methods similar to the class std::list of the STL. How the list is locked is
+ * chosen at compile time by a lock policy: List doesn't lock at all and SList locks every method. No method is virtual,
+ * so calls can be inlined and the locking of a List compiles to nothing. The methods taking another list accept lists
+ * with any lock policy, e.g. an SList can be compared to or constructed from a List.
+ * Synchronized lists only unlink the nodes removed by clear, remove, unique and iterate while the list is locked and
+ * destroy them after unlocking it, so the lock is held for relinking nodes only and not for running destructors of the
+ * elements or freeing memory. With a thread-safe allocator like CachingAllocator new nodes are created before locking
+ * the list as well.
+ * The elements can be saved to a binary file and loaded back (see ListFile.hpp). Trivially copyable elements are stored
+ * as one contiguous block, loading maps the file into memory and carves all nodes out of a single allocation.
+ * If SLIST_INSTRUMENTATION is defined (CMake option SLIST_INSTRUMENTATION), every synchronized list counts its
+ * operations, lock acquisitions, contended acquisitions, wait and hold times and its peak size, see statistics().
+ * Otherwise, and always for a List, the list calls its lock policy directly without any overhead.
+ * @tparam	T			Type of the elements of the list
+ * @tparam	Allocator	Allocator for the nodes of the list, e.g. PoolAllocator (default) or HeapAllocator. Every list
+ *						owns its own instance of the allocator.
+ * @tparam	LockPolicy	Lock of the list. NoLock (default) doesn't lock at all, the list must not be used by several
+ *						threads at the same time. Mutex locks the list exclusively for every method. RWMutex locks the
+ *						list in shared mode for read-only methods, so they can be called by several threads at the same
+ *						time. AdaptiveMutex spins briefly before blocking. RWMutex and AdaptiveMutex are not recursive,
+ *						so the callback functions of the iterate methods must not call methods of the same list when
+ *						using them.
+ */
+template<typename T, typename Allocator = PoolAllocator<>, typename LockPolicy = NoLock>
+class BasicList
 {
 private:
+	template<typename, typename, typename> friend class BasicList;
+
+	// Nodes don't depend on the lock policy, so lists with different lock policies can exchange their nodes
+	typedef ListNode<T> Node;
+
+	// true if removed nodes are destroyed after unlocking m_lock. Synchronized lists defer the destruction if the
+	// elements have to be destructed or if the allocator can free the nodes without locking m_lock.
+	static const bool DEFER_DESTRUCTION = LockPolicyTraits<LockPolicy>::SYNCHRONIZED &&
+		(Allocator::THREAD_SAFE || !std::is_trivially_destructible<T>::value);
+	// true if nodes are created before locking m_lock, which requires an allocator which is thread-safe
+	static const bool ALLOCATE_UNLOCKED = LockPolicyTraits<LockPolicy>::SYNCHRONIZED && Allocator::THREAD_SAFE;
+	// Size in bytes of the chunks of elements synchronized lists copy while saving
+	static const size_t SAVE_CHUNK_SIZE = 1 << 16;
+
 	/**
-	 * @class Node
-	 * Class for nodes of the list. They contain the actual elements of the list as well as pointers to the previous
-	 * and next nodes in the list.
+	 * @class SaveCursor
+	 * Position of a save of a synchronized list. Unlinking a node moves the cursors pointing to it to the next node, so
+	 * saving continues behind the written elements even if other threads removed elements in between.
 	 */
-	struct Node
+	struct SaveCursor
 	{
-		// Previous node of the list
-		Node*	m_prev;
-		// Next node of the list
-		Node*	m_next;
-		// Element of the node
-		T		m_element;
-
-		/**
-		 * Constructor for instances of the class Node.
-		 * @param	element	Element of the node
-		 */
-		Node(const T& element) : m_prev(nullptr), m_next(nullptr), m_element(element) {}
+		// Next node to write, nullptr if the save reached the end of the list
+		const Node*	m_node;
+		// Next cursor of the list
+		SaveCursor*	m_next;
 	};
 
 	// First node of the list
@@ -64,6 +127,85 @@ private:
 	Node*	m_last;
 	// Count of elements in the list
 	size_t	m_size;
+	// Allocator for the nodes of the list
+	Allocator	m_allocator;
+	// Count of threads destroying removed nodes after unlocking m_lock whose memory still belongs to m_allocator. The
+	// memory of the allocator must not be released or passed to another list before they finished.
+	std::atomic<size_t>	m_reclaimers;
+	// Memory of nodes destroyed after unlocking m_lock which still has to be returned to m_allocator, the blocks are
+	// linked by their first pointer. It is only used if the allocator is not thread-safe.
+	std::atomic<void*>	m_destroyed;
+	// Cursors of the saves running on the list. Cursors are added, removed and moved by other methods only while m_lock
+	// is locked exclusively, every save moves its own cursor while m_lock is locked in shared mode.
+	mutable SaveCursor*	m_cursors;
+
+	/**
+	 * Allocates and constructs a new node.
+	 * @param	args	Arguments passed to the constructor of the element of the node
+	 * @return			The new node
+	 */
+	template<typename... Args>
+	Node* create_node(Args&&... args);
+
+	/**
+	 * Destructs a node and returns it to the allocator.
+	 * @param	node	Node to destroy
+	 */
+	void destroy_node(Node* node);
+
+	/**
+	 * Adds a node to the back of the list.
+	 * @param	node	Node to add to the list
+	 */
+	void link_back(Node* node);
+
+	/**
+	 * Locks the list and adds a new element to its back or front. If ALLOCATE_UNLOCKED is true, the node is created
+	 * before locking the list.
+	 * @param	back	true to add the element to the back of the list, false to add it to the front
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	void push(bool back, Args&&... args);
+
+	/**
+	 * Adds a node to the front of the list.
+	 * @param	node	Node to add to the list
+	 */
+	void link_front(Node* node);
+
+	/**
+	 * Takes over the nodes of another list in constant time. The list has to be empty, the other list is empty
+	 * afterwards.
+	 * @param	other	List to take the nodes from
+	 */
+	template<typename OtherLock>
+	void take(BasicList<T, Allocator, OtherLock>& other);
+
+	/**
+	 * Unlinks a node from the list without destroying it.
+	 * @param	node	Node to unlink
+	 */
+	void unlink(Node* node);
+
+	/**
+	 * Moves the save cursors pointing to a node which is unlinked to the next node. m_lock has to be locked
+	 * exclusively.
+	 * @param	node	Node which is unlinked
+	 */
+	void skip_cursors(const Node* node);
+
+	/**
+	 * Moves all save cursors to the end of the list when all of its nodes are taken or destroyed at once. m_lock has to
+	 * be locked exclusively.
+	 */
+	void end_cursors();
+
+	/**
+	 * Locks m_lock exclusively and removes the cursor of a save which finished.
+	 * @param	cursor	Cursor to remove
+	 */
+	void remove_cursor(SaveCursor* cursor) const;
 
 	/**
 	 * Removes a node from the list.
@@ -71,11 +213,45 @@ private:
 	 */
 	void remove(Node* node);
 
+	/**
+	 * Removes a node from the list whose destruction may be deferred until m_lock is unlocked. If DEFER_DESTRUCTION is
+	 * true, the node is added to a chain of retired nodes which has to be passed to reclaim after unlocking m_lock,
+	 * otherwise it is destroyed immediately.
+	 * @param	node	Node to remove from the list
+	 * @param	retired	Chain of retired nodes linked by m_next, nullptr before the first node is retired
+	 */
+	void retire(Node* node, Node*& retired);
+
+	/**
+	 * Destroys a chain of retired nodes after m_lock was unlocked. Allocators which are not thread-safe get the memory
+	 * of the nodes back the next time m_lock is locked for adding an element or releasing memory.
+	 * @param	retired	Chain of retired nodes, may be nullptr
+	 */
+	void reclaim(Node* retired);
+
+	/**
+	 * Returns the memory of nodes destroyed by reclaim to the allocator. m_lock has to be locked exclusively.
+	 */
+	void drain();
+
+	/**
+	 * Waits until no thread destroys retired nodes of the list anymore and returns their memory to the allocator.
+	 * Called while m_lock is locked exclusively before the memory of the allocator is released or passed to another
+	 * list.
+	 */
+	void quiesce();
+
+	/**
+	 * Removes all elements from the list without locking it.
+	 */
+	void destroy_nodes();
+
 	/**
 	 * Clears the list and creates a deep copy of another list.
 	 * @param	other	List to copy
 	 */
-	void copy(const List<T>& other);
+	template<typename OtherLock>
+	void copy(const BasicList<T, Allocator, OtherLock>& other);
 
 	/**
 	 * Clears the list and adds the values of an array to the list.
@@ -90,78 +266,574 @@ private:
 	 * @param	other	List to compare to
 	 * @return			true if the lists contain equal elements in the same order, false otherwise
 	 */
-	bool equals(const List<T>& other) const;
+	template<typename OtherLock>
+	bool equals(const BasicList<T, Allocator, OtherLock>& other) const;
+
+	/**
+	 * Calls a callback function for every element without locking the list. Elements for which the callback function
+	 * returns ACTION_REMOVE are retired.
+	 * @param	func	Callback function called for every element in the list
+	 * @param	retired	Chain of retired nodes, see retire
+	 */
+	template<typename Lambda>
+	void iterate_nodes(const Lambda& func, Node*& retired);
+
+	/**
+	 * Calls a callback function for every element without locking or changing the list.
+	 * @param	func	Callback function called for every element in the list
+	 */
+	template<typename Lambda>
+	void iterate_nodes(const Lambda& func) const;
+
+	/**
+	 * Merges two sorted chains of nodes linked by m_next only. Elements of the first chain precede equal elements of
+	 * the second chain. If the comparison throws, the first chain contains all nodes in an unspecified order.
+	 * @param	first	First chain of nodes, receives the merged chain
+	 * @param	second	Second chain of nodes, it is set to nullptr
+	 * @param	comp	Function object returning true if its first argument is ordered before its second argument
+	 */
+	template<typename Compare>
+	static void merge_nodes(Node*& first, Node*& second, Compare& comp);
+
+	/**
+	 * Sorts the nodes of the list without locking it. If the comparison throws, all nodes are linked again in an
+	 * unspecified order.
+	 * @param	comp	Function object returning true if its first argument is ordered before its second argument
+	 */
+	template<typename Compare>
+	void sort_nodes(Compare& comp);
+
+	/**
+	 * Restores m_prev of all nodes and m_last after the nodes were relinked by m_next starting at m_first.
+	 */
+	void relink();
+
+	/**
+	 * Locks the list and another list in the order of their addresses, so threads locking the same two lists can't
+	 * deadlock. The lists must be different.
+	 * @param	shared		true to lock the list in shared mode, false to lock it exclusively
+	 * @param	other		Other list to lock
+	 * @param	otherShared	true to lock the other list in shared mode, false to lock it exclusively
+	 */
+	template<typename OtherLock>
+	void lock_pair(bool shared, const BasicList<T, Allocator, OtherLock>& other, bool otherShared) const;
+
+	/**
+	 * Unlocks two lists locked by lock_pair.
+	 * @param	shared		true if the list is locked in shared mode
+	 * @param	other		Other list to unlock
+	 * @param	otherShared	true if the other list is locked in shared mode
+	 */
+	template<typename OtherLock>
+	void unlock_pair(bool shared, const BasicList<T, Allocator, OtherLock>& other, bool otherShared) const;
+
+	/**
+	 * Locks the list for methods working on two lists.
+	 * @param	shared	true to lock the list in shared mode for reading, false to lock it exclusively
+	 */
+	void lock_list(bool shared) const;
+
+	/**
+	 * Unlocks the list after methods working on two lists accessed it. Updates m_count if the list is locked
+	 * exclusively since the list might have been changed.
+	 * @param	shared	true if the list is locked in shared mode, false if it is locked exclusively
+	 */
+	void unlock_list(bool shared) const;
+
+protected:
+	// Lock of the list
+	mutable LockPolicy	m_lock;
+	// Count of elements in the list. It is updated while m_lock is locked exclusively and can be read without locking
+	// m_lock, lists whose lock policy doesn't synchronize don't update it.
+	std::atomic<size_t>	m_count;
+#ifdef SLIST_INSTRUMENTATION
+	// Counters of the operations and of the lock of the list
+	mutable ListInstrumentation	m_instrumentation;
+	// Stamp of the exclusive lock acquired by lock_list, it is only used while m_lock is locked exclusively
+	mutable LockStamp			m_listStamp;
+#endif
+
+	/**
+	 * Updates m_count after the list was changed and informs the lock policy about the change by
+	 * LockPolicyTraits::count_changed. m_lock has to be locked exclusively.
+	 */
+	void update_count();
+
+	/**
+	 * Locks m_lock exclusively and counts the operation if the instrumentation is enabled.
+	 * @param	operation	Operation which locks the list
+	 * @return				Stamp to pass to unlock
+	 */
+	LockStamp lock(ListOperation operation) const;
+
+	/**
+	 * Tries to lock m_lock exclusively without waiting and counts the operation if the instrumentation is enabled.
+	 * @param	operation	Operation which locks the list
+	 * @param	stamp		Receives the stamp to pass to unlock
+	 * @return				true if m_lock was locked, otherwise false
+	 */
+	bool try_lock(ListOperation operation, LockStamp& stamp) const;
+
+	/**
+	 * Unlocks m_lock locked by lock or try_lock and records the hold time and the size of the list if the
+	 * instrumentation is enabled. m_count has to be updated already.
+	 * @param	stamp	Stamp returned by lock or try_lock
+	 */
+	void unlock(const LockStamp& stamp) const;
+
+	/**
+	 * Locks m_lock in shared mode and counts the operation if the instrumentation is enabled.
+	 * @param	operation	Operation which locks the list
+	 * @return				Stamp to pass to unlock_shared
+	 */
+	LockStamp lock_shared(ListOperation operation) const;
+
+	/**
+	 * Unlocks m_lock locked by lock_shared and records the hold time if the instrumentation is enabled.
+	 * @param	stamp	Stamp returned by lock_shared
+	 */
+	void unlock_shared(const LockStamp& stamp) const;
+
+	/**
+	 * Ends the current hold of m_lock before it is released by waiting for a condition variable, so the waiting time
+	 * is not counted as hold time.
+	 * @param	stamp	Stamp of the current hold
+	 */
+	void suspend_hold(LockStamp& stamp) const;
+
+	/**
+	 * Starts a new hold of m_lock after waiting for a condition variable.
+	 * @param	stamp	Receives the stamp of the new hold
+	 */
+	void resume_hold(LockStamp& stamp) const;
+
+	/**
+	 * Adds an element to the back of the list without locking it. m_lock has to be locked exclusively.
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	void emplace_back_unlocked(Args&&... args);
+
+	/**
+	 * Adds an element to the front of the list without locking it. m_lock has to be locked exclusively.
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	void emplace_front_unlocked(Args&&... args);
+
+	/**
+	 * Removes the last element from the list without locking it. m_lock has to be locked exclusively.
+	 * @param	element	Receives the removed last element, it is left unchanged if the list is empty
+	 * @return			true if an element was removed, false if the list is empty
+	 */
+	bool try_pop_back_unlocked(T& element);
+
+	/**
+	 * Removes the first element from the list without locking it. m_lock has to be locked exclusively.
+	 * @param	element	Receives the removed first element, it is left unchanged if the list is empty
+	 * @return			true if an element was removed, false if the list is empty
+	 */
+	bool try_pop_front_unlocked(T& element);
+
+public:
+	/**
+	 * @class BasicIterator
+	 * Bidirectional iterator for the elements of the list which can be used with the algorithms of the STL. Iterators
+	 * stay valid until the element they refer to is removed from the list.
+	 * @tparam	Element	T for mutable iterators, const T for read-only iterators
+	 */
+	template<typename Element>
+	class BasicIterator
+	{
+	private:
+		friend class BasicList;
+		template<typename> friend class BasicIterator;
+
+		// Node of the current element, nullptr behind the last element
+		Node*				m_node;
+		// List of the iterator, it is needed to move back from the end of the list
+		const BasicList*	m_list;
+
+		/**
+		 * Constructor for instances of the class BasicIterator.
+		 * @param	node	Node of the current element
+		 * @param	list	List of the iterator
+		 */
+		BasicIterator(Node* node, const BasicList* list) : m_node(node), m_list(list) {}
+
+	public:
+		typedef std::bidirectional_iterator_tag				iterator_category;
+		typedef typename std::remove_const<Element>::type	value_type;
+		typedef std::ptrdiff_t								difference_type;
+		typedef Element*									pointer;
+		typedef Element&									reference;
+
+		/**
+		 * Default constructor for instances of the class BasicIterator. The iterator does not refer to any list.
+		 */
+		BasicIterator() : m_node(nullptr), m_list(nullptr) {}
+
+		/**
+		 * Converts a mutable iterator to a read-only iterator.
+		 * @return	Read-only iterator referring to the same element
+		 */
+		operator BasicIterator<const T>() const { return BasicIterator<const T>(m_node, m_list); }
+
+		reference operator*() const { return m_node->m_element; }
+		pointer operator->() const { return &m_node->m_element; }
+		BasicIterator& operator++() { m_node = m_node->m_next; return *this; }
+		BasicIterator operator++(int) { BasicIterator ret = *this; m_node = m_node->m_next; return ret; }
+		BasicIterator& operator--() { m_node = m_node ? m_node->m_prev : m_list->m_last; return *this; }
+		BasicIterator operator--(int) { BasicIterator ret = *this; --(*this); return ret; }
+		bool operator==(const BasicIterator& other) const { return m_node == other.m_node; }
+		bool operator!=(const BasicIterator& other) const { return m_node != other.m_node; }
+	};
+
+	// Iterator for the elements of the list
+	typedef BasicIterator<T>		iterator;
+	// Read-only iterator for the elements of the list
+	typedef BasicIterator<const T>	const_iterator;
+
+private:
+	/**
+	 * Removes the node an iterator refers to without locking the list.
+	 * @param	position	Iterator to the element to remove, it is invalid afterwards
+	 * @return				Iterator to the element behind the removed element
+	 */
+	iterator erase_node(const_iterator position);
 
 public:
 	/**
-	 * Default constructor for instances of the class List.
+	 * @class LockedView
+	 * View of the list which keeps m_lock locked as long as the view exists. The elements of the list can be accessed
+	 * by iterators of the view, e.g. in order to use the algorithms of the STL.
+	 * IMPORTANT: Methods of the same list lock m_lock again, so they may only be called while a view exists if
+	 * LockPolicy is recursive like Mutex. Use the methods of the view instead.
+	 */
+	class LockedView
+	{
+	private:
+		friend class BasicList;
+
+		// List locked by the view, nullptr if the view was moved
+		BasicList*	m_list;
+		// Stamp of the lock
+		LockStamp	m_stamp;
+
+		/**
+		 * Constructor for instances of the class LockedView. Locks the list.
+		 * @param	list	List to lock
+		 */
+		explicit LockedView(BasicList* list) : m_list(list), m_stamp(m_list->lock(OPERATION_VIEW)) {}
+
+	public:
+		/**
+		 * Move-constructor for instances of the class LockedView. The lock is passed to the new view.
+		 * @param	other	View to move
+		 */
+		LockedView(LockedView&& other) : m_list(other.m_list), m_stamp(other.m_stamp) { other.m_list = nullptr; }
+
+		/**
+		 * Destructor for instances of the class LockedView. Unlocks the list.
+		 */
+		~LockedView()
+		{
+			if (m_list)
+			{
+				m_list->update_count();
+				m_list->unlock(m_stamp);
+			}
+		}
+
+		iterator begin() { return iterator(m_list->m_first, m_list); }
+		iterator end() { return iterator(nullptr, m_list); }
+		iterator erase(const_iterator position) { return m_list->erase_node(position); }
+		size_t size() { return m_list->m_size; }
+
+		/**
+		 * Returns the locked list. Its methods lock m_lock again, so they can only be called if LockPolicy is
+		 * recursive like Mutex.
+		 * @return	The locked list
+		 */
+		BasicList& list() { return *m_list; }
+
+		LockedView(const LockedView&) = delete;
+		LockedView& operator=(const LockedView&) = delete;
+	};
+
+	/**
+	 * @class ConstLockedView
+	 * Read-only view of the list which keeps m_lock locked in shared mode as long as the view exists.
+	 * IMPORTANT: Methods of the same list must not be called while a view exists.
 	 */
-	List();
+	class ConstLockedView
+	{
+	private:
+		friend class BasicList;
+
+		// List locked by the view, nullptr if the view was moved
+		const BasicList*	m_list;
+		// Stamp of the lock
+		LockStamp			m_stamp;
+
+		/**
+		 * Constructor for instances of the class ConstLockedView. Locks the list in shared mode.
+		 * @param	list	List to lock
+		 */
+		explicit ConstLockedView(const BasicList* list) : m_list(list), m_stamp(m_list->lock_shared(OPERATION_VIEW)) {}
+
+	public:
+		/**
+		 * Move-constructor for instances of the class ConstLockedView. The lock is passed to the new view.
+		 * @param	other	View to move
+		 */
+		ConstLockedView(ConstLockedView&& other) : m_list(other.m_list), m_stamp(other.m_stamp)
+		{
+			other.m_list = nullptr;
+		}
+
+		/**
+		 * Destructor for instances of the class ConstLockedView. Unlocks the list.
+		 */
+		~ConstLockedView()
+		{
+			if (m_list)
+			{
+				m_list->unlock_shared(m_stamp);
+			}
+		}
+
+		const_iterator begin() const { return const_iterator(m_list->m_first, m_list); }
+		const_iterator end() const { return const_iterator(nullptr, m_list); }
+		size_t size() const { return m_list->m_size; }
+
+		ConstLockedView(const ConstLockedView&) = delete;
+		ConstLockedView& operator=(const ConstLockedView&) = delete;
+	};
 
 	/**
-	 * Copy-constructor for instances of the class List.
+	 * Default constructor for instances of the class BasicList.
+	 */
+	BasicList();
+
+	/**
+	 * Copy-constructor for instances of the class BasicList.
 	 * @param	other	List to copy
 	 */
-	List(const List<T>& other);
+	BasicList(const BasicList& other);
+
+	/**
+	 * Constructor which creates a deep copy of a list with another lock policy, e.g. an SList from a List.
+	 * @param	other	List to copy, it is locked in shared mode
+	 */
+	template<typename OtherLock>
+	BasicList(const BasicList<T, Allocator, OtherLock>& other);
+
+	/**
+	 * Move-constructor for instances of the class BasicList. Takes over the nodes of another list in constant time
+	 * while the other list is locked.
+	 * @param	other	List to move, it is empty afterwards
+	 */
+	BasicList(BasicList&& other);
 
 	/**
-	 * Constructor which creates an instance of the class List from an array.
+	 * Constructor which takes over the nodes of a list with another lock policy in constant time while the other list
+	 * is locked.
+	 * @param	other	List to move, it is empty afterwards
+	 */
+	template<typename OtherLock>
+	BasicList(BasicList<T, Allocator, OtherLock>&& other);
+
+	/**
+	 * Constructor which creates an instance of the class BasicList from an array.
 	 * @param	arr	Array to copy elements from
 	 */
 	template<size_t N>
-	List(const T (&arr)[N]);
+	BasicList(const T (&arr)[N]);
 
 	/**
-	 * Destructor for instances of the class List.
+	 * Destructor for instances of the class BasicList.
 	 */
-	virtual ~List();
+	~BasicList();
 
 	/**
-	 * Returns the count of elements in the list.
+	 * Returns the count of elements in the list. Synchronized lists return the count at the time of the call without
+	 * locking m_lock.
 	 * @return	The count of elements in the list
 	 */
-	virtual size_t size();
+	size_t size() const;
 
 	/**
-	 * Checks if the list is empty (= does not contain any elements).
+	 * Checks if the list is empty (= does not contain any elements). Synchronized lists check the list at the time of
+	 * the call without locking m_lock.
 	 * @return	true if the list is empty, otherwise false
 	 */
-	virtual bool empty();
+	bool empty() const;
 
 	/**
-	 * Removes all elements from the list.
+	 * Removes all elements from the list. Synchronized lists take over the nodes in constant time while the list is
+	 * locked and destroy them after unlocking it.
 	 */
-	virtual void clear();
+	void clear();
 
 	/**
 	 * Adds an element to the back of the list.
 	 * @param	element	Element to add to the list
 	 */
-	virtual void push_back(const T& element);
+	void push_back(const T& element);
+
+	/**
+	 * Adds an element to the back of the list by moving it into the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_back(T&& element);
+
+	/**
+	 * Adds an element to the back of the list which is constructed in place.
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	void emplace_back(Args&&... args);
+
+	/**
+	 * Adds the elements of a range to the back of the list. m_lock is locked only once for all elements.
+	 * @param	first	Iterator to the first element of the range
+	 * @param	last	Iterator behind the last element of the range
+	 */
+	template<typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+	void push_back(InputIt first, InputIt last);
+
+	/**
+	 * Moves all nodes of another list to the back of the list in constant time. The elements are neither copied nor
+	 * moved, the nodes are relinked. Both lists are locked in the order of their addresses, so a List filled by a
+	 * single thread can be published to an SList in one step without any locking of the List.
+	 * @param	other	List to take the nodes from, it is empty afterwards
+	 */
+	template<typename OtherLock>
+	void append(BasicList<T, Allocator, OtherLock>&& other);
 
 	/**
 	 * Adds an element to the front of the list.
 	 * @param	element	Element to add to the list
 	 */
-	virtual void push_front(const T& element);
+	void push_front(const T& element);
 
 	/**
-	 * Returns a copy of the last element and removes it from the list.
-	 * @return	A copy of the removed last element
+	 * Adds an element to the front of the list by moving it into the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_front(T&& element);
+
+	/**
+	 * Adds an element to the front of the list which is constructed in place.
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	void emplace_front(Args&&... args);
+
+	/**
+	 * Removes the last element from the list and returns it. The element is moved out of the list.
+	 * @return	The removed last element or a value-initialized element if the list is empty
+	 */
+	T pop_back();
+
+	/**
+	 * Removes the last element from the list if the list is not empty. The element is moved out of the list. Checking
+	 * the list and removing the element is done while m_lock is locked once, so no other thread can empty the list in
+	 * between.
+	 * @param	element	Receives the removed last element, it is left unchanged if the list is empty
+	 * @return			true if an element was removed, false if the list is empty
+	 */
+	bool try_pop_back(T& element);
+
+	/**
+	 * Removes the last element from the list if m_lock can be locked immediately and the list is not empty. The
+	 * method never blocks, it can be used by threads which rather skip a contended list than wait for it.
+	 * @param	element	Receives the removed last element, it is left unchanged if no element was removed
+	 * @return			true if an element was removed, false if m_lock is locked by another thread or the list is
+	 *					empty
+	 */
+	bool try_lock_pop_back(T& element);
+
+	/**
+	 * Removes the first element from the list and returns it. The element is moved out of the list.
+	 * @return	The removed first element or a value-initialized element if the list is empty
+	 */
+	T pop_front();
+
+	/**
+	 * Removes the first element from the list if the list is not empty. The element is moved out of the list.
+	 * Checking the list and removing the element is done while m_lock is locked once, so no other thread can empty the
+	 * list in between.
+	 * @param	element	Receives the removed first element, it is left unchanged if the list is empty
+	 * @return			true if an element was removed, false if the list is empty
+	 */
+	bool try_pop_front(T& element);
+
+	/**
+	 * Removes the first element from the list if m_lock can be locked immediately and the list is not empty. The
+	 * method never blocks, it can be used by threads which rather skip a contended list than wait for it.
+	 * @param	element	Receives the removed first element, it is left unchanged if no element was removed
+	 * @return			true if an element was removed, false if m_lock is locked by another thread or the list is
+	 *					empty
 	 */
-	virtual T pop_back();
+	bool try_lock_pop_front(T& element);
 
 	/**
-	 * Returns a copy of the first element and removes it from the list.
-	 * @return	A copy of the removed first element
+	 * Removes up to count elements from the front of the list. The elements are moved out of the list. m_lock is
+	 * locked only once for all elements.
+	 * @param	count	Maximum count of elements to remove
+	 * @param	out		Output iterator receiving the removed elements in the order of the list
+	 * @return			Count of removed elements
 	 */
-	virtual T pop_front();
+	template<typename OutputIt>
+	size_t pop_front_n(size_t count, OutputIt out);
 
 	/**
-	 * Removes elements from the list.
+	 * Removes elements from the list. Synchronized lists destroy the removed elements after unlocking the list.
 	 * @param	element	Element to remove from the list
 	 */
-	virtual void remove(const T& element);
+	void remove(const T& element);
+
+	/**
+	 * Removes the elements for which a predicate returns true. m_lock is locked once, synchronized lists destroy the
+	 * removed elements after unlocking it.
+	 * @param	pred	Function object called for every element in the list
+	 * @return			The count of removed elements
+	 */
+	template<typename Predicate>
+	size_t remove_if(Predicate pred);
+
+	/**
+	 * Counts the elements of the list which are equal to an element. m_lock is locked in shared mode. The nodes are
+	 * compared one at a time, UnrolledList compares contiguous elements in SIMD registers.
+	 * @param	element	Element to search for
+	 * @return			The count of equal elements
+	 */
+	size_t count(const T& element) const;
+
+	/**
+	 * Checks if the list contains an element which is equal to an element. m_lock is locked in shared mode.
+	 * @param	element	Element to search for
+	 * @return			true if an equal element was found, otherwise false
+	 */
+	bool contains(const T& element) const;
+
+	/**
+	 * Returns an iterator to the first element of the list which is equal to an element. Not available for
+	 * synchronized lists, use std::find with the iterators of locked_view instead.
+	 * @param	element	Element to search for
+	 * @return			Iterator to the first equal element, equal to end() if no element is equal
+	 */
+	iterator find(const T& element);
+
+	/**
+	 * Returns a read-only iterator to the first element of the list which is equal to an element. Not available for
+	 * synchronized lists.
+	 * @param	element	Element to search for
+	 * @return			Iterator to the first equal element, equal to end() if no element is equal
+	 */
+	const_iterator find(const T& element) const;
 
 	/**
 	 * Function pointer to pass to the iterate method for usage as callback function for every element in the list.
@@ -178,13 +850,42 @@ public:
 	 * @param	func		Pointer to a callback function called for every element in the list
 	 * @param	parameter	A user-defined parameter to be passed to the callback function, can be NULL
 	 */
-	virtual void iterate(const typename List<T>::IterationFunction& func, void* parameter = nullptr);
+	void iterate(const IterationFunction& func, void* parameter = nullptr);
+
+	/**
+	 * Function pointer to pass to the read-only iterate method for usage as callback function for every element in the
+	 * list.
+	 * @param	element		Current element of the iteration
+	 * @param	parameter	A user-defined parameter
+	 * @return				Action for the iterate method after calling the callback function. ACTION_REMOVE is ignored
+	 *						since the elements can't be removed by a read-only iteration.
+	 */
+	typedef ListIterationAction (*ConstIterationFunction)(const T& element, void* parameter);
+
+	/**
+	 * Iterates from the front to the back of the list without changing it using a function pointer as callback function
+	 * for every element in the list. m_lock is locked in shared mode.
+	 * @param	func		Pointer to a callback function called for every element in the list
+	 * @param	parameter	A user-defined parameter to be passed to the callback function, can be NULL
+	 */
+	void iterate(const ConstIterationFunction& func, void* parameter = nullptr) const;
+
+	/**
+	 * Iterates a non-const list without changing it using a function pointer as callback function for every element in
+	 * the list, like the const overload. Without it a ConstIterationFunction passed without parameter would be taken
+	 * for a lambda function.
+	 * @param	func		Pointer to a callback function called for every element in the list
+	 * @param	parameter	A user-defined parameter to be passed to the callback function, can be NULL
+	 */
+	void iterate(const ConstIterationFunction& func, void* parameter = nullptr);
 
 	/**
 	 * Iterates from the front to the back of the list using a lambda function as callback function for every element
 	 * in the list. In advance to the iterate method taking a function pointer as parameter this method allows you to
 	 * use lambda captures. The callback lambda function should have the following signature:
 	 * auto func = [your lambda capture list goes here](T& element) -> ListInterationAction { your code goes here };
+	 * Synchronized lists destroy the elements removed by ACTION_REMOVE after unlocking the list. If the callback
+	 * function throws, the elements removed before stay removed, the list is unlocked and the exception is rethrown.
 	 * @param	func	Callback lambda function called for every element in the list. It receives a reference to the
 	 *					current element as a parameter.
 	 */
@@ -192,19 +893,193 @@ public:
 	void iterate(const Lambda& func);
 
 	/**
-	 * Clears the list and creates a deep copy of another list.
+	 * Iterates from the front to the back of the list without changing it using a lambda function as callback function
+	 * for every element in the list. m_lock is locked in shared mode. This method is called for const lists, call it
+	 * through a const reference to iterate a non-const list read-only. The callback lambda function should have the
+	 * following signature:
+	 * auto func = [your lambda capture list goes here](const T& element) -> ListInterationAction { your code goes here };
+	 * ACTION_REMOVE is ignored since the elements can't be removed by a read-only iteration.
+	 * @param	func	Callback lambda function called for every element in the list. It receives a const reference to
+	 *					the current element as a parameter.
+	 */
+	template<typename Lambda>
+	void iterate(const Lambda& func) const;
+
+	/**
+	 * Returns an iterator to the first element of the list. Iterators can't be used without locking the list, so
+	 * synchronized lists don't compile it, use the iterators of locked_view instead.
+	 * @return	Iterator to the first element, equal to end() if the list is empty
+	 */
+	iterator begin();
+
+	/**
+	 * Returns an iterator behind the last element of the list. Not available for synchronized lists.
+	 * @return	Iterator behind the last element
+	 */
+	iterator end();
+
+	/**
+	 * Returns a read-only iterator to the first element of the list. Not available for synchronized lists.
+	 * @return	Iterator to the first element, equal to end() if the list is empty
+	 */
+	const_iterator begin() const;
+
+	/**
+	 * Returns a read-only iterator behind the last element of the list. Not available for synchronized lists.
+	 * @return	Iterator behind the last element
+	 */
+	const_iterator end() const;
+
+	/**
+	 * Removes the element an iterator refers to from the list. Not available for synchronized lists.
+	 * @param	position	Iterator to the element to remove, it is invalid afterwards
+	 * @return				Iterator to the element behind the removed element
+	 */
+	iterator erase(const_iterator position);
+
+	/**
+	 * Locks the list and returns a view which unlocks the list when it is destroyed.
+	 * @return	View of the locked list
+	 */
+	LockedView locked_view();
+
+	/**
+	 * Locks the list in shared mode and returns a read-only view which unlocks the list when it is destroyed.
+	 * @return	Read-only view of the locked list
+	 */
+	ConstLockedView locked_view() const;
+
+	/**
+	 * Exchanges the elements of the list with the elements of another list in constant time. Both lists are locked
+	 * in the order of their addresses.
+	 * @param	other	List to swap with
+	 */
+	template<typename OtherLock>
+	void swap(BasicList<T, Allocator, OtherLock>& other);
+
+	/**
+	 * Sorts the elements of the list by relinking its nodes (bottom-up merge sort). m_lock is locked once for the
+	 * whole sort, no element is copied or moved and no memory is allocated. The order of equal elements is kept.
+	 * @param	comp	Function object returning true if its first argument is ordered before its second argument
+	 */
+	template<typename Compare = std::less<T>>
+	void sort(Compare comp = Compare());
+
+	/**
+	 * Merges the nodes of another sorted list into the sorted list by relinking them. Elements of the list precede
+	 * equal elements of the other list. Both lists are locked in the order of their addresses.
+	 * @param	other	Sorted list to merge, it is empty afterwards
+	 * @param	comp	Function object returning true if its first argument is ordered before its second argument
+	 */
+	template<typename Compare = std::less<T>, typename OtherLock = LockPolicy>
+	void merge(BasicList<T, Allocator, OtherLock>&& other, Compare comp = Compare());
+
+	/**
+	 * Removes all but the first element of every group of consecutive equal elements. m_lock is locked once,
+	 * synchronized lists destroy the removed elements after unlocking it.
+	 * @param	pred	Function object returning true if two elements are equal
+	 * @return			The count of removed elements
+	 */
+	template<typename BinaryPredicate = std::equal_to<T>>
+	size_t unique(BinaryPredicate pred = BinaryPredicate());
+
+	/**
+	 * Reverses the order of the elements by swapping the pointers of every node.
+	 */
+	void reverse();
+
+	/**
+	 * Prepares the allocator for adding a count of elements, e.g. PoolAllocator allocates all of their nodes at once.
+	 * @param	count	Count of elements which will be added
+	 */
+	void reserve(size_t count);
+
+	/**
+	 * Writes the elements of the list to a writer, e.g. to save several lists to one file. Synchronized lists copy
+	 * chunks of about SAVE_CHUNK_SIZE bytes while m_lock is locked in shared mode and write every chunk after unlocking
+	 * it, so other threads never wait for the file system and the copy doesn't grow with the list. Every chunk shows
+	 * one state of the list, but other threads may change the list between two chunks. Saving continues at the node
+	 * behind the last written one; if that node was removed in between, at the next node which is still part of the
+	 * list. So every element which is part of the list during the whole save is written exactly once, in the order of
+	 * the list if it wasn't reordered in between. Elements added in front of the written ones are not written, and
+	 * clearing, swapping or assigning the list ends the save.
+	 * @param	writer	Writer to write the elements to
+	 * @return			true if the elements were written, false if a write failed
+	 */
+	bool save(ListWriter<T>& writer) const;
+
+	/**
+	 * Saves the elements of the list to a file, see ListSerializer for the format of the elements.
+	 * @param	path	Path of the file, it is created or truncated
+	 * @return			true if the file was written, otherwise false
+	 */
+	bool save(const char* path) const;
+
+	/**
+	 * Adds the elements saved in a file to the back of the list. The file is mapped into memory and the nodes are
+	 * created without locking the list after reserving memory for all of them, then they are appended to the list in
+	 * constant time. T has to be default-constructible.
+	 * @param	path	Path of the file
+	 * @return			true if all elements were added, false if the file couldn't be read or is corrupted. Nothing is
+	 *					added to the list in this case.
+	 */
+	bool load(const char* path);
+
+#ifdef SLIST_INSTRUMENTATION
+	/**
+	 * Returns a snapshot of the counters of the list. m_lock is not locked.
+	 * @return	Snapshot of the counters
+	 */
+	ListStatistics statistics() const;
+
+	/**
+	 * Sets all counters of the list to zero. m_lock is not locked.
+	 */
+	void reset_statistics();
+#endif
+
+	/**
+	 * Clears the list and creates a deep copy of another list. Both lists are locked in the order of their addresses.
 	 * @param	other	List to copy
-	 * @return			Reference to the List instance
+	 * @return			Reference to the BasicList instance
 	 */
-	virtual List& operator=(const List<T>& other);
+	BasicList& operator=(const BasicList& other);
+
+	/**
+	 * Clears the list and creates a deep copy of a list with another lock policy. Both lists are locked in the order of
+	 * their addresses.
+	 * @param	other	List to copy
+	 * @return			Reference to the BasicList instance
+	 */
+	template<typename OtherLock>
+	BasicList& operator=(const BasicList<T, Allocator, OtherLock>& other);
+
+	/**
+	 * Clears the list and takes over the nodes of another list in constant time. Both lists are locked in the order of
+	 * their addresses.
+	 * @param	other	List to move, it is empty afterwards
+	 * @return			Reference to the BasicList instance
+	 */
+	BasicList& operator=(BasicList&& other);
+
+	/**
+	 * Clears the list and takes over the nodes of a list with another lock policy in constant time. Both lists are
+	 * locked in the order of their addresses.
+	 * @param	other	List to move, it is empty afterwards
+	 * @return			Reference to the BasicList instance
+	 */
+	template<typename OtherLock>
+	BasicList& operator=(BasicList<T, Allocator, OtherLock>&& other);
 
 	/**
 	 * Checks if the elements of the list are equal to the elements of another list and if they are sorted in the same
-	 * order.
+	 * order. Both lists are locked in shared mode in the order of their addresses. Lists of different sizes are
+	 * unequal without comparing any element.
 	 * @param	other	List to compare to
 	 * @return			true if the lists contain equal elements in the same order, false otherwise
 	 */
-	virtual bool operator==(const List<T>& other);
+	template<typename OtherLock>
+	bool operator==(const BasicList<T, Allocator, OtherLock>& other) const;
 
 	/**
 	 * Checks if the elements of the list are unequal to the elements of another list or if they are sorted in a different
@@ -213,11 +1088,21 @@ public:
 	 * @return			true if the lists contain unequal elements or if they are sorted in a different order,
 	 *					false otherwise
 	 */
-	virtual bool operator!=(const List<T>& other);
+	template<typename OtherLock>
+	bool operator!=(const BasicList<T, Allocator, OtherLock>& other) const;
 };
 
 
-// Include implementation of List
+/**
+ * A double-linked list class which doesn't lock at all. It must not be used by several threads at the same time.
+ * @tparam	T			Type of the elements of the list
+ * @tparam	Allocator	Allocator for the nodes of the list, e.g. PoolAllocator (default) or HeapAllocator
+ */
+template<typename T, typename Allocator = PoolAllocator<>>
+using List = BasicList<T, Allocator, NoLock>;
+
+
+// Include implementation of BasicList
 #include "List.tpp"
 
 
@@ -8,9 +8,135 @@
 #error LIST_HPP undefined
 #endif
 
-template<typename T>
-void List<T>::remove(Node* node)
+#include <new>
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename... Args>
+typename BasicList<T, Allocator, LockPolicy>::Node* BasicList<T, Allocator, LockPolicy>::create_node(Args&&... args)
+{
+	if (DEFER_DESTRUCTION && !Allocator::THREAD_SAFE && m_destroyed.load(std::memory_order_relaxed))
+	{
+		// Reuse the memory of nodes destroyed after unlocking m_lock
+		drain();
+	}
+	void* memory = m_allocator.allocate();
+	try
+	{
+		return new (memory) Node(std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		// The constructor of the element threw, don't leak the node
+		m_allocator.deallocate(memory);
+		throw;
+	}
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::destroy_node(Node* node)
+{
+	node->~Node();
+	m_allocator.deallocate(node);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::link_back(Node* newnode)
+{
+	if (m_first)
+	{
+		// List is not empty
+		newnode->m_prev = m_last;
+		m_last->m_next = newnode;
+		m_last = newnode;
+	}
+	else
+	{
+		// List is empty
+		m_first = newnode;
+		m_last = newnode;
+	}
+	m_size++;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename... Args>
+void BasicList<T, Allocator, LockPolicy>::push(bool back, Args&&... args)
+{
+	Node* node = nullptr;
+	if (ALLOCATE_UNLOCKED)
+	{
+		// Construct the element and allocate its node while other threads can use the list
+		node = create_node(std::forward<Args>(args)...);
+	}
+	LockStamp stamp = lock(OPERATION_PUSH);
+	if (!ALLOCATE_UNLOCKED)
+	{
+		try
+		{
+			node = create_node(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			unlock(stamp);
+			throw;
+		}
+	}
+	if (back)
+	{
+		link_back(node);
+	}
+	else
+	{
+		link_front(node);
+	}
+	update_count();
+	unlock(stamp);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::link_front(Node* newnode)
+{
+	if (m_first)
+	{
+		// List is not empty
+		newnode->m_next = m_first;
+		m_first->m_prev = newnode;
+		m_first = newnode;
+	}
+	else
+	{
+		// List is empty
+		m_first = newnode;
+		m_last = newnode;
+	}
+	m_size++;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+void BasicList<T, Allocator, LockPolicy>::take(BasicList<T, Allocator, OtherLock>& other)
+{
+	quiesce();
+	other.quiesce();
+	m_first = other.m_first;
+	m_last = other.m_last;
+	m_size = other.m_size;
+	// The nodes belong to the allocator of the other list, so take the allocator along with them
+	m_allocator.swap(other.m_allocator);
+	other.m_first = nullptr;
+	other.m_last = nullptr;
+	other.m_size = 0;
+	other.end_cursors();
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::unlink(Node* node)
 {
+	if (m_cursors)
+	{
+		skip_cursors(node);
+	}
+
 	if (node->m_prev)
 	{
 		node->m_prev->m_next = node->m_next;
@@ -30,278 +156,1431 @@ void List<T>::remove(Node* node)
 		// node is m_last, set new m_last to node->m_prev
 		m_last = node->m_prev;
 	}
-
-	delete node;
 	m_size--;
 }
 
-template<typename T>
-void List<T>::copy(const List<T>& other)
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::skip_cursors(const Node* node)
 {
-	if (this != &other)
+	for (SaveCursor* cursor = m_cursors; cursor; cursor = cursor->m_next)
 	{
-		clear();
-		// Prefer a function pointer over a lambda function in order to guarantee thread-safety of the derived class SList
-		IterationFunction copyList = [](T& element, void* parameter) -> ListIterationAction
+		if (cursor->m_node == node)
 		{
-			(static_cast<List*>(parameter))->push_back(element);
-			return ListIterationAction::ACTION_CONTINUE;
-		};
-		(const_cast<List&>(other)).iterate(copyList, static_cast<void*>(this));
+			cursor->m_node = node->m_next;
+		}
 	}
 }
 
-template<typename T>
-template<size_t N>
-void List<T>::copy(const T (&arr)[N])
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::end_cursors()
 {
-	clear();
-	for (size_t i = 0; i < N; i++)
+	for (SaveCursor* cursor = m_cursors; cursor; cursor = cursor->m_next)
 	{
-		push_back(arr[i]);
+		cursor->m_node = nullptr;
 	}
 }
 
-template<typename T>
-bool List<T>::equals(const List<T>& other) const
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::remove_cursor(SaveCursor* cursor) const
 {
-	if (this == &other)
+	LockStamp stamp = lock(OPERATION_ITERATE);
+	SaveCursor** link = &m_cursors;
+	while (*link != cursor)
 	{
-		return true;
+		link = &(*link)->m_next;
 	}
+	*link = cursor->m_next;
+	unlock(stamp);
+}
 
-	bool ret = false;
-	//if (other.size() == m_size) // Refrain from this check in order to guarantee thread-safety of the derived class SList
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::remove(Node* node)
+{
+	unlink(node);
+	destroy_node(node);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::retire(Node* node, Node*& retired)
+{
+	unlink(node);
+	if (DEFER_DESTRUCTION)
 	{
-		// Prepare parameters
-		struct ComparisionParams
+		if (!retired && !Allocator::THREAD_SAFE)
 		{
-			Node*	m_current;
-			size_t	m_countOfEqualElements;
-			size_t	m_countOfComparedElements;
-		} params;
-		params.m_current					= m_first;
-		params.m_countOfEqualElements		= 0;
-		params.m_countOfComparedElements	= 0;
+			// The memory of the nodes stays in m_allocator until reclaim finished
+			m_reclaimers.fetch_add(1, std::memory_order_relaxed);
+		}
+		node->m_next = retired;
+		retired = node;
+	}
+	else
+	{
+		destroy_node(node);
+	}
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::reclaim(Node* retired)
+{
+	if (!retired)
+	{
+		return;
+	}
 
-		IterationFunction compare = [](T& element, void* parameter) -> ListIterationAction
+	void* first = nullptr;
+	void* last = nullptr;
+	while (retired)
+	{
+		Node* next = retired->m_next;
+		retired->~Node();
+		if (Allocator::THREAD_SAFE)
+		{
+			m_allocator.deallocate(retired);
+		}
+		else
 		{
-			ComparisionParams* params = static_cast<ComparisionParams*>(parameter);
-			// Compare current elements
-			if (params->m_current && params->m_current->m_element == element)
+			// Link the memory of the destructed node by its first pointer like a free list
+			*static_cast<void**>(static_cast<void*>(retired)) = first;
+			if (!last)
 			{
-				// Increase the count of equal elements and count of compared elements
-				params->m_countOfEqualElements++;
-				params->m_countOfComparedElements++;
-				// Get the next node of our list
-				params->m_current = params->m_current->m_next;
-				// Continue the iteration
-				return ListIterationAction::ACTION_CONTINUE;
+				last = retired;
 			}
-			// Current element is unequal or our list contains less elements the the other list, break the iteration
-			params->m_countOfComparedElements++;
-			return ListIterationAction::ACTION_BREAK;
-		};
-
-		// Iterate the list using the compare function pointer as callback for the iteration
-		(const_cast<List&>(other)).iterate(compare, &params);
+			first = retired;
+		}
+		retired = next;
+	}
 
-		// If the count of equal elements is equal to the size of the list, return true
-		if (m_size == params.m_countOfComparedElements && params.m_countOfComparedElements == params.m_countOfEqualElements)
+	if (!Allocator::THREAD_SAFE)
+	{
+		// Publish all blocks at once, they are returned to the allocator while m_lock is locked
+		void* head = m_destroyed.load(std::memory_order_relaxed);
+		do
 		{
-			ret = true;
+			*static_cast<void**>(last) = head;
 		}
+		while (!m_destroyed.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+		m_reclaimers.fetch_sub(1, std::memory_order_release);
 	}
-	return ret;
 }
 
-template<typename T>
-List<T>::List() : m_first(nullptr), m_last(nullptr), m_size(0)
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::drain()
 {
-	// Nothing to do yet
+	void* block = m_destroyed.exchange(nullptr, std::memory_order_acquire);
+	while (block)
+	{
+		void* next = *static_cast<void**>(block);
+		m_allocator.deallocate(block);
+		block = next;
+	}
 }
 
-template<typename T>
-List<T>::List(const List<T>& other) : m_first(nullptr), m_last(nullptr), m_size(0)
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::quiesce()
 {
-	copy(other);
+	if (DEFER_DESTRUCTION && !Allocator::THREAD_SAFE)
+	{
+		// Threads destroying retired nodes don't lock m_lock, so waiting for them while it is locked can't deadlock
+		while (0 != m_reclaimers.load(std::memory_order_acquire))
+		{
+			std::this_thread::yield();
+		}
+		drain();
+	}
 }
 
-template<typename T>
-template<size_t N>
-List<T>::List(const T (&other)[N]) : m_first(nullptr), m_last(nullptr), m_size(0)
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::destroy_nodes()
 {
-	copy(other);
+	quiesce();
+	if (!Allocator::BULK_RELEASE || !std::is_trivially_destructible<T>::value)
+	{
+		Node* current = m_first;
+		while (current)
+		{
+			Node* next = current->m_next;
+			if (Allocator::BULK_RELEASE)
+			{
+				// Only destruct the element, the memory of the node is released along with its slab
+				current->~Node();
+			}
+			else
+			{
+				destroy_node(current);
+			}
+			current = next;
+		}
+	}
+	// Return whole slabs instead of single nodes if the allocator supports it
+	m_allocator.release();
+	m_first = nullptr;
+	m_last = nullptr;
+	m_size = 0;
+	end_cursors();
 }
 
-template<typename T>
-List<T>::~List()
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+void BasicList<T, Allocator, LockPolicy>::copy(const BasicList<T, Allocator, OtherLock>& other)
 {
-	clear();
+	if (static_cast<const void*>(this) != static_cast<const void*>(&other))
+	{
+		lock_pair(false, other, true);
+		try
+		{
+			destroy_nodes();
+			for (const Node* current = other.m_first; current; current = current->m_next)
+			{
+				link_back(create_node(current->m_element));
+			}
+		}
+		catch (...)
+		{
+			unlock_pair(false, other, true);
+			throw;
+		}
+		unlock_pair(false, other, true);
+	}
 }
 
-template<typename T>
-size_t List<T>::size()
+template<typename T, typename Allocator, typename LockPolicy>
+template<size_t N>
+void BasicList<T, Allocator, LockPolicy>::copy(const T (&arr)[N])
 {
-	return m_size;
+	destroy_nodes();
+	for (size_t i = 0; i < N; i++)
+	{
+		link_back(create_node(arr[i]));
+	}
 }
 
-template<typename T>
-bool List<T>::empty()
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+bool BasicList<T, Allocator, LockPolicy>::equals(const BasicList<T, Allocator, OtherLock>& other) const
 {
-	return 0 == m_size;
+	if (static_cast<const void*>(this) == static_cast<const void*>(&other))
+	{
+		return true;
+	}
+
+	lock_pair(true, other, true);
+	// Both lists are locked, so their sizes can be compared before comparing any element
+	bool ret = m_size == other.m_size;
+	try
+	{
+		const Node* otherCurrent = other.m_first;
+		for (const Node* current = m_first; ret && current; current = current->m_next)
+		{
+			ret = current->m_element == otherCurrent->m_element;
+			otherCurrent = otherCurrent->m_next;
+		}
+	}
+	catch (...)
+	{
+		unlock_pair(true, other, true);
+		throw;
+	}
+	unlock_pair(true, other, true);
+	return ret;
 }
 
-template<typename T>
-void List<T>::clear()
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename Lambda>
+void BasicList<T, Allocator, LockPolicy>::iterate_nodes(const Lambda& func, Node*& retired)
 {
 	Node* current = m_first;
 	while (current)
 	{
 		Node* next = current->m_next;
-		delete current;
+		ListIterationAction action = func(current->m_element);
+		if (action & ListIterationAction::ACTION_REMOVE)
+		{
+			retire(current, retired);
+		}
+		if (action & ListIterationAction::ACTION_BREAK)
+		{
+			break;
+		}
 		current = next;
 	}
-	m_first = nullptr;
-	m_last = nullptr;
-	m_size = 0;
 }
 
-template<typename T>
-void List<T>::push_back(const T& element)
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename Lambda>
+void BasicList<T, Allocator, LockPolicy>::iterate_nodes(const Lambda& func) const
 {
-	Node* newnode = new Node(element);
-	if (m_first)
+	const Node* current = m_first;
+	while (current)
 	{
-		// List is not empty
-		newnode->m_prev = m_last;
-		m_last->m_next = newnode;
-		m_last = newnode;
+		ListIterationAction action = func(current->m_element);
+		if (action & ListIterationAction::ACTION_BREAK)
+		{
+			break;
+		}
+		current = current->m_next;
 	}
-	else
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename Compare>
+void BasicList<T, Allocator, LockPolicy>::merge_nodes(Node*& first, Node*& second, Compare& comp)
+{
+	Node* left = first;
+	Node* right = second;
+	second = nullptr;
+	Node* head = nullptr;
+	Node** tail = &head;
+	try
 	{
-		// List is empty
-		m_first = newnode;
-		m_last = newnode;
+		while (left && right)
+		{
+			// Take the node of the second chain only if it is ordered before, so equal elements keep their order
+			if (comp(right->m_element, left->m_element))
+			{
+				*tail = right;
+				right = right->m_next;
+			}
+			else
+			{
+				*tail = left;
+				left = left->m_next;
+			}
+			tail = &(*tail)->m_next;
+		}
 	}
-	m_size++;
+	catch (...)
+	{
+		// Keep all nodes in the first chain, so the caller can link them again
+		*tail = left;
+		while (*tail)
+		{
+			tail = &(*tail)->m_next;
+		}
+		*tail = right;
+		first = head;
+		throw;
+	}
+	*tail = left ? left : right;
+	first = head;
 }
 
-template<typename T>
-void List<T>::push_front(const T& element)
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename Compare>
+void BasicList<T, Allocator, LockPolicy>::sort_nodes(Compare& comp)
 {
-	Node* newnode = new Node(element);
-	if (m_first)
+	if (m_size < 2)
 	{
-		// List is not empty
-		newnode->m_next = m_first;
-		m_first->m_prev = newnode;
-		m_first = newnode;
+		return;
 	}
-	else
+
+	// bins[i] is empty or a sorted chain of 2^i nodes, bins with higher indexes contain earlier elements
+	Node* bins[64] = {};
+	size_t used = 0;
+	Node* current = m_first;
+	Node* run = nullptr;
+	try
 	{
-		// List is empty
-		m_first = newnode;
-		m_last = newnode;
+		while (current)
+		{
+			// Merge the next node with the full bins like adding 1 to a binary counter
+			run = current;
+			current = current->m_next;
+			run->m_next = nullptr;
+			size_t i = 0;
+			for (; i < used && bins[i]; i++)
+			{
+				merge_nodes(bins[i], run, comp);
+				run = bins[i];
+				bins[i] = nullptr;
+			}
+			if (i == used)
+			{
+				used++;
+			}
+			bins[i] = run;
+			run = nullptr;
+		}
+
+		for (size_t i = 0; i < used; i++)
+		{
+			if (bins[i])
+			{
+				merge_nodes(bins[i], run, comp);
+				run = bins[i];
+				bins[i] = nullptr;
+			}
+		}
 	}
-	m_size++;
+	catch (...)
+	{
+		// Link all nodes again in an unspecified order, so no element is lost. Merging with a comparison which never
+		// returns true appends the second chain to the first one.
+		auto concatenate = [](const T& /*first*/, const T& /*second*/) -> bool { return false; };
+		Node* chain = current;
+		for (size_t i = 0; i < used; i++)
+		{
+			Node* bin = bins[i];
+			merge_nodes(bin, chain, concatenate);
+			chain = bin;
+		}
+		merge_nodes(run, chain, concatenate);
+		m_first = run;
+		relink();
+		throw;
+	}
+	m_first = run;
+	relink();
 }
 
-template<typename T>
-T List<T>::pop_back()
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::relink()
 {
-	if (m_last)
+	Node* prev = nullptr;
+	for (Node* current = m_first; current; current = current->m_next)
 	{
-		T element = m_last->m_element;
-		remove(m_last);
-		return element;
+		current->m_prev = prev;
+		prev = current;
 	}
-	return T(0);
+	m_last = prev;
 }
 
-template<typename T>
-T List<T>::pop_front()
+template<typename T, typename Allocator, typename LockPolicy>
+typename BasicList<T, Allocator, LockPolicy>::iterator BasicList<T, Allocator, LockPolicy>::erase_node(
+	const_iterator position)
 {
-	if (m_first)
+	Node* next = position.m_node->m_next;
+	remove(position.m_node);
+	return iterator(next, this);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+void BasicList<T, Allocator, LockPolicy>::lock_pair(bool shared, const BasicList<T, Allocator, OtherLock>& other, bool otherShared) const
+{
+	if (std::less<const void*>()(&other, this))
 	{
-		T element = m_first->m_element;
-		remove(m_first);
-		return element;
+		other.lock_list(otherShared);
+		lock_list(shared);
+	}
+	else
+	{
+		lock_list(shared);
+		other.lock_list(otherShared);
 	}
-	return T(0);
 }
 
-template<typename T>
-void List<T>::remove(const T& element)
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+void BasicList<T, Allocator, LockPolicy>::unlock_pair(bool shared, const BasicList<T, Allocator, OtherLock>& other, bool otherShared) const
 {
-	Node* current = m_first;
-	while (current)
+	unlock_list(shared);
+	other.unlock_list(otherShared);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::lock_list(bool shared) const
+{
+	if (shared)
 	{
-		Node* next = current->m_next;
-		if (element == current->m_element)
-		{
-			remove(current);
-		}
-		current = next;
+		// Shared locks of two lists are held by several threads at once, so their hold time isn't recorded
+		lock_shared(OPERATION_OTHER);
+	}
+	else
+	{
+#ifdef SLIST_INSTRUMENTATION
+		m_listStamp = lock(OPERATION_OTHER);
+#else
+		lock(OPERATION_OTHER);
+#endif
 	}
 }
 
-template<typename T>
-void List<T>::iterate(const typename List<T>::IterationFunction& func, void* parameter)
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::unlock_list(bool shared) const
 {
-	Node* current = m_first;
-	while (current)
+	if (shared)
 	{
-		Node* next = current->m_next;
-		ListIterationAction action = func(current->m_element, parameter);
-		if (action & ListIterationAction::ACTION_REMOVE)
-		{
-			remove(current);
-		}
-		if (action & ListIterationAction::ACTION_BREAK)
-		{
-			break;
-		}
-		current = next;
+		unlock_shared(LockStamp());
+	}
+	else
+	{
+		// Only non-const methods lock the list exclusively, so the list itself isn't const
+		const_cast<BasicList*>(this)->update_count();
+#ifdef SLIST_INSTRUMENTATION
+		unlock(m_listStamp);
+#else
+		unlock(LockStamp());
+#endif
 	}
 }
 
-template<typename T>
-template<typename Lambda>
-void List<T>::iterate(const Lambda& func)
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::update_count()
 {
-	Node* current = m_first;
-	while (current)
+	if (LockPolicyTraits<LockPolicy>::SYNCHRONIZED)
 	{
-		Node* next = current->m_next;
-		ListIterationAction action = func(current->m_element);
-		if (action & ListIterationAction::ACTION_REMOVE)
+		size_t before = m_count.load(std::memory_order_relaxed);
+		m_count.store(m_size, std::memory_order_release);
+		if (before != m_size)
 		{
-			remove(current);
+			LockPolicyTraits<LockPolicy>::count_changed(m_lock, before, m_size);
 		}
-		if (action & ListIterationAction::ACTION_BREAK)
+	}
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+LockStamp BasicList<T, Allocator, LockPolicy>::lock(ListOperation operation) const
+{
+#ifdef SLIST_INSTRUMENTATION
+	// Only synchronized lists are instrumented, a List keeps calling NoLock directly
+	if (LockPolicyTraits<LockPolicy>::SYNCHRONIZED)
+	{
+		return m_instrumentation.lock(m_lock, operation);
+	}
+#endif
+	(void)operation;
+	m_lock.lock();
+	return LockStamp();
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+bool BasicList<T, Allocator, LockPolicy>::try_lock(ListOperation operation, LockStamp& stamp) const
+{
+#ifdef SLIST_INSTRUMENTATION
+	if (LockPolicyTraits<LockPolicy>::SYNCHRONIZED)
+	{
+		return m_instrumentation.try_lock(m_lock, operation, stamp);
+	}
+#endif
+	(void)operation;
+	(void)stamp;
+	return m_lock.try_lock();
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::unlock(const LockStamp& stamp) const
+{
+#ifdef SLIST_INSTRUMENTATION
+	if (LockPolicyTraits<LockPolicy>::SYNCHRONIZED)
+	{
+		m_instrumentation.unlock(m_lock, stamp, m_size);
+		return;
+	}
+#endif
+	(void)stamp;
+	m_lock.unlock();
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+LockStamp BasicList<T, Allocator, LockPolicy>::lock_shared(ListOperation operation) const
+{
+#ifdef SLIST_INSTRUMENTATION
+	if (LockPolicyTraits<LockPolicy>::SYNCHRONIZED)
+	{
+		return m_instrumentation.lock_shared(m_lock, operation);
+	}
+#endif
+	(void)operation;
+	m_lock.lock_shared();
+	return LockStamp();
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::unlock_shared(const LockStamp& stamp) const
+{
+#ifdef SLIST_INSTRUMENTATION
+	if (LockPolicyTraits<LockPolicy>::SYNCHRONIZED)
+	{
+		m_instrumentation.unlock_shared(m_lock, stamp);
+		return;
+	}
+#endif
+	(void)stamp;
+	m_lock.unlock_shared();
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::suspend_hold(LockStamp& stamp) const
+{
+#ifdef SLIST_INSTRUMENTATION
+	if (LockPolicyTraits<LockPolicy>::SYNCHRONIZED)
+	{
+		m_instrumentation.suspend(stamp);
+		return;
+	}
+#endif
+	(void)stamp;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::resume_hold(LockStamp& stamp) const
+{
+#ifdef SLIST_INSTRUMENTATION
+	if (LockPolicyTraits<LockPolicy>::SYNCHRONIZED)
+	{
+		m_instrumentation.resume(stamp);
+		return;
+	}
+#endif
+	(void)stamp;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename... Args>
+void BasicList<T, Allocator, LockPolicy>::emplace_back_unlocked(Args&&... args)
+{
+	link_back(create_node(std::forward<Args>(args)...));
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename... Args>
+void BasicList<T, Allocator, LockPolicy>::emplace_front_unlocked(Args&&... args)
+{
+	link_front(create_node(std::forward<Args>(args)...));
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+bool BasicList<T, Allocator, LockPolicy>::try_pop_back_unlocked(T& element)
+{
+	if (m_last)
+	{
+		element = std::move(m_last->m_element);
+		remove(m_last);
+		return true;
+	}
+	return false;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+bool BasicList<T, Allocator, LockPolicy>::try_pop_front_unlocked(T& element)
+{
+	if (m_first)
+	{
+		element = std::move(m_first->m_element);
+		remove(m_first);
+		return true;
+	}
+	return false;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+BasicList<T, Allocator, LockPolicy>::BasicList() : m_first(nullptr), m_last(nullptr), m_size(0), m_allocator(sizeof(Node), alignof(Node)),
+	m_reclaimers(0), m_destroyed(nullptr), m_cursors(nullptr), m_lock(), m_count(0)
+{
+	// Nothing to do yet
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+BasicList<T, Allocator, LockPolicy>::BasicList(const BasicList& other) : m_first(nullptr), m_last(nullptr), m_size(0),
+	m_allocator(sizeof(Node), alignof(Node)), m_reclaimers(0), m_destroyed(nullptr), m_cursors(nullptr), m_lock(), m_count(0)
+{
+	copy(other);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+BasicList<T, Allocator, LockPolicy>::BasicList(const BasicList<T, Allocator, OtherLock>& other) : m_first(nullptr), m_last(nullptr), m_size(0),
+	m_allocator(sizeof(Node), alignof(Node)), m_reclaimers(0), m_destroyed(nullptr), m_cursors(nullptr), m_lock(), m_count(0)
+{
+	copy(other);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+BasicList<T, Allocator, LockPolicy>::BasicList(BasicList&& other) : m_first(nullptr), m_last(nullptr), m_size(0),
+	m_allocator(sizeof(Node), alignof(Node)), m_reclaimers(0), m_destroyed(nullptr), m_cursors(nullptr), m_lock(), m_count(0)
+{
+	other.lock_list(false);
+	take(other);
+	other.unlock_list(false);
+	update_count();
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+BasicList<T, Allocator, LockPolicy>::BasicList(BasicList<T, Allocator, OtherLock>&& other) : m_first(nullptr), m_last(nullptr), m_size(0),
+	m_allocator(sizeof(Node), alignof(Node)), m_reclaimers(0), m_destroyed(nullptr), m_cursors(nullptr), m_lock(), m_count(0)
+{
+	other.lock_list(false);
+	take(other);
+	other.unlock_list(false);
+	update_count();
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<size_t N>
+BasicList<T, Allocator, LockPolicy>::BasicList(const T (&other)[N]) : m_first(nullptr), m_last(nullptr), m_size(0),
+	m_allocator(sizeof(Node), alignof(Node)), m_reclaimers(0), m_destroyed(nullptr), m_cursors(nullptr), m_lock(), m_count(0)
+{
+	copy(other);
+	update_count();
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+BasicList<T, Allocator, LockPolicy>::~BasicList()
+{
+	destroy_nodes();
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+size_t BasicList<T, Allocator, LockPolicy>::size() const
+{
+	if (LockPolicyTraits<LockPolicy>::SYNCHRONIZED)
+	{
+		return m_count.load(std::memory_order_acquire);
+	}
+	return m_size;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+bool BasicList<T, Allocator, LockPolicy>::empty() const
+{
+	return 0 == size();
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::clear()
+{
+	if (LockPolicyTraits<LockPolicy>::SYNCHRONIZED)
+	{
+		// Take over the nodes along with their memory in constant time, they are destroyed after unlocking
+		BasicList<T, Allocator, NoLock> detached;
+		LockStamp stamp = lock(OPERATION_CLEAR);
+		detached.take(*this);
+		update_count();
+		unlock(stamp);
+	}
+	else
+	{
+		LockStamp stamp = lock(OPERATION_CLEAR);
+		destroy_nodes();
+		update_count();
+		unlock(stamp);
+	}
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::push_back(const T& element)
+{
+	push(true, element);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::push_back(T&& element)
+{
+	push(true, std::move(element));
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename... Args>
+void BasicList<T, Allocator, LockPolicy>::emplace_back(Args&&... args)
+{
+	push(true, std::forward<Args>(args)...);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename InputIt, typename>
+void BasicList<T, Allocator, LockPolicy>::push_back(InputIt first, InputIt last)
+{
+	LockStamp stamp = lock(OPERATION_PUSH);
+	try
+	{
+		for (; first != last; ++first)
 		{
-			break;
+			link_back(create_node(*first));
+		}
+	}
+	catch (...)
+	{
+		// Keep the elements added so far and unlock the list, so it can still be used by other threads
+		update_count();
+		unlock(stamp);
+		throw;
+	}
+	update_count();
+	unlock(stamp);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+void BasicList<T, Allocator, LockPolicy>::append(BasicList<T, Allocator, OtherLock>&& other)
+{
+	if (static_cast<const void*>(this) == static_cast<const void*>(&other))
+	{
+		return;
+	}
+
+	lock_pair(false, other, false);
+	if (other.m_first)
+	{
+		other.quiesce();
+		if (m_first)
+		{
+			// List is not empty
+			m_last->m_next = other.m_first;
+			other.m_first->m_prev = m_last;
+			m_last = other.m_last;
+		}
+		else
+		{
+			// List is empty
+			m_first = other.m_first;
+			m_last = other.m_last;
+		}
+		m_size += other.m_size;
+		// The nodes belong to the allocator of the other list, so take its memory along with them
+		m_allocator.splice(other.m_allocator);
+
+		other.m_first = nullptr;
+		other.m_last = nullptr;
+		other.m_size = 0;
+		other.end_cursors();
+	}
+	unlock_pair(false, other, false);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::push_front(const T& element)
+{
+	push(false, element);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::push_front(T&& element)
+{
+	push(false, std::move(element));
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename... Args>
+void BasicList<T, Allocator, LockPolicy>::emplace_front(Args&&... args)
+{
+	push(false, std::forward<Args>(args)...);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+T BasicList<T, Allocator, LockPolicy>::pop_back()
+{
+	T element = T();
+	LockStamp stamp = lock(OPERATION_POP);
+	try_pop_back_unlocked(element);
+	update_count();
+	unlock(stamp);
+	return element;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+bool BasicList<T, Allocator, LockPolicy>::try_pop_back(T& element)
+{
+	LockStamp stamp = lock(OPERATION_POP);
+	bool ret = try_pop_back_unlocked(element);
+	update_count();
+	unlock(stamp);
+	return ret;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+bool BasicList<T, Allocator, LockPolicy>::try_lock_pop_back(T& element)
+{
+	LockStamp stamp;
+	if (!try_lock(OPERATION_POP, stamp))
+	{
+		return false;
+	}
+	bool ret = try_pop_back_unlocked(element);
+	update_count();
+	unlock(stamp);
+	return ret;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+T BasicList<T, Allocator, LockPolicy>::pop_front()
+{
+	T element = T();
+	LockStamp stamp = lock(OPERATION_POP);
+	try_pop_front_unlocked(element);
+	update_count();
+	unlock(stamp);
+	return element;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+bool BasicList<T, Allocator, LockPolicy>::try_pop_front(T& element)
+{
+	LockStamp stamp = lock(OPERATION_POP);
+	bool ret = try_pop_front_unlocked(element);
+	update_count();
+	unlock(stamp);
+	return ret;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+bool BasicList<T, Allocator, LockPolicy>::try_lock_pop_front(T& element)
+{
+	LockStamp stamp;
+	if (!try_lock(OPERATION_POP, stamp))
+	{
+		return false;
+	}
+	bool ret = try_pop_front_unlocked(element);
+	update_count();
+	unlock(stamp);
+	return ret;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename OutputIt>
+size_t BasicList<T, Allocator, LockPolicy>::pop_front_n(size_t count, OutputIt out)
+{
+	LockStamp stamp = lock(OPERATION_POP);
+	size_t removed = 0;
+	try
+	{
+		while (m_first && removed < count)
+		{
+			// The element stays in the list if it can't be assigned to the output
+			*out = std::move(m_first->m_element);
+			remove(m_first);
+			removed++;
+			++out;
+		}
+	}
+	catch (...)
+	{
+		update_count();
+		unlock(stamp);
+		throw;
+	}
+	update_count();
+	unlock(stamp);
+	return removed;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::remove(const T& element)
+{
+	// remove_if unlocks the list and reclaims the removed nodes if operator== throws
+	remove_if([&element](const T& current) -> bool { return element == current; });
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename Predicate>
+size_t BasicList<T, Allocator, LockPolicy>::remove_if(Predicate pred)
+{
+	LockStamp stamp = lock(OPERATION_REMOVE);
+	Node* retired = nullptr;
+	size_t count = 0;
+	try
+	{
+		Node* current = m_first;
+		while (current)
+		{
+			Node* next = current->m_next;
+			if (pred(current->m_element))
+			{
+				retire(current, retired);
+				count++;
+			}
+			current = next;
+		}
+	}
+	catch (...)
+	{
+		update_count();
+		unlock(stamp);
+		reclaim(retired);
+		throw;
+	}
+	update_count();
+	unlock(stamp);
+	reclaim(retired);
+	return count;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+size_t BasicList<T, Allocator, LockPolicy>::count(const T& element) const
+{
+	LockStamp stamp = lock_shared(OPERATION_ITERATE);
+	size_t count = 0;
+	try
+	{
+		for (const Node* current = m_first; current; current = current->m_next)
+		{
+			if (element == current->m_element)
+			{
+				count++;
+			}
+		}
+	}
+	catch (...)
+	{
+		unlock_shared(stamp);
+		throw;
+	}
+	unlock_shared(stamp);
+	return count;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+bool BasicList<T, Allocator, LockPolicy>::contains(const T& element) const
+{
+	LockStamp stamp = lock_shared(OPERATION_ITERATE);
+	const Node* current = m_first;
+	try
+	{
+		while (current && !(element == current->m_element))
+		{
+			current = current->m_next;
+		}
+	}
+	catch (...)
+	{
+		unlock_shared(stamp);
+		throw;
+	}
+	unlock_shared(stamp);
+	return nullptr != current;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+typename BasicList<T, Allocator, LockPolicy>::iterator BasicList<T, Allocator, LockPolicy>::find(const T& element)
+{
+	static_assert(!LockPolicyTraits<LockPolicy>::SYNCHRONIZED,
+		"Iterators can't be used without locking the list, use the iterators of locked_view instead");
+	Node* current = m_first;
+	while (current && !(element == current->m_element))
+	{
+		current = current->m_next;
+	}
+	return iterator(current, this);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+typename BasicList<T, Allocator, LockPolicy>::const_iterator BasicList<T, Allocator, LockPolicy>::find(
+	const T& element) const
+{
+	static_assert(!LockPolicyTraits<LockPolicy>::SYNCHRONIZED,
+		"Iterators can't be used without locking the list, use the iterators of locked_view instead");
+	Node* current = m_first;
+	while (current && !(element == current->m_element))
+	{
+		current = current->m_next;
+	}
+	return const_iterator(current, this);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::iterate(const IterationFunction& func, void* parameter)
+{
+	auto callFunction = [&func, parameter](T& element) -> ListIterationAction
+	{
+		return func(element, parameter);
+	};
+	iterate(callFunction);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::iterate(const ConstIterationFunction& func, void* parameter) const
+{
+	auto callFunction = [&func, parameter](const T& element) -> ListIterationAction
+	{
+		return func(element, parameter);
+	};
+	iterate(callFunction);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::iterate(const ConstIterationFunction& func, void* parameter)
+{
+	static_cast<const BasicList*>(this)->iterate(func, parameter);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename Lambda>
+void BasicList<T, Allocator, LockPolicy>::iterate(const Lambda& func)
+{
+	LockStamp stamp = lock(OPERATION_ITERATE);
+	Node* retired = nullptr;
+	try
+	{
+		iterate_nodes(func, retired);
+	}
+	catch (...)
+	{
+		// Elements removed before the callback threw stay removed
+		update_count();
+		unlock(stamp);
+		reclaim(retired);
+		throw;
+	}
+	update_count();
+	unlock(stamp);
+	reclaim(retired);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename Lambda>
+void BasicList<T, Allocator, LockPolicy>::iterate(const Lambda& func) const
+{
+	LockStamp stamp = lock_shared(OPERATION_ITERATE);
+	try
+	{
+		iterate_nodes(func);
+	}
+	catch (...)
+	{
+		unlock_shared(stamp);
+		throw;
+	}
+	unlock_shared(stamp);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+typename BasicList<T, Allocator, LockPolicy>::iterator BasicList<T, Allocator, LockPolicy>::begin()
+{
+	static_assert(!LockPolicyTraits<LockPolicy>::SYNCHRONIZED,
+		"Iterators can't be used without locking the list, use the iterators of locked_view instead");
+	return iterator(m_first, this);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+typename BasicList<T, Allocator, LockPolicy>::iterator BasicList<T, Allocator, LockPolicy>::end()
+{
+	static_assert(!LockPolicyTraits<LockPolicy>::SYNCHRONIZED,
+		"Iterators can't be used without locking the list, use the iterators of locked_view instead");
+	return iterator(nullptr, this);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+typename BasicList<T, Allocator, LockPolicy>::const_iterator BasicList<T, Allocator, LockPolicy>::begin() const
+{
+	static_assert(!LockPolicyTraits<LockPolicy>::SYNCHRONIZED,
+		"Iterators can't be used without locking the list, use the iterators of locked_view instead");
+	return const_iterator(m_first, this);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+typename BasicList<T, Allocator, LockPolicy>::const_iterator BasicList<T, Allocator, LockPolicy>::end() const
+{
+	static_assert(!LockPolicyTraits<LockPolicy>::SYNCHRONIZED,
+		"Iterators can't be used without locking the list, use the iterators of locked_view instead");
+	return const_iterator(nullptr, this);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+typename BasicList<T, Allocator, LockPolicy>::iterator BasicList<T, Allocator, LockPolicy>::erase(const_iterator position)
+{
+	static_assert(!LockPolicyTraits<LockPolicy>::SYNCHRONIZED,
+		"Iterators can't be used without locking the list, use the iterators of locked_view instead");
+	Node* next = position.m_node->m_next;
+	remove(position.m_node);
+	return iterator(next, this);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+typename BasicList<T, Allocator, LockPolicy>::LockedView BasicList<T, Allocator, LockPolicy>::locked_view()
+{
+	return LockedView(this);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+typename BasicList<T, Allocator, LockPolicy>::ConstLockedView BasicList<T, Allocator, LockPolicy>::locked_view() const
+{
+	return ConstLockedView(this);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+void BasicList<T, Allocator, LockPolicy>::swap(BasicList<T, Allocator, OtherLock>& other)
+{
+	if (static_cast<const void*>(this) != static_cast<const void*>(&other))
+	{
+		lock_pair(false, other, false);
+		quiesce();
+		other.quiesce();
+		std::swap(m_first, other.m_first);
+		std::swap(m_last, other.m_last);
+		std::swap(m_size, other.m_size);
+		// The nodes belong to the allocators, so exchange the allocators along with them
+		m_allocator.swap(other.m_allocator);
+		end_cursors();
+		other.end_cursors();
+		unlock_pair(false, other, false);
+	}
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename Compare>
+void BasicList<T, Allocator, LockPolicy>::sort(Compare comp)
+{
+	LockStamp stamp = lock(OPERATION_OTHER);
+	try
+	{
+		sort_nodes(comp);
+	}
+	catch (...)
+	{
+		unlock(stamp);
+		throw;
+	}
+	unlock(stamp);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename Compare, typename OtherLock>
+void BasicList<T, Allocator, LockPolicy>::merge(BasicList<T, Allocator, OtherLock>&& other, Compare comp)
+{
+	if (static_cast<const void*>(this) == static_cast<const void*>(&other))
+	{
+		return;
+	}
+
+	lock_pair(false, other, false);
+	Node* second = other.m_first;
+	if (second)
+	{
+		// The nodes belong to the allocator of the other list, so take its memory along with them
+		other.quiesce();
+		m_size += other.m_size;
+		m_allocator.splice(other.m_allocator);
+		other.m_first = nullptr;
+		other.m_last = nullptr;
+		other.m_size = 0;
+		other.end_cursors();
+		try
+		{
+			merge_nodes(m_first, second, comp);
+		}
+		catch (...)
+		{
+			relink();
+			unlock_pair(false, other, false);
+			throw;
 		}
+		relink();
+	}
+	unlock_pair(false, other, false);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename BinaryPredicate>
+size_t BasicList<T, Allocator, LockPolicy>::unique(BinaryPredicate pred)
+{
+	LockStamp stamp = lock(OPERATION_REMOVE);
+	Node* retired = nullptr;
+	size_t count = 0;
+	try
+	{
+		Node* current = m_first;
+		while (current && current->m_next)
+		{
+			if (pred(current->m_element, current->m_next->m_element))
+			{
+				retire(current->m_next, retired);
+				count++;
+			}
+			else
+			{
+				current = current->m_next;
+			}
+		}
+	}
+	catch (...)
+	{
+		update_count();
+		unlock(stamp);
+		reclaim(retired);
+		throw;
+	}
+	update_count();
+	unlock(stamp);
+	reclaim(retired);
+	return count;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::reverse()
+{
+	LockStamp stamp = lock(OPERATION_OTHER);
+	Node* current = m_first;
+	while (current)
+	{
+		Node* next = current->m_next;
+		current->m_next = current->m_prev;
+		current->m_prev = next;
 		current = next;
 	}
+	std::swap(m_first, m_last);
+	unlock(stamp);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::reserve(size_t count)
+{
+	LockStamp stamp = lock(OPERATION_OTHER);
+	m_allocator.reserve(count);
+	unlock(stamp);
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+bool BasicList<T, Allocator, LockPolicy>::save(ListWriter<T>& writer) const
+{
+	if (!LockPolicyTraits<LockPolicy>::SYNCHRONIZED)
+	{
+		for (const Node* current = m_first; current; current = current->m_next)
+		{
+			if (!writer.write(current->m_element))
+			{
+				return false;
+			}
+		}
+		return writer.is_open();
+	}
+
+	const size_t chunkSize = sizeof(T) < SAVE_CHUNK_SIZE ? SAVE_CHUNK_SIZE / sizeof(T) : 1;
+	std::vector<T> chunk;
+	chunk.reserve(chunkSize);
+
+	// Methods removing the next node to write move the cursor to the node behind it
+	SaveCursor cursor;
+	LockStamp stamp = lock(OPERATION_ITERATE);
+	cursor.m_node = m_first;
+	cursor.m_next = m_cursors;
+	m_cursors = &cursor;
+	unlock(stamp);
+
+	bool written = true;
+	bool done = false;
+	try
+	{
+		while (written && !done)
+		{
+			chunk.clear();
+			stamp = lock_shared(OPERATION_ITERATE);
+			try
+			{
+				for (; cursor.m_node && chunk.size() < chunkSize; cursor.m_node = cursor.m_node->m_next)
+				{
+					chunk.push_back(cursor.m_node->m_element);
+				}
+				done = !cursor.m_node;
+			}
+			catch (...)
+			{
+				unlock_shared(stamp);
+				throw;
+			}
+			unlock_shared(stamp);
+			written = writer.write(chunk.data(), chunk.size());
+		}
+	}
+	catch (...)
+	{
+		remove_cursor(&cursor);
+		throw;
+	}
+	remove_cursor(&cursor);
+	return written && writer.is_open();
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+bool BasicList<T, Allocator, LockPolicy>::save(const char* path) const
+{
+	ListWriter<T> writer(path);
+	bool saved = save(writer);
+	return writer.close() && saved;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+bool BasicList<T, Allocator, LockPolicy>::load(const char* path)
+{
+	ListReader<T> reader(path);
+	if (!reader.is_open())
+	{
+		return false;
+	}
+
+	BasicList<T, Allocator, NoLock> loaded;
+	loaded.reserve(reader.size());
+	T element = T();
+	while (reader.read(element))
+	{
+		loaded.push_back(std::move(element));
+	}
+	if (!reader.done())
+	{
+		return false;
+	}
+	append(std::move(loaded));
+	return true;
+}
+
+#ifdef SLIST_INSTRUMENTATION
+template<typename T, typename Allocator, typename LockPolicy>
+ListStatistics BasicList<T, Allocator, LockPolicy>::statistics() const
+{
+	return m_instrumentation.snapshot();
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+void BasicList<T, Allocator, LockPolicy>::reset_statistics()
+{
+	m_instrumentation.reset();
+}
+#endif
+
+template<typename T, typename Allocator, typename LockPolicy>
+BasicList<T, Allocator, LockPolicy>& BasicList<T, Allocator, LockPolicy>::operator=(const BasicList& other)
+{
+	copy(other);
+	return *this;
 }
 
-template<typename T>
-List<T>& List<T>::operator=(const List<T>& other)
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+BasicList<T, Allocator, LockPolicy>& BasicList<T, Allocator, LockPolicy>::operator=(const BasicList<T, Allocator, OtherLock>& other)
 {
 	copy(other);
 	return *this;
 }
 
-template<typename T>
-bool List<T>::operator==(const List<T>& other)
+template<typename T, typename Allocator, typename LockPolicy>
+BasicList<T, Allocator, LockPolicy>& BasicList<T, Allocator, LockPolicy>::operator=(BasicList&& other)
+{
+	if (this != &other)
+	{
+		lock_pair(false, other, false);
+		destroy_nodes();
+		take(other);
+		unlock_pair(false, other, false);
+	}
+	return *this;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+BasicList<T, Allocator, LockPolicy>& BasicList<T, Allocator, LockPolicy>::operator=(BasicList<T, Allocator, OtherLock>&& other)
+{
+	if (static_cast<const void*>(this) != static_cast<const void*>(&other))
+	{
+		lock_pair(false, other, false);
+		destroy_nodes();
+		take(other);
+		unlock_pair(false, other, false);
+	}
+	return *this;
+}
+
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+bool BasicList<T, Allocator, LockPolicy>::operator==(const BasicList<T, Allocator, OtherLock>& other) const
 {
 	return equals(other);
 }
 
-template<typename T>
-bool List<T>::operator!=(const List<T>& other)
+template<typename T, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+bool BasicList<T, Allocator, LockPolicy>::operator!=(const BasicList<T, Allocator, OtherLock>& other) const
 {
 	return !equals(other);
 }
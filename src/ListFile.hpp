@@ -0,0 +1,301 @@
+/**
+ * @file ListFile.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef LISTFILE_HPP
+#define LISTFILE_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include "MappedFile.hpp"
+
+
+/**
+ * @class ListFileHeader
+ * Header at the beginning of a list file. The elements follow directly behind the header, either as one contiguous
+ * block of m_count * m_elementSize bytes or one by one as written by ListSerializer. All values are stored in the byte
+ * order of the writer.
+ */
+struct ListFileHeader
+{
+	// Identifies complete list files, it is only written after all elements were written successfully
+	char		m_magic[4];
+	// Version of the format
+	uint32_t	m_version;
+	// BYTE_ORDER_MARK in the byte order of the writer, files written with another byte order are rejected
+	uint32_t	m_byteOrder;
+	// Size of an element in bytes if the elements are stored as one contiguous block, 0 if they are stored one by one
+	uint32_t	m_elementSize;
+	// Count of elements in the file
+	uint64_t	m_count;
+
+	// Current version of the format
+	static const uint32_t VERSION = 1;
+	// Value of m_byteOrder
+	static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+};
+
+
+/**
+ * @class ListSerializer
+ * Writes elements to list files and reads them back. Trivially copyable elements are stored as their bytes, so the
+ * elements of a list are stored as one contiguous block. Specialize the class for other types, every element has to
+ * take at least MIN_ENCODED_SIZE bytes. The specialization for std::basic_string stores the length of every string in
+ * front of its characters.
+ * @tparam	T	Type of the elements
+ */
+template<typename T>
+struct ListSerializer
+{
+	static_assert(std::is_trivially_copyable<T>::value,
+		"Elements which are not trivially copyable need a specialization of ListSerializer");
+
+	/**
+	 * true if every element is stored as sizeof(T) bytes, so an array of elements can be written at once.
+	 */
+	static const bool CONTIGUOUS = true;
+
+	/**
+	 * Count of bytes every element takes at least, it bounds the count of elements a file can contain.
+	 */
+	static const size_t MIN_ENCODED_SIZE = sizeof(T);
+
+	/**
+	 * Writes an element.
+	 * @param	writer	Writer to pass the bytes of the element to
+	 * @param	element	Element to write
+	 */
+	template<typename Writer>
+	static void write(Writer& writer, const T& element) { writer.write_bytes(&element, sizeof(T)); }
+
+	/**
+	 * Reads an element.
+	 * @param	reader	Reader to take the bytes of the element from
+	 * @param	element	Receives the element
+	 * @return			true if the element was read, false if the file is truncated
+	 */
+	template<typename Reader>
+	static bool read(Reader& reader, T& element) { return reader.read_bytes(&element, sizeof(T)); }
+};
+
+
+/**
+ * @class ListSerializer
+ * Writes strings as their length followed by their characters.
+ */
+template<typename Char, typename Traits, typename StringAllocator>
+struct ListSerializer<std::basic_string<Char, Traits, StringAllocator>>
+{
+	static_assert(std::is_trivially_copyable<Char>::value, "The characters of the strings must be trivially copyable");
+
+	typedef std::basic_string<Char, Traits, StringAllocator> String;
+
+	/**
+	 * false since the strings have different lengths.
+	 */
+	static const bool CONTIGUOUS = false;
+
+	/**
+	 * Count of bytes of the length, empty strings take no further bytes.
+	 */
+	static const size_t MIN_ENCODED_SIZE = sizeof(uint64_t);
+
+	/**
+	 * Writes the length of a string and its characters.
+	 * @param	writer	Writer to pass the bytes of the string to
+	 * @param	element	String to write
+	 */
+	template<typename Writer>
+	static void write(Writer& writer, const String& element);
+
+	/**
+	 * Reads the length of a string and its characters.
+	 * @param	reader	Reader to take the bytes of the string from
+	 * @param	element	Receives the string
+	 * @return			true if the string was read, false if the file is truncated or the length is corrupted
+	 */
+	template<typename Reader>
+	static bool read(Reader& reader, String& element);
+};
+
+
+/**
+ * @class ListWriter
+ * Writes elements to a list file one by one or in arrays. The elements are collected in a buffer which is written to
+ * the file whenever it is full, so a list of any size can be written without copying it. The header is written when
+ * the writer is closed; files which were not closed or whose writes failed can't be loaded.
+ * @tparam	T	Type of the elements
+ */
+template<typename T>
+class ListWriter
+{
+private:
+	// Size of the buffer in bytes, larger arrays are written without copying them to the buffer
+	static const size_t BUFFER_SIZE = 1 << 16;
+
+	// File to write to, nullptr if it couldn't be opened or after closing the writer
+	std::FILE*		m_file;
+	// Count of elements written so far
+	uint64_t		m_count;
+	// true if a write failed
+	bool			m_failed;
+	// Bytes in m_buffer
+	size_t			m_used;
+	// Buffer for small writes
+	unsigned char*	m_buffer;
+
+	/**
+	 * Writes the buffer to the file.
+	 */
+	void flush();
+
+public:
+	/**
+	 * Constructor for instances of the class ListWriter. Creates the file or truncates it if it exists.
+	 * @param	path	Path of the file
+	 */
+	explicit ListWriter(const char* path);
+
+	/**
+	 * Destructor for instances of the class ListWriter. If the writer wasn't closed, e.g. since an exception was thrown
+	 * while writing, the file is left incomplete.
+	 */
+	~ListWriter();
+
+	/**
+	 * Checks if the file could be opened and all writes succeeded so far.
+	 * @return	true if the file can be written, otherwise false
+	 */
+	bool is_open() const;
+
+	/**
+	 * Returns the count of elements written so far.
+	 * @return	The count of written elements
+	 */
+	size_t count() const;
+
+	/**
+	 * Writes an element.
+	 * @param	element	Element to write
+	 * @return			true if the file can still be written, false if a write failed
+	 */
+	bool write(const T& element);
+
+	/**
+	 * Writes an array of elements. Arrays of trivially copyable elements are written in one piece.
+	 * @param	elements	Array to write
+	 * @param	count		Count of elements in the array
+	 * @return				true if the file can still be written, false if a write failed
+	 */
+	bool write(const T* elements, size_t count);
+
+	/**
+	 * Writes a range of elements.
+	 * @param	first	Iterator to the first element of the range
+	 * @param	last	Iterator behind the last element of the range
+	 * @return			true if the file can still be written, false if a write failed
+	 */
+	template<typename InputIt>
+	bool write(InputIt first, InputIt last);
+
+	/**
+	 * Writes raw bytes, it is called by ListSerializer.
+	 * @param	data	Bytes to write
+	 * @param	size	Count of bytes
+	 */
+	void write_bytes(const void* data, size_t size);
+
+	/**
+	 * Writes the remaining buffer and the header and closes the file.
+	 * @return	true if all elements were written successfully, otherwise false
+	 */
+	bool close();
+
+	// Instances of ListWriter own their file and can't be copied
+	ListWriter(const ListWriter&) = delete;
+	ListWriter& operator=(const ListWriter&) = delete;
+};
+
+
+/**
+ * @class ListReader
+ * Reads the elements of a list file one by one. The file is mapped into memory and checked when the reader is
+ * constructed: its header has to match the element type and, for contiguous elements, the size of the file has to match
+ * the count of elements.
+ * @tparam	T	Type of the elements
+ */
+template<typename T>
+class ListReader
+{
+private:
+	// Mapped file
+	MappedFile				m_file;
+	// Next byte to read
+	const unsigned char*	m_cursor;
+	// End of the file
+	const unsigned char*	m_end;
+	// Count of elements in the file
+	size_t					m_count;
+	// Count of elements read so far
+	size_t					m_read;
+	// true if the header is valid and no element was truncated
+	bool					m_valid;
+
+public:
+	/**
+	 * Constructor for instances of the class ListReader. Maps the file and checks its header.
+	 * @param	path	Path of the file
+	 */
+	explicit ListReader(const char* path);
+
+	/**
+	 * Checks if the file could be opened and is a valid list file for elements of type T.
+	 * @return	true if the elements can be read, otherwise false
+	 */
+	bool is_open() const;
+
+	/**
+	 * Returns the count of elements in the file.
+	 * @return	The count of elements in the file
+	 */
+	size_t size() const;
+
+	/**
+	 * Checks if all elements were read and the file doesn't contain any bytes behind them.
+	 * @return	true if the whole file was read successfully, otherwise false
+	 */
+	bool done() const;
+
+	/**
+	 * Returns the count of bytes which haven't been read yet, e.g. to check lengths read by ListSerializer.
+	 * @return	The count of remaining bytes
+	 */
+	size_t remaining() const;
+
+	/**
+	 * Reads the next element.
+	 * @param	element	Receives the element
+	 * @return			true if an element was read, false if all elements were read or the file is corrupted
+	 */
+	bool read(T& element);
+
+	/**
+	 * Reads raw bytes, it is called by ListSerializer.
+	 * @param	data	Receives the bytes
+	 * @param	size	Count of bytes
+	 * @return			true if the bytes were read, false if the file is truncated
+	 */
+	bool read_bytes(void* data, size_t size);
+};
+
+
+// Include implementation of ListSerializer, ListWriter and ListReader
+#include "ListFile.tpp"
+
+
+#endif // #ifndef LISTFILE_HPP
@@ -0,0 +1,240 @@
+/**
+ * @file ListFile.tpp
+ * @date 17.10.2026
+ */
+
+#ifndef LISTFILE_HPP
+#error LISTFILE_HPP undefined
+#endif
+
+#include <cstring>
+
+// Magic bytes of complete list files
+static const char LIST_FILE_MAGIC[4] = { 'S', 'L', 'S', 'T' };
+
+template<typename Char, typename Traits, typename StringAllocator>
+template<typename Writer>
+void ListSerializer<std::basic_string<Char, Traits, StringAllocator>>::write(Writer& writer, const String& element)
+{
+	uint64_t length = element.size();
+	writer.write_bytes(&length, sizeof(length));
+	writer.write_bytes(element.data(), element.size() * sizeof(Char));
+}
+
+template<typename Char, typename Traits, typename StringAllocator>
+template<typename Reader>
+bool ListSerializer<std::basic_string<Char, Traits, StringAllocator>>::read(Reader& reader, String& element)
+{
+	uint64_t length = 0;
+	// Check the length before resizing the string, so a corrupted length doesn't allocate huge amounts of memory
+	if (!reader.read_bytes(&length, sizeof(length)) || length > reader.remaining() / sizeof(Char))
+	{
+		return false;
+	}
+	element.resize(static_cast<size_t>(length));
+	return 0 == length || reader.read_bytes(&element[0], static_cast<size_t>(length) * sizeof(Char));
+}
+
+template<typename T>
+void ListWriter<T>::flush()
+{
+	if (m_used > 0 && m_file && !m_failed)
+	{
+		m_failed = m_used != std::fwrite(m_buffer, 1, m_used, m_file);
+	}
+	m_used = 0;
+}
+
+template<typename T>
+ListWriter<T>::ListWriter(const char* path) : m_file(std::fopen(path, "wb")), m_count(0), m_failed(false), m_used(0),
+	m_buffer(new unsigned char[BUFFER_SIZE])
+{
+	// Reserve space for the header, it is written by close
+	ListFileHeader header;
+	std::memset(&header, 0, sizeof(header));
+	m_failed = !m_file || 1 != std::fwrite(&header, sizeof(header), 1, m_file);
+}
+
+template<typename T>
+ListWriter<T>::~ListWriter()
+{
+	// The header is not written, so files of writers which were not closed can't be loaded
+	if (m_file)
+	{
+		std::fclose(m_file);
+	}
+	delete[] m_buffer;
+}
+
+template<typename T>
+bool ListWriter<T>::is_open() const
+{
+	return m_file && !m_failed;
+}
+
+template<typename T>
+size_t ListWriter<T>::count() const
+{
+	return static_cast<size_t>(m_count);
+}
+
+template<typename T>
+bool ListWriter<T>::write(const T& element)
+{
+	ListSerializer<T>::write(*this, element);
+	m_count++;
+	return is_open();
+}
+
+template<typename T>
+bool ListWriter<T>::write(const T* elements, size_t count)
+{
+	if (ListSerializer<T>::CONTIGUOUS)
+	{
+		write_bytes(elements, count * sizeof(T));
+		m_count += count;
+		return is_open();
+	}
+	return write(elements, elements + count);
+}
+
+template<typename T>
+template<typename InputIt>
+bool ListWriter<T>::write(InputIt first, InputIt last)
+{
+	for (; first != last && is_open(); ++first)
+	{
+		write(*first);
+	}
+	return is_open();
+}
+
+template<typename T>
+void ListWriter<T>::write_bytes(const void* data, size_t size)
+{
+	if (0 == size)
+	{
+		return;
+	}
+	if (m_used + size > BUFFER_SIZE)
+	{
+		flush();
+	}
+	if (size >= BUFFER_SIZE)
+	{
+		// Write large arrays directly instead of copying them to the buffer first
+		if (m_file && !m_failed)
+		{
+			m_failed = size != std::fwrite(data, 1, size, m_file);
+		}
+		return;
+	}
+	std::memcpy(m_buffer + m_used, data, size);
+	m_used += size;
+}
+
+template<typename T>
+bool ListWriter<T>::close()
+{
+	if (!m_file)
+	{
+		return false;
+	}
+	flush();
+
+	// The magic bytes mark the file as complete, so they are only written if all elements were written
+	if (!m_failed)
+	{
+		ListFileHeader header;
+		std::memcpy(header.m_magic, LIST_FILE_MAGIC, sizeof(header.m_magic));
+		header.m_version = ListFileHeader::VERSION;
+		header.m_byteOrder = ListFileHeader::BYTE_ORDER_MARK;
+		header.m_elementSize = ListSerializer<T>::CONTIGUOUS ? static_cast<uint32_t>(sizeof(T)) : 0;
+		header.m_count = m_count;
+		m_failed = 0 != std::fseek(m_file, 0, SEEK_SET) || 1 != std::fwrite(&header, sizeof(header), 1, m_file);
+	}
+	m_failed = 0 != std::fclose(m_file) || m_failed;
+	m_file = nullptr;
+	return !m_failed;
+}
+
+template<typename T>
+ListReader<T>::ListReader(const char* path) : m_file(path), m_cursor(nullptr), m_end(nullptr), m_count(0), m_read(0),
+	m_valid(false)
+{
+	ListFileHeader header;
+	if (!m_file.is_open() || m_file.size() < sizeof(header))
+	{
+		return;
+	}
+	std::memcpy(&header, m_file.data(), sizeof(header));
+	m_cursor = m_file.data() + sizeof(header);
+	m_end = m_file.data() + m_file.size();
+
+	const uint32_t elementSize = ListSerializer<T>::CONTIGUOUS ? static_cast<uint32_t>(sizeof(T)) : 0;
+	if (0 != std::memcmp(header.m_magic, LIST_FILE_MAGIC, sizeof(header.m_magic)) ||
+		ListFileHeader::VERSION != header.m_version || ListFileHeader::BYTE_ORDER_MARK != header.m_byteOrder ||
+		elementSize != header.m_elementSize || header.m_count > static_cast<size_t>(-1))
+	{
+		return;
+	}
+	m_count = static_cast<size_t>(header.m_count);
+
+	// The size of files with contiguous elements is known, so truncated files are rejected before reading them. Other
+	// elements take at least MIN_ENCODED_SIZE bytes, so a corrupted count can't make a list reserve more nodes than
+	// the file could contain.
+	m_valid = ListSerializer<T>::CONTIGUOUS ? 0 == remaining() % sizeof(T) && remaining() / sizeof(T) == m_count :
+		m_count <= remaining() / ListSerializer<T>::MIN_ENCODED_SIZE;
+}
+
+template<typename T>
+bool ListReader<T>::is_open() const
+{
+	return m_valid;
+}
+
+template<typename T>
+size_t ListReader<T>::size() const
+{
+	return m_count;
+}
+
+template<typename T>
+bool ListReader<T>::done() const
+{
+	return m_valid && m_read == m_count && m_cursor == m_end;
+}
+
+template<typename T>
+size_t ListReader<T>::remaining() const
+{
+	return static_cast<size_t>(m_end - m_cursor);
+}
+
+template<typename T>
+bool ListReader<T>::read(T& element)
+{
+	if (!m_valid || m_read == m_count)
+	{
+		return false;
+	}
+	if (!ListSerializer<T>::read(*this, element))
+	{
+		m_valid = false;
+		return false;
+	}
+	m_read++;
+	return true;
+}
+
+template<typename T>
+bool ListReader<T>::read_bytes(void* data, size_t size)
+{
+	if (size > remaining())
+	{
+		return false;
+	}
+	std::memcpy(data, m_cursor, size);
+	m_cursor += size;
+	return true;
+}
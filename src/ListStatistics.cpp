@@ -0,0 +1,113 @@
+/**
+ * @file ListStatistics.cpp
+ * @date 17.10.2026
+ */
+
+#include "ListStatistics.hpp"
+
+#ifdef SLIST_INSTRUMENTATION
+
+/**
+ * Raises an atomic maximum to a given value.
+ * @param	maximum	Maximum to raise
+ * @param	value	Value to compare to
+ */
+static void update_maximum(std::atomic<uint64_t>& maximum, uint64_t value)
+{
+	uint64_t current = maximum.load(std::memory_order_relaxed);
+	while (value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed))
+	{
+		// current was updated by compare_exchange_weak, try again
+	}
+}
+
+void ListInstrumentation::record_lock(ListOperation operation, bool contended, uint64_t waitTime)
+{
+	m_operations[operation].fetch_add(1, std::memory_order_relaxed);
+	m_lockAcquisitions.fetch_add(1, std::memory_order_relaxed);
+	if (contended)
+	{
+		m_contendedAcquisitions.fetch_add(1, std::memory_order_relaxed);
+		m_waitTime.fetch_add(waitTime, std::memory_order_relaxed);
+		update_maximum(m_maxWaitTime, waitTime);
+	}
+}
+
+void ListInstrumentation::record_hold(const LockStamp& stamp)
+{
+	if (LockStamp() == stamp)
+	{
+		return;
+	}
+
+	uint64_t holdTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+		stamp).count();
+	m_holdTime.fetch_add(holdTime, std::memory_order_relaxed);
+	update_maximum(m_maxHoldTime, holdTime);
+
+	// Bucket 0 counts holds shorter than 1 us, every further bucket covers ten times the duration
+	size_t bucket = 0;
+	for (uint64_t limit = 1000; holdTime >= limit && bucket + 1 < ListStatistics::HISTOGRAM_BUCKETS; limit *= 10)
+	{
+		bucket++;
+	}
+	m_holdHistogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+ListInstrumentation::ListInstrumentation()
+{
+	reset();
+}
+
+void ListInstrumentation::suspend(LockStamp& stamp)
+{
+	record_hold(stamp);
+	stamp = LockStamp();
+}
+
+void ListInstrumentation::resume(LockStamp& stamp)
+{
+	stamp = std::chrono::steady_clock::now();
+}
+
+ListStatistics ListInstrumentation::snapshot() const
+{
+	ListStatistics statistics;
+	for (size_t i = 0; i < OPERATION_COUNT; i++)
+	{
+		statistics.m_operations[i] = m_operations[i].load(std::memory_order_relaxed);
+	}
+	statistics.m_lockAcquisitions = m_lockAcquisitions.load(std::memory_order_relaxed);
+	statistics.m_contendedAcquisitions = m_contendedAcquisitions.load(std::memory_order_relaxed);
+	statistics.m_waitTime = m_waitTime.load(std::memory_order_relaxed);
+	statistics.m_maxWaitTime = m_maxWaitTime.load(std::memory_order_relaxed);
+	statistics.m_holdTime = m_holdTime.load(std::memory_order_relaxed);
+	statistics.m_maxHoldTime = m_maxHoldTime.load(std::memory_order_relaxed);
+	statistics.m_peakSize = m_peakSize.load(std::memory_order_relaxed);
+	for (size_t i = 0; i < ListStatistics::HISTOGRAM_BUCKETS; i++)
+	{
+		statistics.m_holdHistogram[i] = m_holdHistogram[i].load(std::memory_order_relaxed);
+	}
+	return statistics;
+}
+
+void ListInstrumentation::reset()
+{
+	for (size_t i = 0; i < OPERATION_COUNT; i++)
+	{
+		m_operations[i].store(0, std::memory_order_relaxed);
+	}
+	m_lockAcquisitions.store(0, std::memory_order_relaxed);
+	m_contendedAcquisitions.store(0, std::memory_order_relaxed);
+	m_waitTime.store(0, std::memory_order_relaxed);
+	m_maxWaitTime.store(0, std::memory_order_relaxed);
+	m_holdTime.store(0, std::memory_order_relaxed);
+	m_maxHoldTime.store(0, std::memory_order_relaxed);
+	m_peakSize.store(0, std::memory_order_relaxed);
+	for (size_t i = 0; i < ListStatistics::HISTOGRAM_BUCKETS; i++)
+	{
+		m_holdHistogram[i].store(0, std::memory_order_relaxed);
+	}
+}
+
+#endif // #ifdef SLIST_INSTRUMENTATION
@@ -0,0 +1,251 @@
+/**
+ * @file ListStatistics.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef LISTSTATISTICS_HPP
+#define LISTSTATISTICS_HPP
+
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+
+/**
+ * @enum ListOperation
+ * Kinds of operations counted by the instrumentation of SList.
+ */
+enum ListOperation : unsigned char
+{
+	OPERATION_PUSH		= 0,
+	OPERATION_POP		= 1,
+	OPERATION_REMOVE	= 2,
+	OPERATION_ITERATE	= 3,
+	OPERATION_CLEAR		= 4,
+	// Locked views of the list
+	OPERATION_VIEW		= 5,
+	// Sorting, assigning, comparing, swapping and merging lists
+	OPERATION_OTHER		= 6,
+	OPERATION_COUNT		= 7
+};
+
+
+/**
+ * @class ListStatistics
+ * Snapshot of the counters of an instrumented SList. Times are in nanoseconds.
+ */
+struct ListStatistics
+{
+	// Count of buckets of the hold time histogram
+	static const size_t HISTOGRAM_BUCKETS = 8;
+
+	// Count of operations per kind, indexed by ListOperation
+	uint64_t	m_operations[OPERATION_COUNT];
+	// Count of successful lock acquisitions in exclusive and in shared mode
+	uint64_t	m_lockAcquisitions;
+	// Count of lock acquisitions which had to wait since try_lock failed, including failed try_lock_pop calls
+	uint64_t	m_contendedAcquisitions;
+	// Cumulative time spent waiting for the lock
+	uint64_t	m_waitTime;
+	// Longest time spent waiting for the lock
+	uint64_t	m_maxWaitTime;
+	// Cumulative time the lock was held
+	uint64_t	m_holdTime;
+	// Longest time the lock was held at once
+	uint64_t	m_maxHoldTime;
+	// Largest count of elements in the list
+	size_t		m_peakSize;
+	// Count of lock holds by duration: < 1 us, < 10 us, < 100 us, < 1 ms, < 10 ms, < 100 ms, < 1 s and >= 1 s
+	uint64_t	m_holdHistogram[HISTOGRAM_BUCKETS];
+};
+
+
+#ifdef SLIST_INSTRUMENTATION
+
+// Point in time at which a lock was acquired
+typedef std::chrono::steady_clock::time_point LockStamp;
+
+
+/**
+ * @class ListInstrumentation
+ * Counters of an instrumented SList. All counters are updated with relaxed atomic operations, so a snapshot taken
+ * while other threads use the list may be slightly inconsistent.
+ */
+class ListInstrumentation
+{
+private:
+	std::atomic<uint64_t>	m_operations[OPERATION_COUNT];
+	std::atomic<uint64_t>	m_lockAcquisitions;
+	std::atomic<uint64_t>	m_contendedAcquisitions;
+	std::atomic<uint64_t>	m_waitTime;
+	std::atomic<uint64_t>	m_maxWaitTime;
+	std::atomic<uint64_t>	m_holdTime;
+	std::atomic<uint64_t>	m_maxHoldTime;
+	std::atomic<size_t>		m_peakSize;
+	std::atomic<uint64_t>	m_holdHistogram[ListStatistics::HISTOGRAM_BUCKETS];
+
+	/**
+	 * Counts a lock acquisition.
+	 * @param	operation	Operation which locked the list
+	 * @param	contended	true if the lock had to wait
+	 * @param	waitTime	Time spent waiting for the lock
+	 */
+	void record_lock(ListOperation operation, bool contended, uint64_t waitTime);
+
+	/**
+	 * Adds the time a lock was held to the counters and to the histogram.
+	 * @param	stamp	Point in time at which the lock was acquired, a default-constructed stamp records nothing
+	 */
+	void record_hold(const LockStamp& stamp);
+
+public:
+	/**
+	 * Default constructor for instances of the class ListInstrumentation. All counters are zero.
+	 */
+	ListInstrumentation();
+
+	/**
+	 * Locks a mutex exclusively and counts the acquisition. The mutex is locked by try_lock first, so contended
+	 * acquisitions and their wait time can be told apart.
+	 * @param	mutex		Mutex to lock
+	 * @param	operation	Operation which locks the mutex
+	 * @return				Point in time at which the mutex was locked
+	 */
+	template<typename MutexType>
+	LockStamp lock(MutexType& mutex, ListOperation operation);
+
+	/**
+	 * Locks a mutex in shared mode and counts the acquisition.
+	 * @param	mutex		Mutex to lock
+	 * @param	operation	Operation which locks the mutex
+	 * @return				Point in time at which the mutex was locked
+	 */
+	template<typename MutexType>
+	LockStamp lock_shared(MutexType& mutex, ListOperation operation);
+
+	/**
+	 * Tries to lock a mutex exclusively without waiting. A failed attempt is counted as contended.
+	 * @param	mutex		Mutex to lock
+	 * @param	operation	Operation which locks the mutex
+	 * @param	stamp		Receives the point in time at which the mutex was locked
+	 * @return				true if the mutex was locked, otherwise false
+	 */
+	template<typename MutexType>
+	bool try_lock(MutexType& mutex, ListOperation operation, LockStamp& stamp);
+
+	/**
+	 * Records the hold time and the size of the list and unlocks a mutex locked exclusively.
+	 * @param	mutex	Mutex to unlock
+	 * @param	stamp	Stamp returned when the mutex was locked
+	 * @param	size	Count of elements in the list
+	 */
+	template<typename MutexType>
+	void unlock(MutexType& mutex, const LockStamp& stamp, size_t size);
+
+	/**
+	 * Records the hold time and unlocks a mutex locked in shared mode.
+	 * @param	mutex	Mutex to unlock
+	 * @param	stamp	Stamp returned when the mutex was locked
+	 */
+	template<typename MutexType>
+	void unlock_shared(MutexType& mutex, const LockStamp& stamp);
+
+	/**
+	 * Ends a hold before the mutex is released by waiting for a condition variable.
+	 * @param	stamp	Stamp of the hold, it is reset
+	 */
+	void suspend(LockStamp& stamp);
+
+	/**
+	 * Starts a new hold after the mutex was locked again by a condition variable.
+	 * @param	stamp	Receives the point in time at which the mutex was locked again
+	 */
+	void resume(LockStamp& stamp);
+
+	/**
+	 * Returns a snapshot of all counters.
+	 * @return	Snapshot of the counters
+	 */
+	ListStatistics snapshot() const;
+
+	/**
+	 * Sets all counters to zero.
+	 */
+	void reset();
+};
+
+
+template<typename MutexType>
+LockStamp ListInstrumentation::lock(MutexType& mutex, ListOperation operation)
+{
+	if (mutex.try_lock())
+	{
+		record_lock(operation, false, 0);
+		return std::chrono::steady_clock::now();
+	}
+	LockStamp start = std::chrono::steady_clock::now();
+	mutex.lock();
+	LockStamp stamp = std::chrono::steady_clock::now();
+	record_lock(operation, true, std::chrono::duration_cast<std::chrono::nanoseconds>(stamp - start).count());
+	return stamp;
+}
+
+template<typename MutexType>
+LockStamp ListInstrumentation::lock_shared(MutexType& mutex, ListOperation operation)
+{
+	if (mutex.try_lock_shared())
+	{
+		record_lock(operation, false, 0);
+		return std::chrono::steady_clock::now();
+	}
+	LockStamp start = std::chrono::steady_clock::now();
+	mutex.lock_shared();
+	LockStamp stamp = std::chrono::steady_clock::now();
+	record_lock(operation, true, std::chrono::duration_cast<std::chrono::nanoseconds>(stamp - start).count());
+	return stamp;
+}
+
+template<typename MutexType>
+bool ListInstrumentation::try_lock(MutexType& mutex, ListOperation operation, LockStamp& stamp)
+{
+	if (!mutex.try_lock())
+	{
+		m_operations[operation].fetch_add(1, std::memory_order_relaxed);
+		m_contendedAcquisitions.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	record_lock(operation, false, 0);
+	stamp = std::chrono::steady_clock::now();
+	return true;
+}
+
+template<typename MutexType>
+void ListInstrumentation::unlock(MutexType& mutex, const LockStamp& stamp, size_t size)
+{
+	record_hold(stamp);
+	size_t peak = m_peakSize.load(std::memory_order_relaxed);
+	while (size > peak && !m_peakSize.compare_exchange_weak(peak, size, std::memory_order_relaxed))
+	{
+		// peak was updated by compare_exchange_weak, try again
+	}
+	mutex.unlock();
+}
+
+template<typename MutexType>
+void ListInstrumentation::unlock_shared(MutexType& mutex, const LockStamp& stamp)
+{
+	record_hold(stamp);
+	mutex.unlock_shared();
+}
+
+#else
+
+// Empty stamp used if the instrumentation is disabled
+struct LockStamp {};
+
+#endif // #ifdef SLIST_INSTRUMENTATION
+
+
+#endif // #ifndef LISTSTATISTICS_HPP
@@ -0,0 +1,175 @@
+/**
+ * @file LockCouplingSList.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef LOCKCOUPLINGSLIST_HPP
+#define LOCKCOUPLINGSLIST_HPP
+
+
+#include <atomic>
+#include <cstddef>
+#include "List.hpp"
+#include "Mutex.hpp"
+
+
+/**
+ * @class LockCouplingSList
+ * A thread-safe double-linked list class which locks single nodes instead of the whole list. It provides the same
+ * methods as SList.
+ * The iterate methods lock the nodes hand-over-hand (lock coupling): at most the previous, the current and the next
+ * node are locked at the same time. Threads adding or removing elements at the ends of the list can therefore proceed
+ * while another thread iterates the middle of the list.
+ * Nodes are always locked from the front to the back of the list. Methods working on the back of the list lock the
+ * end of the list first and only try to lock the preceding nodes, they back off and retry if one of them is locked.
+ * IMPORTANT: The callback functions of the iterate methods must not call methods of the same list.
+ */
+template<typename T>
+class LockCouplingSList
+{
+private:
+	/**
+	 * @class NodeBase
+	 * Base class for the nodes of the list, it is used for the sentinel nodes at the front and at the back of the list.
+	 * A node can only be removed from the list if its previous node, the node itself and its next node are locked.
+	 * Locking a node therefore prevents its neighbours from being removed.
+	 */
+	struct NodeBase
+	{
+		// Previous node of the list
+		NodeBase*	m_prev;
+		// Next node of the list
+		NodeBase*	m_next;
+		// Mutex guarding m_prev and m_next as well as the element of the node
+		Mutex		m_mutex;
+
+		/**
+		 * Constructor for instances of the class NodeBase.
+		 */
+		NodeBase() : m_prev(nullptr), m_next(nullptr), m_mutex() {}
+	};
+
+	/**
+	 * @class Node
+	 * Class for nodes of the list containing the actual elements of the list.
+	 */
+	struct Node : public NodeBase
+	{
+		// Element of the node
+		T	m_element;
+
+		/**
+		 * Constructor for instances of the class Node.
+		 * @param	element	Element of the node
+		 */
+		Node(const T& element) : NodeBase(), m_element(element) {}
+	};
+
+	// Sentinel node in front of the first node of the list
+	NodeBase			m_head;
+	// Sentinel node behind the last node of the list
+	NodeBase			m_tail;
+	// Count of elements in the list
+	std::atomic<size_t>	m_size;
+
+	/**
+	 * Unlinks a node from the list. The node as well as its previous and next nodes have to be locked.
+	 * @param	node	Node to unlink
+	 */
+	void unlink(NodeBase* node);
+
+	/**
+	 * Locks the last node of the list and its previous node. The sentinel node m_tail has to be locked already.
+	 * Blocks until both nodes could be locked without risking a deadlock with a thread iterating the list.
+	 * @return	The last node of the list, m_tail is unlocked and nullptr is returned if the list is empty
+	 */
+	NodeBase* lock_last();
+
+public:
+	/**
+	 * Default constructor for instances of the class LockCouplingSList.
+	 */
+	LockCouplingSList();
+
+	/**
+	 * Destructor for instances of the class LockCouplingSList.
+	 */
+	~LockCouplingSList();
+
+	/**
+	 * Returns the count of elements in the list at the time of the call.
+	 * @return	The count of elements in the list
+	 */
+	size_t size();
+
+	/**
+	 * Checks if the list is empty (= does not contain any elements) at the time of the call.
+	 * @return	true if the list is empty, otherwise false
+	 */
+	bool empty();
+
+	/**
+	 * Removes all elements from the list.
+	 */
+	void clear();
+
+	/**
+	 * Adds an element to the back of the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_back(const T& element);
+
+	/**
+	 * Adds an element to the front of the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_front(const T& element);
+
+	/**
+	 * Returns a copy of the last element and removes it from the list.
+	 * @return	A copy of the removed last element or a default-constructed element if the list is empty
+	 */
+	T pop_back();
+
+	/**
+	 * Returns a copy of the first element and removes it from the list.
+	 * @return	A copy of the removed first element or a default-constructed element if the list is empty
+	 */
+	T pop_front();
+
+	/**
+	 * Removes elements from the list.
+	 * @param	element	Element to remove from the list
+	 */
+	void remove(const T& element);
+
+	/**
+	 * Iterates from the front to the back of the list using a function pointer as callback function for every element
+	 * in the list. Only the nodes around the current element are locked while the callback function is called.
+	 * @param	func		Pointer to a callback function called for every element in the list
+	 * @param	parameter	A user-defined parameter to be passed to the callback function, it can be NULL
+	 */
+	void iterate(const typename List<T>::IterationFunction& func, void* parameter = nullptr);
+
+	/**
+	 * Iterates from the front to the back of the list using a lambda function as callback function for every element
+	 * in the list. Only the nodes around the current element are locked while the callback function is called.
+	 * The callback lambda function should have the following signature:
+	 * auto func = [your lambda capture list goes here](T& element) -> ListInterationAction { your code goes here };
+	 * @param	func	Callback lambda function called for every element in the list. It receives a reference to the
+	 *					current element as a parameter.
+	 */
+	template<typename Lambda>
+	void iterate(const Lambda& func);
+
+	// Instances of LockCouplingSList can't be copied since other threads might access them during the copy
+	LockCouplingSList(const LockCouplingSList&) = delete;
+	LockCouplingSList& operator=(const LockCouplingSList&) = delete;
+};
+
+
+// Include implementation of LockCouplingSList
+#include "LockCouplingSList.tpp"
+
+
+#endif // #ifndef LOCKCOUPLINGSLIST_HPP
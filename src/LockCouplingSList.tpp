@@ -0,0 +1,250 @@
+/**
+ * @file LockCouplingSList.tpp
+ * @date 17.10.2026
+ */
+
+#ifndef LOCKCOUPLINGSLIST_HPP
+#error LOCKCOUPLINGSLIST_HPP undefined
+#endif
+
+#include <thread>
+
+template<typename T>
+void LockCouplingSList<T>::unlink(NodeBase* node)
+{
+	node->m_prev->m_next = node->m_next;
+	node->m_next->m_prev = node->m_prev;
+	m_size--;
+}
+
+template<typename T>
+typename LockCouplingSList<T>::NodeBase* LockCouplingSList<T>::lock_last()
+{
+	while (true)
+	{
+		// m_tail is locked, so its previous node can't be removed and can be accessed safely
+		NodeBase* last = m_tail.m_prev;
+		if (&m_head == last)
+		{
+			// List is empty
+			m_tail.m_mutex.unlock();
+			return nullptr;
+		}
+		if (last->m_mutex.try_lock())
+		{
+			// last is locked, so its previous node can't be removed and can be accessed safely
+			if (last->m_prev->m_mutex.try_lock())
+			{
+				return last;
+			}
+			last->m_mutex.unlock();
+		}
+
+		// Nodes are locked from the front to the back, back off in order to let a thread iterating the list proceed
+		m_tail.m_mutex.unlock();
+		std::this_thread::yield();
+		m_tail.m_mutex.lock();
+	}
+}
+
+template<typename T>
+LockCouplingSList<T>::LockCouplingSList() : m_head(), m_tail(), m_size(0)
+{
+	m_head.m_next = &m_tail;
+	m_tail.m_prev = &m_head;
+}
+
+template<typename T>
+LockCouplingSList<T>::~LockCouplingSList()
+{
+	NodeBase* current = m_head.m_next;
+	while (&m_tail != current)
+	{
+		NodeBase* next = current->m_next;
+		delete static_cast<Node*>(current);
+		current = next;
+	}
+}
+
+template<typename T>
+size_t LockCouplingSList<T>::size()
+{
+	return m_size.load();
+}
+
+template<typename T>
+bool LockCouplingSList<T>::empty()
+{
+	return 0 == m_size.load();
+}
+
+template<typename T>
+void LockCouplingSList<T>::clear()
+{
+	auto removeAll = [](T& /*element*/) -> ListIterationAction
+	{
+		return ListIterationAction::ACTION_REMOVE;
+	};
+	iterate(removeAll);
+}
+
+template<typename T>
+void LockCouplingSList<T>::push_back(const T& element)
+{
+	Node* newnode = new Node(element);
+
+	m_tail.m_mutex.lock();
+	NodeBase* last;
+	while (true)
+	{
+		// m_tail is locked, so its previous node can't be removed and can be accessed safely
+		last = m_tail.m_prev;
+		if (last->m_mutex.try_lock())
+		{
+			break;
+		}
+		// Nodes are locked from the front to the back, back off in order to let a thread iterating the list proceed
+		m_tail.m_mutex.unlock();
+		std::this_thread::yield();
+		m_tail.m_mutex.lock();
+	}
+
+	newnode->m_prev = last;
+	newnode->m_next = &m_tail;
+	last->m_next = newnode;
+	m_tail.m_prev = newnode;
+	m_size++;
+
+	last->m_mutex.unlock();
+	m_tail.m_mutex.unlock();
+}
+
+template<typename T>
+void LockCouplingSList<T>::push_front(const T& element)
+{
+	Node* newnode = new Node(element);
+
+	m_head.m_mutex.lock();
+	// m_head is locked, so its next node can't be removed and can be accessed safely
+	NodeBase* first = m_head.m_next;
+	first->m_mutex.lock();
+
+	newnode->m_prev = &m_head;
+	newnode->m_next = first;
+	first->m_prev = newnode;
+	m_head.m_next = newnode;
+	m_size++;
+
+	first->m_mutex.unlock();
+	m_head.m_mutex.unlock();
+}
+
+template<typename T>
+T LockCouplingSList<T>::pop_back()
+{
+	m_tail.m_mutex.lock();
+	NodeBase* last = lock_last();
+	if (!last)
+	{
+		return T();
+	}
+
+	NodeBase* prev = last->m_prev;
+	unlink(last);
+	prev->m_mutex.unlock();
+	last->m_mutex.unlock();
+	m_tail.m_mutex.unlock();
+
+	// Nobody can reach the unlinked node anymore, copy its element and delete it outside of the locks
+	Node* node = static_cast<Node*>(last);
+	T element = node->m_element;
+	delete node;
+	return element;
+}
+
+template<typename T>
+T LockCouplingSList<T>::pop_front()
+{
+	m_head.m_mutex.lock();
+	NodeBase* first = m_head.m_next;
+	if (&m_tail == first)
+	{
+		// List is empty
+		m_head.m_mutex.unlock();
+		return T();
+	}
+	first->m_mutex.lock();
+	NodeBase* next = first->m_next;
+	next->m_mutex.lock();
+
+	unlink(first);
+	next->m_mutex.unlock();
+	first->m_mutex.unlock();
+	m_head.m_mutex.unlock();
+
+	// Nobody can reach the unlinked node anymore, copy its element and delete it outside of the locks
+	Node* node = static_cast<Node*>(first);
+	T element = node->m_element;
+	delete node;
+	return element;
+}
+
+template<typename T>
+void LockCouplingSList<T>::remove(const T& element)
+{
+	auto removeEqual = [&element](T& current) -> ListIterationAction
+	{
+		return element == current ? ListIterationAction::ACTION_REMOVE : ListIterationAction::ACTION_CONTINUE;
+	};
+	iterate(removeEqual);
+}
+
+template<typename T>
+void LockCouplingSList<T>::iterate(const typename List<T>::IterationFunction& func, void* parameter)
+{
+	auto callFunction = [&func, parameter](T& element) -> ListIterationAction
+	{
+		return func(element, parameter);
+	};
+	iterate(callFunction);
+}
+
+template<typename T>
+template<typename Lambda>
+void LockCouplingSList<T>::iterate(const Lambda& func)
+{
+	// Invariant: prev and current are locked, current is the next node of prev
+	NodeBase* prev = &m_head;
+	prev->m_mutex.lock();
+	NodeBase* current = prev->m_next;
+	current->m_mutex.lock();
+
+	while (&m_tail != current)
+	{
+		ListIterationAction action = func(static_cast<Node*>(current)->m_element);
+
+		NodeBase* next = current->m_next;
+		next->m_mutex.lock();
+		if (action & ListIterationAction::ACTION_REMOVE)
+		{
+			// prev, current and next are locked, so nobody else can reach current anymore after unlinking it
+			unlink(current);
+			current->m_mutex.unlock();
+			delete static_cast<Node*>(current);
+		}
+		else
+		{
+			prev->m_mutex.unlock();
+			prev = current;
+		}
+		current = next;
+
+		if (action & ListIterationAction::ACTION_BREAK)
+		{
+			break;
+		}
+	}
+
+	current->m_mutex.unlock();
+	prev->m_mutex.unlock();
+}
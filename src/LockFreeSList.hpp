@@ -0,0 +1,339 @@
+/**
+ * @file LockFreeSList.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef LOCKFREESLIST_HPP
+#define LOCKFREESLIST_HPP
+
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+
+/**
+ * @class LockFreeSList
+ * A thread-safe list class without any mutex which supports adding and removing elements at both ends of the list.
+ * It can be used as a multi-producer/multi-consumer queue or deque.
+ * The list implements the lock-free deque of Maged M. Michael ("CAS-Based Lock-Free Algorithm for Shared Deques",
+ * Euro-Par 2003): the first node, the last node and a status are packed into a single atomic anchor word. Adding an
+ * element links a new node with one compare-and-swap of the anchor and leaves the anchor in an unstable state until
+ * the link of the previous end node is set, any thread which finds the anchor unstable completes the link instead of
+ * waiting. So a thread which is preempted or whose element throws while it is copied never blocks other threads, and
+ * every method is linearizable at the compare-and-swap of the anchor.
+ * Removed nodes are protected by hazard pointers: every operation publishes the nodes it is going to read, and a
+ * removed node is reused only when no thread has published it. Nodes are referred to by 31 bit indices into segments
+ * which are allocated when the list grows and freed by the destructor.
+ * All threads update the same anchor, so the throughput doesn't grow with the count of threads like for a
+ * ShardedSList, but no thread ever waits for a thread holding a lock. size() and empty() return the count of elements
+ * at the time of the call.
+ * @tparam	T	Type of the elements of the list
+ */
+template<typename T>
+class LockFreeSList
+{
+private:
+	/**
+	 * @enum AnchorStatus
+	 * Status of the anchor. RPUSH and LPUSH mark an anchor whose last or first node has been added but which is not
+	 * linked from its neighbor yet.
+	 */
+	enum AnchorStatus : uint64_t
+	{
+		STATUS_STABLE	= 0x00,
+		STATUS_RPUSH	= 0x01,
+		STATUS_LPUSH	= 0x02
+	};
+
+	/**
+	 * @class Node
+	 * Node of the list. Nodes are referred to by their index, index 0 refers to no node. A link contains the index of
+	 * the linked node (lower 32 bits) and a tag which changes with every change of the link (upper 32 bits), so a
+	 * thread completing a link which has been completed and changed again in the meantime can't overwrite it.
+	 */
+	struct Node
+	{
+		// Link to the previous node
+		std::atomic<uint64_t>									m_left;
+		// Link to the next node, or to the next free node while the node is in the free list
+		std::atomic<uint64_t>									m_right;
+		// Uninitialized storage for the element of the node
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type	m_storage;
+	};
+
+	/**
+	 * @class HazardRecord
+	 * Hazard pointers and removed nodes of one thread. A thread owns a record during a method call of the list, the
+	 * record is used by the thread again for its next call if no other thread has taken it in between.
+	 */
+	struct HazardRecord
+	{
+		// Indices of the nodes the owner of the record is going to read
+		std::atomic<uint32_t>	m_hazards[2];
+		// true while a thread owns the record
+		std::atomic<bool>		m_active;
+		// Nodes removed by owners of the record which might still be read by other threads
+		std::vector<uint32_t>	m_retired;
+		// Next record of the list, it doesn't change after the record has been added
+		HazardRecord*			m_next;
+	};
+
+	/**
+	 * @class RecordOwnership
+	 * Owns a hazard record of the list while it exists.
+	 */
+	class RecordOwnership
+	{
+	private:
+		// Owned record
+		HazardRecord*	m_record;
+
+	public:
+		explicit RecordOwnership(const LockFreeSList* list) : m_record(list->acquire_record()) {}
+		~RecordOwnership() { release_record(m_record); }
+		HazardRecord* operator->() const { return m_record; }
+		HazardRecord* get() const { return m_record; }
+		RecordOwnership(const RecordOwnership&) = delete;
+		RecordOwnership& operator=(const RecordOwnership&) = delete;
+	};
+
+	// Index which refers to no node
+	static const uint32_t NIL = 0;
+	// Bits of a node index in the anchor
+	static const unsigned int INDEX_BITS = 31;
+	// Mask of a node index in the anchor
+	static const uint64_t INDEX_MASK = (static_cast<uint64_t>(1) << INDEX_BITS) - 1;
+	// Binary logarithm of the count of nodes of the first segment, every further segment is twice as large
+	static const unsigned int FIRST_SEGMENT_BITS = 6;
+	// Count of segments, enough for all node indices
+	static const unsigned int SEGMENTS = INDEX_BITS + 1 - FIRST_SEGMENT_BITS;
+
+	// Count of instances created so far, it provides unique ids for the cached records of the threads
+	static std::atomic<uint64_t>	s_instances;
+
+	// First node (lower 31 bits), last node (next 31 bits) and status (upper 2 bits) of the list
+	std::atomic<uint64_t>	m_anchor;
+	// Count of elements in the list, it can be negative for a moment while an element is removed which is not counted
+	// yet
+	std::atomic<int64_t>	m_count;
+	// Segments of nodes, segment s contains 2^(s + FIRST_SEGMENT_BITS) nodes starting with the node
+	// 2^(s + FIRST_SEGMENT_BITS) - 2^FIRST_SEGMENT_BITS + 1
+	std::atomic<Node*>		m_segments[SEGMENTS];
+	// Count of nodes handed out from the segments so far
+	std::atomic<uint32_t>	m_allocated;
+	// First free node (lower 32 bits) and a tag preventing the ABA problem (upper 32 bits)
+	std::atomic<uint64_t>	m_free;
+	// Hazard records of the list
+	mutable std::atomic<HazardRecord*>	m_records;
+	// Count of hazard records of the list
+	mutable std::atomic<size_t>			m_recordCount;
+	// Unique id of the list
+	const uint64_t			m_id;
+
+	/**
+	 * Packs the first node, the last node and the status into an anchor word.
+	 * @param	left	Index of the first node
+	 * @param	right	Index of the last node
+	 * @param	status	Status of the anchor
+	 * @return			The anchor word
+	 */
+	static uint64_t make_anchor(uint32_t left, uint32_t right, AnchorStatus status);
+
+	/**
+	 * Returns the index of the first node of an anchor word.
+	 * @param	anchor	Anchor word
+	 * @return			Index of the first node
+	 */
+	static uint32_t left_of(uint64_t anchor) { return static_cast<uint32_t>(anchor & INDEX_MASK); }
+
+	/**
+	 * Returns the index of the last node of an anchor word.
+	 * @param	anchor	Anchor word
+	 * @return			Index of the last node
+	 */
+	static uint32_t right_of(uint64_t anchor) { return static_cast<uint32_t>((anchor >> INDEX_BITS) & INDEX_MASK); }
+
+	/**
+	 * Returns the status of an anchor word.
+	 * @param	anchor	Anchor word
+	 * @return			Status of the anchor
+	 */
+	static AnchorStatus status_of(uint64_t anchor) { return static_cast<AnchorStatus>(anchor >> (2 * INDEX_BITS)); }
+
+	/**
+	 * Sets a link of a node which can't be changed by other threads at the same time.
+	 * @param	link	Link to set
+	 * @param	index	Index of the linked node
+	 */
+	static void set_link(std::atomic<uint64_t>& link, uint32_t index);
+
+	/**
+	 * Returns a node by its index.
+	 * @param	index	Index of the node, it must have been allocated
+	 * @return			The node
+	 */
+	Node& node(uint32_t index) const;
+
+	/**
+	 * Returns the element stored in a node.
+	 * @param	index	Index of the node
+	 * @return			Pointer to the element of the node
+	 */
+	T* element_of(uint32_t index) const { return reinterpret_cast<T*>(&node(index).m_storage); }
+
+	/**
+	 * Takes a node from the free list or from the segments, a new segment is allocated if necessary.
+	 * @return	Index of the node
+	 */
+	uint32_t allocate_node();
+
+	/**
+	 * Puts a node which can't be read by any thread into the free list.
+	 * @param	index	Index of the node
+	 */
+	void free_node(uint32_t index);
+
+	/**
+	 * Takes a hazard record which is not owned by any thread, a new record is added if all records are owned.
+	 * @return	The record which is owned by the calling thread now
+	 */
+	HazardRecord* acquire_record() const;
+
+	/**
+	 * Clears the hazard pointers of a record and gives up its ownership.
+	 * @param	record	Record owned by the calling thread
+	 */
+	static void release_record(HazardRecord* record);
+
+	/**
+	 * Publishes a node in a hazard pointer and checks if the anchor is still unchanged afterwards, which ensures that
+	 * the node hasn't been removed before it was published.
+	 * @param	record	Record owned by the calling thread
+	 * @param	hazard	Index of the hazard pointer to use
+	 * @param	index	Index of the node to publish
+	 * @param	anchor	Anchor word the node was read from
+	 * @return			true if the anchor is unchanged, false if the caller has to start again
+	 */
+	bool protect(HazardRecord* record, unsigned int hazard, uint32_t index, uint64_t anchor) const;
+
+	/**
+	 * Adds a removed node to the retired nodes of a record. If the record contains enough retired nodes, all of them
+	 * which are not published by any thread are put into the free list.
+	 * @param	record	Record owned by the calling thread
+	 * @param	index	Index of the removed node
+	 */
+	void retire(HazardRecord* record, uint32_t index);
+
+	/**
+	 * Links the previous end node of an anchor with status RPUSH or LPUSH to the new end node and marks the anchor as
+	 * stable. Other threads might complete the link at the same time.
+	 * @param	record	Record owned by the calling thread
+	 * @param	anchor	Anchor word which is not stable
+	 */
+	void stabilize(HazardRecord* record, uint64_t anchor);
+
+	/**
+	 * Adds an element to the back or to the front of the list.
+	 * @param	back	true to add the element behind the last element, false to add it in front of the first element
+	 * @param	element	Element to add to the list, it is forwarded to the constructor of T
+	 */
+	template<typename U>
+	void push(bool back, U&& element);
+
+	/**
+	 * Removes the last or the first element of the list.
+	 * @param	back	true to remove the last element, false to remove the first element
+	 * @param	element	Receives the removed element, it is left unchanged if the list is empty
+	 * @return			true if an element was removed, false if the list is empty
+	 */
+	bool pop(bool back, T& element);
+
+public:
+	/**
+	 * Default constructor for instances of the class LockFreeSList.
+	 */
+	LockFreeSList();
+
+	/**
+	 * Destructor for instances of the class LockFreeSList. No other thread may use the list anymore.
+	 */
+	~LockFreeSList();
+
+	/**
+	 * Returns the count of elements in the list at the time of the call.
+	 * @return	The count of elements in the list
+	 */
+	size_t size() const;
+
+	/**
+	 * Checks if the list is empty (= does not contain any elements) at the time of the call.
+	 * @return	true if the list is empty, otherwise false
+	 */
+	bool empty() const;
+
+	/**
+	 * Adds an element to the back of the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_back(const T& element);
+
+	/**
+	 * Adds an element to the back of the list. The element is moved into the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_back(T&& element);
+
+	/**
+	 * Adds an element to the front of the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_front(const T& element);
+
+	/**
+	 * Adds an element to the front of the list. The element is moved into the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_front(T&& element);
+
+	/**
+	 * Removes the last element from the list and returns it. The element is moved out of the list.
+	 * @return	The removed last element or a value-initialized element if the list is empty
+	 */
+	T pop_back();
+
+	/**
+	 * Removes the last element from the list if the list is not empty. The element is moved out of the list. If
+	 * moving the element throws, the element is removed from the list anyway.
+	 * @param	element	Receives the removed last element, it is left unchanged if the list is empty
+	 * @return			true if an element was removed, false if the list is empty
+	 */
+	bool try_pop_back(T& element);
+
+	/**
+	 * Removes the first element from the list and returns it. The element is moved out of the list.
+	 * @return	The removed first element or a value-initialized element if the list is empty
+	 */
+	T pop_front();
+
+	/**
+	 * Removes the first element from the list if the list is not empty. The element is moved out of the list. If
+	 * moving the element throws, the element is removed from the list anyway.
+	 * @param	element	Receives the removed first element, it is left unchanged if the list is empty
+	 * @return			true if an element was removed, false if the list is empty
+	 */
+	bool try_pop_front(T& element);
+
+	// Instances of LockFreeSList can't be copied since other threads might access them during the copy
+	LockFreeSList(const LockFreeSList&) = delete;
+	LockFreeSList& operator=(const LockFreeSList&) = delete;
+};
+
+
+// Include implementation of LockFreeSList
+#include "LockFreeSList.tpp"
+
+
+#endif // #ifndef LOCKFREESLIST_HPP
@@ -0,0 +1,513 @@
+/**
+ * @file LockFreeSList.tpp
+ * @date 17.10.2026
+ */
+
+#ifndef LOCKFREESLIST_HPP
+#error LOCKFREESLIST_HPP undefined
+#endif
+
+#include <algorithm>
+#include <new>
+#include <utility>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+template<typename T>
+std::atomic<uint64_t> LockFreeSList<T>::s_instances(0);
+
+template<typename T>
+uint64_t LockFreeSList<T>::make_anchor(uint32_t left, uint32_t right, AnchorStatus status)
+{
+	return static_cast<uint64_t>(left) | (static_cast<uint64_t>(right) << INDEX_BITS)
+		| (static_cast<uint64_t>(status) << (2 * INDEX_BITS));
+}
+
+template<typename T>
+void LockFreeSList<T>::set_link(std::atomic<uint64_t>& link, uint32_t index)
+{
+	uint64_t tag = (link.load(std::memory_order_relaxed) >> 32) + 1;
+	link.store(index | (tag << 32), std::memory_order_relaxed);
+}
+
+template<typename T>
+typename LockFreeSList<T>::Node& LockFreeSList<T>::node(uint32_t index) const
+{
+	// Segment s starts at position 2^(s + FIRST_SEGMENT_BITS) of the nodes counted from 2^FIRST_SEGMENT_BITS
+	uint32_t position = index - 1 + (static_cast<uint32_t>(1) << FIRST_SEGMENT_BITS);
+#ifdef _MSC_VER
+	unsigned long bit;
+	_BitScanReverse(&bit, position);
+#else
+	unsigned int bit = 31 - __builtin_clz(position);
+#endif
+	unsigned int segment = static_cast<unsigned int>(bit) - FIRST_SEGMENT_BITS;
+	return m_segments[segment].load(std::memory_order_acquire)[position - (static_cast<uint32_t>(1) << bit)];
+}
+
+template<typename T>
+uint32_t LockFreeSList<T>::allocate_node()
+{
+	uint64_t head = m_free.load(std::memory_order_acquire);
+	while (NIL != static_cast<uint32_t>(head))
+	{
+		// The tag of the free list changes with every change, so a node which has been taken and freed again by
+		// other threads in the meantime doesn't match anymore
+		uint32_t index = static_cast<uint32_t>(head);
+		uint64_t next = static_cast<uint32_t>(node(index).m_right.load(std::memory_order_relaxed))
+			| (((head >> 32) + 1) << 32);
+		if (m_free.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire))
+		{
+			return index;
+		}
+	}
+
+	uint32_t index = m_allocated.fetch_add(1, std::memory_order_relaxed) + 1;
+	if (index > INDEX_MASK)
+	{
+		m_allocated.fetch_sub(1, std::memory_order_relaxed);
+		throw std::bad_alloc();
+	}
+	uint32_t position = index - 1 + (static_cast<uint32_t>(1) << FIRST_SEGMENT_BITS);
+	unsigned int bit = FIRST_SEGMENT_BITS;
+	while (position >> (bit + 1))
+	{
+		bit++;
+	}
+	std::atomic<Node*>& segment = m_segments[bit - FIRST_SEGMENT_BITS];
+	if (nullptr == segment.load(std::memory_order_acquire))
+	{
+		// Several threads might allocate the first nodes of a segment at the same time, only one segment is kept
+		Node* nodes = new Node[static_cast<size_t>(1) << bit]();
+		Node* expected = nullptr;
+		if (!segment.compare_exchange_strong(expected, nodes, std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			delete[] nodes;
+		}
+	}
+	return index;
+}
+
+template<typename T>
+void LockFreeSList<T>::free_node(uint32_t index)
+{
+	Node& freed = node(index);
+	uint64_t head = m_free.load(std::memory_order_relaxed);
+	uint64_t desired;
+	do
+	{
+		set_link(freed.m_right, static_cast<uint32_t>(head));
+		desired = index | (((head >> 32) + 1) << 32);
+	}
+	while (!m_free.compare_exchange_weak(head, desired, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template<typename T>
+typename LockFreeSList<T>::HazardRecord* LockFreeSList<T>::acquire_record() const
+{
+	// Every thread remembers the record it used last, ids are never reused so the record belongs to this list
+	static thread_local uint64_t cachedId = 0;
+	static thread_local HazardRecord* cachedRecord = nullptr;
+	bool expected = false;
+	if (cachedId == m_id && cachedRecord->m_active.compare_exchange_strong(expected, true, std::memory_order_acquire))
+	{
+		return cachedRecord;
+	}
+
+	HazardRecord* record = m_records.load(std::memory_order_acquire);
+	for (; record; record = record->m_next)
+	{
+		expected = false;
+		if (!record->m_active.load(std::memory_order_relaxed) &&
+			record->m_active.compare_exchange_strong(expected, true, std::memory_order_acquire))
+		{
+			break;
+		}
+	}
+
+	if (!record)
+	{
+		// All records are owned by other threads
+		record = new HazardRecord();
+		record->m_hazards[0].store(NIL, std::memory_order_relaxed);
+		record->m_hazards[1].store(NIL, std::memory_order_relaxed);
+		record->m_active.store(true, std::memory_order_relaxed);
+		record->m_next = m_records.load(std::memory_order_relaxed);
+		while (!m_records.compare_exchange_weak(record->m_next, record, std::memory_order_release,
+			std::memory_order_relaxed))
+		{
+			// record->m_next has been updated to the current first record
+		}
+		m_recordCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	cachedId = m_id;
+	cachedRecord = record;
+	return record;
+}
+
+template<typename T>
+void LockFreeSList<T>::release_record(HazardRecord* record)
+{
+	record->m_hazards[0].store(NIL, std::memory_order_release);
+	record->m_hazards[1].store(NIL, std::memory_order_release);
+	record->m_active.store(false, std::memory_order_release);
+}
+
+template<typename T>
+bool LockFreeSList<T>::protect(HazardRecord* record, unsigned int hazard, uint32_t index, uint64_t anchor) const
+{
+	// Both accesses are sequentially consistent, so a thread removing the node either sees the hazard pointer or this
+	// thread sees the changed anchor
+	record->m_hazards[hazard].store(index);
+	return m_anchor.load() == anchor;
+}
+
+template<typename T>
+void LockFreeSList<T>::retire(HazardRecord* record, uint32_t index)
+{
+	std::vector<uint32_t>& retired = record->m_retired;
+	try
+	{
+		retired.push_back(index);
+	}
+	catch (...)
+	{
+		// The node is leaked rather than reused while another thread might still read it
+		return;
+	}
+
+	// Scanning the hazard pointers of all records is worth it only for a multiple of their count
+	size_t threshold = std::max<size_t>(64, 4 * m_recordCount.load(std::memory_order_relaxed));
+	if (retired.size() < threshold)
+	{
+		return;
+	}
+
+	std::vector<uint32_t> hazards;
+	try
+	{
+		hazards.reserve(2 * m_recordCount.load(std::memory_order_relaxed));
+		for (HazardRecord* other = m_records.load(std::memory_order_acquire); other; other = other->m_next)
+		{
+			for (const std::atomic<uint32_t>& hazard : other->m_hazards)
+			{
+				uint32_t published = hazard.load();
+				if (NIL != published)
+				{
+					hazards.push_back(published);
+				}
+			}
+		}
+	}
+	catch (...)
+	{
+		// Try again when the next node is retired
+		return;
+	}
+	std::sort(hazards.begin(), hazards.end());
+
+	size_t kept = 0;
+	for (uint32_t candidate : retired)
+	{
+		if (std::binary_search(hazards.begin(), hazards.end(), candidate))
+		{
+			retired[kept++] = candidate;
+		}
+		else
+		{
+			free_node(candidate);
+		}
+	}
+	retired.resize(kept);
+}
+
+template<typename T>
+void LockFreeSList<T>::stabilize(HazardRecord* record, uint64_t anchor)
+{
+	// The new end node and its neighbor are published, the anchor can't return to the same value while they are
+	// published since the new end node can't be removed and added again without being reused
+	if (STATUS_RPUSH == status_of(anchor))
+	{
+		uint32_t right = right_of(anchor);
+		if (!protect(record, 0, right, anchor))
+		{
+			return;
+		}
+		uint32_t previous = static_cast<uint32_t>(node(right).m_left.load(std::memory_order_acquire));
+		if (!protect(record, 1, previous, anchor))
+		{
+			return;
+		}
+		uint64_t previousNext = node(previous).m_right.load(std::memory_order_acquire);
+		if (static_cast<uint32_t>(previousNext) != right)
+		{
+			uint64_t link = right | (((previousNext >> 32) + 1) << 32);
+			if (m_anchor.load() != anchor ||
+				!node(previous).m_right.compare_exchange_strong(previousNext, link, std::memory_order_acq_rel))
+			{
+				return;
+			}
+		}
+	}
+	else
+	{
+		uint32_t left = left_of(anchor);
+		if (!protect(record, 0, left, anchor))
+		{
+			return;
+		}
+		uint32_t next = static_cast<uint32_t>(node(left).m_right.load(std::memory_order_acquire));
+		if (!protect(record, 1, next, anchor))
+		{
+			return;
+		}
+		uint64_t nextPrevious = node(next).m_left.load(std::memory_order_acquire);
+		if (static_cast<uint32_t>(nextPrevious) != left)
+		{
+			uint64_t link = left | (((nextPrevious >> 32) + 1) << 32);
+			if (m_anchor.load() != anchor ||
+				!node(next).m_left.compare_exchange_strong(nextPrevious, link, std::memory_order_acq_rel))
+			{
+				return;
+			}
+		}
+	}
+	m_anchor.compare_exchange_strong(anchor, make_anchor(left_of(anchor), right_of(anchor), STATUS_STABLE));
+}
+
+template<typename T>
+template<typename U>
+void LockFreeSList<T>::push(bool back, U&& element)
+{
+	RecordOwnership record(this);
+	uint32_t index = allocate_node();
+	try
+	{
+		new (&node(index).m_storage) T(std::forward<U>(element));
+	}
+	catch (...)
+	{
+		// The node has never been part of the list, so it can be reused immediately
+		free_node(index);
+		throw;
+	}
+
+	Node& added = node(index);
+	uint64_t anchor = m_anchor.load();
+	while (true)
+	{
+		if (NIL == right_of(anchor))
+		{
+			// List is empty
+			if (m_anchor.compare_exchange_weak(anchor, make_anchor(index, index, STATUS_STABLE)))
+			{
+				break;
+			}
+		}
+		else if (STATUS_STABLE == status_of(anchor))
+		{
+			uint64_t desired;
+			if (back)
+			{
+				set_link(added.m_left, right_of(anchor));
+				desired = make_anchor(left_of(anchor), index, STATUS_RPUSH);
+			}
+			else
+			{
+				set_link(added.m_right, left_of(anchor));
+				desired = make_anchor(index, right_of(anchor), STATUS_LPUSH);
+			}
+			if (m_anchor.compare_exchange_weak(anchor, desired))
+			{
+				stabilize(record.get(), desired);
+				break;
+			}
+		}
+		else
+		{
+			// Another thread is adding an element, complete its link first
+			stabilize(record.get(), anchor);
+			anchor = m_anchor.load();
+		}
+	}
+	m_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+template<typename T>
+bool LockFreeSList<T>::pop(bool back, T& element)
+{
+	RecordOwnership record(this);
+	uint64_t anchor = m_anchor.load();
+	uint32_t index;
+	while (true)
+	{
+		uint32_t left = left_of(anchor);
+		uint32_t right = right_of(anchor);
+		if (NIL == right)
+		{
+			// List is empty
+			return false;
+		}
+		if (left == right)
+		{
+			// Last element of the list
+			if (m_anchor.compare_exchange_weak(anchor, make_anchor(NIL, NIL, STATUS_STABLE)))
+			{
+				index = right;
+				break;
+			}
+		}
+		else if (STATUS_STABLE == status_of(anchor))
+		{
+			index = back ? right : left;
+			if (!protect(record.get(), 0, index, anchor))
+			{
+				anchor = m_anchor.load();
+				continue;
+			}
+			// The links of a node in a stable list are complete
+			uint32_t neighbor = static_cast<uint32_t>(back ? node(index).m_left.load(std::memory_order_acquire)
+				: node(index).m_right.load(std::memory_order_acquire));
+			uint64_t desired = back ? make_anchor(left, neighbor, STATUS_STABLE)
+				: make_anchor(neighbor, right, STATUS_STABLE);
+			if (m_anchor.compare_exchange_weak(anchor, desired))
+			{
+				break;
+			}
+		}
+		else
+		{
+			// Another thread is adding an element, complete its link first
+			stabilize(record.get(), anchor);
+			anchor = m_anchor.load();
+		}
+	}
+	m_count.fetch_sub(1, std::memory_order_relaxed);
+
+	// The node isn't part of the list anymore, so the element belongs to this thread and only the links of the node
+	// can still be read by other threads
+	record->m_hazards[0].store(NIL, std::memory_order_release);
+	T* stored = element_of(index);
+	try
+	{
+		element = std::move(*stored);
+	}
+	catch (...)
+	{
+		stored->~T();
+		retire(record.get(), index);
+		throw;
+	}
+	stored->~T();
+	retire(record.get(), index);
+	return true;
+}
+
+template<typename T>
+LockFreeSList<T>::LockFreeSList()
+	: m_anchor(make_anchor(NIL, NIL, STATUS_STABLE)), m_count(0), m_allocated(0), m_free(NIL), m_records(nullptr),
+	m_recordCount(0), m_id(s_instances.fetch_add(1) + 1)
+{
+	for (std::atomic<Node*>& segment : m_segments)
+	{
+		segment.store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+template<typename T>
+LockFreeSList<T>::~LockFreeSList()
+{
+	uint64_t anchor = m_anchor.load();
+	if (STATUS_STABLE != status_of(anchor))
+	{
+		RecordOwnership record(this);
+		stabilize(record.get(), anchor);
+		anchor = m_anchor.load();
+	}
+	for (uint32_t index = left_of(anchor); NIL != index; )
+	{
+		uint32_t next = index == right_of(anchor) ? NIL
+			: static_cast<uint32_t>(node(index).m_right.load(std::memory_order_relaxed));
+		element_of(index)->~T();
+		index = next;
+	}
+
+	for (std::atomic<Node*>& segment : m_segments)
+	{
+		delete[] segment.load(std::memory_order_relaxed);
+	}
+	HazardRecord* record = m_records.load(std::memory_order_relaxed);
+	while (record)
+	{
+		HazardRecord* next = record->m_next;
+		delete record;
+		record = next;
+	}
+}
+
+template<typename T>
+size_t LockFreeSList<T>::size() const
+{
+	int64_t count = m_count.load(std::memory_order_relaxed);
+	return count > 0 ? static_cast<size_t>(count) : 0;
+}
+
+template<typename T>
+bool LockFreeSList<T>::empty() const
+{
+	return NIL == right_of(m_anchor.load());
+}
+
+template<typename T>
+void LockFreeSList<T>::push_back(const T& element)
+{
+	push(true, element);
+}
+
+template<typename T>
+void LockFreeSList<T>::push_back(T&& element)
+{
+	push(true, std::move(element));
+}
+
+template<typename T>
+void LockFreeSList<T>::push_front(const T& element)
+{
+	push(false, element);
+}
+
+template<typename T>
+void LockFreeSList<T>::push_front(T&& element)
+{
+	push(false, std::move(element));
+}
+
+template<typename T>
+T LockFreeSList<T>::pop_back()
+{
+	T element = T();
+	pop(true, element);
+	return element;
+}
+
+template<typename T>
+bool LockFreeSList<T>::try_pop_back(T& element)
+{
+	return pop(true, element);
+}
+
+template<typename T>
+T LockFreeSList<T>::pop_front()
+{
+	T element = T();
+	pop(false, element);
+	return element;
+}
+
+template<typename T>
+bool LockFreeSList<T>::try_pop_front(T& element)
+{
+	return pop(false, element);
+}
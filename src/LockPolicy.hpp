@@ -0,0 +1,68 @@
+/**
+ * @file LockPolicy.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef LOCKPOLICY_HPP
+#define LOCKPOLICY_HPP
+
+
+#include <cstddef>
+
+
+/**
+ * @class NoLock
+ * Lock policy of BasicList which doesn't synchronize at all. All methods are empty and inlined, so a List pays nothing
+ * for locking. Lists using NoLock must not be accessed by several threads at the same time.
+ */
+class NoLock
+{
+public:
+	void lock() {}
+	bool try_lock() { return true; }
+	void unlock() {}
+	void lock_shared() {}
+	bool try_lock_shared() { return true; }
+	void unlock_shared() {}
+};
+
+
+/**
+ * @class LockPolicyTraits
+ * Properties of a lock policy of BasicList. Lock policies are NoLock and mutexes providing lock, try_lock, unlock,
+ * lock_shared, try_lock_shared and unlock_shared like Mutex, RWMutex and AdaptiveMutex. Specialize the class for lock
+ * policies which need to react on changes of the list.
+ * @tparam	LockPolicy	Lock policy to describe
+ */
+template<typename LockPolicy>
+struct LockPolicyTraits
+{
+	// true if the policy synchronizes threads. Only synchronized lists maintain a count of elements which can be read
+	// without locking and forbid iterators outside of locked views.
+	static const bool SYNCHRONIZED = true;
+
+	/**
+	 * Called after the count of elements of a list changed while the lock was locked exclusively. Does nothing by
+	 * default.
+	 * @param	lock	Lock of the list
+	 * @param	before	Count of elements before the change
+	 * @param	after	Count of elements after the change
+	 */
+	static void count_changed(LockPolicy& /*lock*/, size_t /*before*/, size_t /*after*/) {}
+};
+
+
+/**
+ * @class LockPolicyTraits<NoLock>
+ * Properties of the lock policy NoLock.
+ */
+template<>
+struct LockPolicyTraits<NoLock>
+{
+	static const bool SYNCHRONIZED = false;
+
+	static void count_changed(NoLock& /*lock*/, size_t /*before*/, size_t /*after*/) {}
+};
+
+
+#endif // #ifndef LOCKPOLICY_HPP
@@ -0,0 +1,147 @@
+/**
+ * @file MappedFile.cpp
+ * @date 17.10.2026
+ */
+
+#include "MappedFile.hpp"
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <cstdio>
+#endif
+
+MappedFile::MappedFile(const char* path) : m_data(nullptr), m_size(0), m_open(false), m_buffered(false)
+#ifdef _WIN32
+	, m_mapping(nullptr)
+#endif
+{
+#if defined(_WIN32)
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN,
+		nullptr);
+	if (INVALID_HANDLE_VALUE == file)
+	{
+		return;
+	}
+	LARGE_INTEGER size;
+	if (GetFileSizeEx(file, &size))
+	{
+		m_open = true;
+		m_size = static_cast<size_t>(size.QuadPart);
+		// Empty files can't be mapped
+		if (m_size > 0)
+		{
+			m_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			m_data = m_mapping ? static_cast<const unsigned char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0)) :
+				nullptr;
+			m_open = nullptr != m_data;
+		}
+	}
+	// The mapping keeps the file open
+	CloseHandle(file);
+#elif defined(__unix__) || defined(__APPLE__)
+	int descriptor = open(path, O_RDONLY);
+	if (descriptor < 0)
+	{
+		return;
+	}
+	struct stat status;
+	if (0 == fstat(descriptor, &status))
+	{
+		m_open = true;
+		m_size = static_cast<size_t>(status.st_size);
+		// Empty files can't be mapped
+		if (m_size > 0)
+		{
+			void* mapping = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+			if (MAP_FAILED == mapping)
+			{
+				m_open = false;
+			}
+			else
+			{
+				// The file is read front to back, so the kernel can read ahead aggressively
+				madvise(mapping, m_size, MADV_SEQUENTIAL);
+				m_data = static_cast<const unsigned char*>(mapping);
+			}
+		}
+	}
+	// The mapping keeps the file open
+	::close(descriptor);
+#else
+	FILE* file = std::fopen(path, "rb");
+	if (!file)
+	{
+		return;
+	}
+	if (0 == std::fseek(file, 0, SEEK_END))
+	{
+		long size = std::ftell(file);
+		if (size >= 0 && 0 == std::fseek(file, 0, SEEK_SET))
+		{
+			m_size = static_cast<size_t>(size);
+			unsigned char* buffer = m_size > 0 ? new unsigned char[m_size] : nullptr;
+			m_open = m_size == std::fread(buffer, 1, m_size, file);
+			m_data = buffer;
+			m_buffered = true;
+		}
+	}
+	std::fclose(file);
+#endif
+	if (!m_open)
+	{
+		close();
+	}
+}
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+void MappedFile::close()
+{
+	if (m_buffered)
+	{
+		delete[] m_data;
+	}
+#if defined(_WIN32)
+	else if (m_data)
+	{
+		UnmapViewOfFile(m_data);
+	}
+	if (m_mapping)
+	{
+		CloseHandle(m_mapping);
+		m_mapping = nullptr;
+	}
+#elif defined(__unix__) || defined(__APPLE__)
+	else if (m_data)
+	{
+		munmap(const_cast<unsigned char*>(m_data), m_size);
+	}
+#endif
+	m_data = nullptr;
+	m_size = 0;
+	m_buffered = false;
+}
+
+bool MappedFile::is_open() const
+{
+	return m_open;
+}
+
+const unsigned char* MappedFile::data() const
+{
+	return m_data;
+}
+
+size_t MappedFile::size() const
+{
+	return m_size;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file MappedFile.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef MAPPEDFILE_HPP
+#define MAPPEDFILE_HPP
+
+
+#include <cstddef>
+
+
+/**
+ * @class MappedFile
+ * Read-only view of a whole file. The file is mapped into memory (mmap on Linux and other POSIX systems, a file mapping
+ * on Windows), so its pages are read by the operating system on first access instead of being copied into a buffer.
+ * On other systems the file is read into a buffer.
+ */
+class MappedFile
+{
+private:
+	// First byte of the file, nullptr if the file couldn't be opened or is empty
+	const unsigned char*	m_data;
+	// Size of the file in bytes
+	size_t					m_size;
+	// true if the file could be opened
+	bool					m_open;
+	// true if m_data is a buffer allocated by new[] instead of a mapping
+	bool					m_buffered;
+#ifdef _WIN32
+	// Handle of the file mapping
+	void*					m_mapping;
+#endif
+
+	/**
+	 * Unmaps the file or deletes the buffer.
+	 */
+	void close();
+
+public:
+	/**
+	 * Constructor for instances of the class MappedFile. Maps a file into memory.
+	 * @param	path	Path of the file
+	 */
+	explicit MappedFile(const char* path);
+
+	/**
+	 * Destructor for instances of the class MappedFile. Unmaps the file.
+	 */
+	~MappedFile();
+
+	/**
+	 * Checks if the file could be opened.
+	 * @return	true if the file could be opened, otherwise false
+	 */
+	bool is_open() const;
+
+	/**
+	 * Returns the content of the file. It is valid as long as the instance exists.
+	 * @return	Pointer to the first byte of the file, nullptr if the file couldn't be opened or is empty
+	 */
+	const unsigned char* data() const;
+
+	/**
+	 * Returns the size of the file.
+	 * @return	Size of the file in bytes
+	 */
+	size_t size() const;
+
+	// Instances of MappedFile own their mapping and can't be copied
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+};
+
+
+#endif // #ifndef MAPPEDFILE_HPP
@@ -57,3 +57,18 @@ bool Mutex::try_lock()
 	return (0 != TryEnterCriticalSection(static_cast<LPCRITICAL_SECTION>(&m_section)));
 #endif
 }
+
+void Mutex::lock_shared()
+{
+	lock();
+}
+
+void Mutex::unlock_shared()
+{
+	unlock();
+}
+
+bool Mutex::try_lock_shared()
+{
+	return try_lock();
+}
@@ -22,6 +22,9 @@
 class Mutex
 {
 private:
+	// ConditionVariable needs access to the native mutex object in order to wait for a notification
+	friend class ConditionVariable;
+
 #ifdef __linux__
 	// Mutex object of the Mutex class
 	pthread_mutex_t m_mutex;
@@ -56,6 +59,23 @@ public:
 	 * @return	true if the mutex is locked, false otherwise
 	 */
 	bool try_lock();
+
+	/**
+	 * Same as lock. Mutex doesn't distinguish between shared and exclusive locking, the method exists in order to use
+	 * Mutex and RWMutex interchangeably.
+	 */
+	void lock_shared();
+
+	/**
+	 * Same as unlock.
+	 */
+	void unlock_shared();
+
+	/**
+	 * Same as try_lock.
+	 * @return	true if the mutex is locked, false otherwise
+	 */
+	bool try_lock_shared();
 };
 
 
@@ -0,0 +1,43 @@
+/**
+ * @file ParallelForEach.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef PARALLELFOREACH_HPP
+#define PARALLELFOREACH_HPP
+
+
+#include <cstddef>
+
+
+/**
+ * Calls a function for every element of a range on several threads. The range is split into segments in a single pass,
+ * the threads take over the segments one by one, so threads finishing early help with the remaining segments.
+ * The calling thread processes segments as well. The first exception thrown by the function is rethrown after all
+ * threads have finished, the remaining segments are skipped.
+ * IMPORTANT: The function is called concurrently and must not add or remove elements of the list.
+ * @param	first	Iterator to the first element of the range
+ * @param	last	Iterator behind the last element of the range
+ * @param	count	Count of elements in the range
+ * @param	func	Function called for every element, it receives a reference to the element as a parameter
+ * @param	threads	Count of threads including the calling thread, 0 to use one thread per core
+ */
+template<typename Iterator, typename Function>
+void parallel_for_each(Iterator first, Iterator last, size_t count, const Function& func, unsigned int threads = 0);
+
+/**
+ * Calls a function for every element of a list or of a locked view of an SList on several threads, e.g.
+ * parallel_for_each(slist.locked_view(), func). See the function above for details.
+ * @param	range	List or view providing begin(), end() and size()
+ * @param	func	Function called for every element, it receives a reference to the element as a parameter
+ * @param	threads	Count of threads including the calling thread, 0 to use one thread per core
+ */
+template<typename Range, typename Function>
+void parallel_for_each(Range&& range, const Function& func, unsigned int threads = 0);
+
+
+// Include implementation of parallel_for_each
+#include "ParallelForEach.tpp"
+
+
+#endif // #ifndef PARALLELFOREACH_HPP
@@ -0,0 +1,116 @@
+/**
+ * @file ParallelForEach.tpp
+ * @date 17.10.2026
+ */
+
+#ifndef PARALLELFOREACH_HPP
+#error PARALLELFOREACH_HPP undefined
+#endif
+
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+#include "Mutex.hpp"
+
+template<typename Iterator, typename Function>
+void parallel_for_each(Iterator first, Iterator last, size_t count, const Function& func, unsigned int threads)
+{
+	if (0 == threads)
+	{
+		threads = std::thread::hardware_concurrency();
+	}
+	if (threads <= 1 || count < 2)
+	{
+		for (; first != last; ++first)
+		{
+			func(*first);
+		}
+		return;
+	}
+
+	// Use more segments than threads, so a slow segment doesn't keep the other threads waiting
+	size_t segments = static_cast<size_t>(threads) * 4;
+	if (segments > count)
+	{
+		segments = count;
+	}
+	if (threads > segments)
+	{
+		threads = static_cast<unsigned int>(segments);
+	}
+
+	// Find the boundaries of the segments, the lengths of the segments differ by one element at most
+	std::vector<Iterator> bounds;
+	bounds.reserve(segments + 1);
+	Iterator current = first;
+	for (size_t segment = 0; segment < segments; segment++)
+	{
+		bounds.push_back(current);
+		size_t length = count / segments + (segment < count % segments ? 1 : 0);
+		for (size_t i = 0; i < length; i++)
+		{
+			++current;
+		}
+	}
+	bounds.push_back(last);
+
+	std::atomic<size_t> nextSegment(0);
+	std::exception_ptr error;
+	Mutex errorMutex;
+	auto worker = [&]() -> void
+	{
+		size_t segment;
+		while ((segment = nextSegment.fetch_add(1)) < segments)
+		{
+			try
+			{
+				for (Iterator it = bounds[segment]; it != bounds[segment + 1]; ++it)
+				{
+					func(*it);
+				}
+			}
+			catch (...)
+			{
+				errorMutex.lock();
+				if (!error)
+				{
+					error = std::current_exception();
+				}
+				errorMutex.unlock();
+				// Skip the remaining segments
+				nextSegment.store(segments);
+			}
+		}
+	};
+
+	std::vector<std::thread> workers;
+	workers.reserve(threads - 1);
+	try
+	{
+		for (unsigned int t = 1; t < threads; t++)
+		{
+			workers.push_back(std::thread(worker));
+		}
+	}
+	catch (...)
+	{
+		// No more threads available, the started threads and the calling thread process all segments
+	}
+	worker();
+	for (auto& thread : workers)
+	{
+		thread.join();
+	}
+
+	if (error)
+	{
+		std::rethrow_exception(error);
+	}
+}
+
+template<typename Range, typename Function>
+void parallel_for_each(Range&& range, const Function& func, unsigned int threads)
+{
+	parallel_for_each(range.begin(), range.end(), static_cast<size_t>(range.size()), func, threads);
+}
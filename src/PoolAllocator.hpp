@@ -0,0 +1,187 @@
+/**
+ * @file PoolAllocator.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef POOLALLOCATOR_HPP
+#define POOLALLOCATOR_HPP
+
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+
+/**
+ * @class PoolAllocator
+ * Allocator for fixed-size blocks (e.g. the nodes of a list). Blocks are carved out of contiguous slabs and deallocated
+ * blocks are kept in an internal free list in order to be recycled by following allocations. All slabs can be
+ * returned to the heap at once by calling release. Slabs taken over from other allocators by splice are returned to the
+ * heap as soon as all of their blocks are free, so appending lists to a long-lived list doesn't grow it without limit.
+ * The allocator is not thread-safe. Every list owns its own instance of the allocator.
+ * @tparam	BlocksPerSlab	Count of blocks allocated at once when the allocator runs out of free blocks
+ */
+template<size_t BlocksPerSlab = 64>
+class PoolAllocator
+{
+private:
+	/**
+	 * @class Slab
+	 * Header of a slab. The blocks of the slab are stored directly behind the header.
+	 */
+	struct Slab
+	{
+		// Next slab of the allocator
+		Slab*	m_next;
+		// Count of blocks carved out of the slab, it is only up to date if the slab is not the current slab
+		size_t	m_blocks;
+	};
+
+	/**
+	 * @class FreeBlock
+	 * A deallocated block waiting to be recycled.
+	 */
+	struct FreeBlock
+	{
+		// Next block of the free list
+		FreeBlock*	m_next;
+	};
+
+	// Size of a block including padding for the alignment of the following block
+	size_t		m_blockSize;
+	// First slab of the allocator
+	Slab*		m_firstSlab;
+	// Last slab of the allocator
+	Slab*		m_lastSlab;
+	// First block of the free list
+	FreeBlock*	m_firstFree;
+	// Last block of the free list
+	FreeBlock*	m_lastFree;
+	// Slab containing m_cursor
+	Slab*		m_currentSlab;
+	// Next unused block of the current slab
+	char*		m_cursor;
+	// End of the current slab
+	char*		m_end;
+	// Count of blocks in the free list
+	size_t		m_freeCount;
+	// Count of free blocks from which on splice looks for slabs without used blocks
+	size_t		m_reclaimAt;
+
+	/**
+	 * Returns the size of a slab header including padding for the alignment of the first block.
+	 * @return	Size of the header in bytes
+	 */
+	static size_t header_size();
+
+	/**
+	 * Returns the first block of a slab.
+	 * @param	slab	Slab of the allocator
+	 * @return			Pointer to the first block
+	 */
+	static char* blocks_of(Slab* slab) { return reinterpret_cast<char*>(slab) + header_size(); }
+
+	/**
+	 * Stores the count of blocks carved out of the current slab in its header. The rest of the slab stays unused.
+	 */
+	void leave_current_slab();
+
+	/**
+	 * Allocates a new slab and appends it to the slabs of the allocator.
+	 * @param	blocks	Count of blocks of the slab
+	 */
+	void grow(size_t blocks);
+
+	/**
+	 * Takes over all slabs and free blocks of another allocator in constant time.
+	 * @param	other	Allocator to take the slabs from
+	 */
+	void take(PoolAllocator& other);
+
+	/**
+	 * Returns all slabs except the current one whose blocks are all in the free list to the heap and removes their
+	 * blocks from the free list.
+	 */
+	void reclaim_slabs();
+
+public:
+	/**
+	 * true if all blocks can be returned at once by calling release, so they don't need to be deallocated one by one.
+	 */
+	static constexpr bool BULK_RELEASE = true;
+
+	/**
+	 * true if blocks can be deallocated by any thread without locking the owner of the allocator.
+	 */
+	static constexpr bool THREAD_SAFE = false;
+
+	/**
+	 * Constructor for instances of the class PoolAllocator. No memory is allocated until the first call of allocate.
+	 * @param	blockSize	Size of the blocks in bytes
+	 * @param	alignment	Alignment of the blocks in bytes, it must be a power of two and must not exceed the alignment
+	 *						of std::max_align_t
+	 */
+	explicit PoolAllocator(size_t blockSize, size_t alignment = alignof(std::max_align_t));
+
+	/**
+	 * Destructor for instances of the class PoolAllocator. Returns all slabs to the heap.
+	 */
+	~PoolAllocator();
+
+	/**
+	 * Returns a block of the size passed to the constructor. Deallocated blocks are recycled first.
+	 * @return	Pointer to the block
+	 */
+	void* allocate();
+
+	/**
+	 * Makes sure that the following allocations of up to a count of blocks are carved out of a single slab. If the
+	 * current slab doesn't have enough unused blocks left, a slab for exactly this count of blocks is allocated and the
+	 * rest of the current slab stays unused until release is called.
+	 * @param	blocks	Count of blocks to reserve
+	 */
+	void reserve(size_t blocks);
+
+	/**
+	 * Puts a block back to the free list of the allocator.
+	 * @param	block	Block returned by allocate
+	 */
+	void deallocate(void* block);
+
+	/**
+	 * Returns all slabs to the heap at once. All blocks returned by allocate become invalid.
+	 */
+	void release();
+
+	/**
+	 * Takes over all slabs and free blocks of another allocator. Blocks allocated from the other allocator stay valid
+	 * and belong to this allocator afterwards. The other allocator is empty afterwards. Once the free blocks have
+	 * doubled since the last time, the slabs whose blocks are all free are returned to the heap, which takes amortized
+	 * constant time per deallocated block.
+	 * @param	other	Allocator to take the slabs from, it must use the same block size
+	 */
+	void splice(PoolAllocator& other);
+
+	/**
+	 * Returns the count of slabs held by the allocator.
+	 * @return	The count of slabs
+	 */
+	size_t slab_count() const;
+
+	/**
+	 * Swaps the slabs and free blocks of the allocator with the ones of another allocator.
+	 * @param	other	Allocator to swap with
+	 */
+	void swap(PoolAllocator& other);
+
+	// Instances of PoolAllocator own their slabs and can't be copied
+	PoolAllocator(const PoolAllocator&) = delete;
+	PoolAllocator& operator=(const PoolAllocator&) = delete;
+};
+
+
+// Include implementation of PoolAllocator
+#include "PoolAllocator.tpp"
+
+
+#endif // #ifndef POOLALLOCATOR_HPP
@@ -0,0 +1,326 @@
+/**
+ * @file PoolAllocator.tpp
+ * @date 17.10.2026
+ */
+
+#ifndef POOLALLOCATOR_HPP
+#error POOLALLOCATOR_HPP undefined
+#endif
+
+#include <algorithm>
+#include <functional>
+
+template<size_t BlocksPerSlab>
+size_t PoolAllocator<BlocksPerSlab>::header_size()
+{
+	// The blocks start behind the slab header, keep them aligned like the memory returned by operator new
+	return (sizeof(Slab) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+}
+
+template<size_t BlocksPerSlab>
+void PoolAllocator<BlocksPerSlab>::leave_current_slab()
+{
+	if (m_currentSlab)
+	{
+		m_currentSlab->m_blocks = static_cast<size_t>(m_cursor - blocks_of(m_currentSlab)) / m_blockSize;
+	}
+	m_currentSlab = nullptr;
+	m_cursor = nullptr;
+	m_end = nullptr;
+}
+
+template<size_t BlocksPerSlab>
+void PoolAllocator<BlocksPerSlab>::grow(size_t blocks)
+{
+	char* memory = static_cast<char*>(::operator new(header_size() + blocks * m_blockSize));
+	leave_current_slab();
+
+	Slab* slab = reinterpret_cast<Slab*>(memory);
+	slab->m_next = nullptr;
+	slab->m_blocks = blocks;
+	if (m_lastSlab)
+	{
+		m_lastSlab->m_next = slab;
+	}
+	else
+	{
+		m_firstSlab = slab;
+	}
+	m_lastSlab = slab;
+
+	m_currentSlab = slab;
+	m_cursor = blocks_of(slab);
+	m_end = m_cursor + blocks * m_blockSize;
+}
+
+template<size_t BlocksPerSlab>
+void PoolAllocator<BlocksPerSlab>::take(PoolAllocator& other)
+{
+	// Append the slabs of the other allocator
+	if (other.m_firstSlab)
+	{
+		if (m_lastSlab)
+		{
+			m_lastSlab->m_next = other.m_firstSlab;
+		}
+		else
+		{
+			m_firstSlab = other.m_firstSlab;
+		}
+		m_lastSlab = other.m_lastSlab;
+	}
+
+	// Append the free list of the other allocator
+	if (other.m_firstFree)
+	{
+		if (m_lastFree)
+		{
+			m_lastFree->m_next = other.m_firstFree;
+		}
+		else
+		{
+			m_firstFree = other.m_firstFree;
+		}
+		m_lastFree = other.m_lastFree;
+	}
+	m_freeCount += other.m_freeCount;
+
+	// Keep the larger one of both unused slab regions, the other one stays unused
+	if (other.m_end - other.m_cursor > m_end - m_cursor)
+	{
+		leave_current_slab();
+		m_currentSlab = other.m_currentSlab;
+		m_cursor = other.m_cursor;
+		m_end = other.m_end;
+	}
+	else
+	{
+		other.leave_current_slab();
+	}
+
+	other.m_firstSlab = nullptr;
+	other.m_lastSlab = nullptr;
+	other.m_firstFree = nullptr;
+	other.m_lastFree = nullptr;
+	other.m_currentSlab = nullptr;
+	other.m_cursor = nullptr;
+	other.m_end = nullptr;
+	other.m_freeCount = 0;
+}
+
+template<size_t BlocksPerSlab>
+void PoolAllocator<BlocksPerSlab>::reclaim_slabs()
+{
+	// Count the free blocks per slab, the slabs are sorted by their addresses to find the slab of a block
+	std::vector<char*> slabs;
+	for (Slab* slab = m_firstSlab; slab; slab = slab->m_next)
+	{
+		slabs.push_back(reinterpret_cast<char*>(slab));
+	}
+	std::sort(slabs.begin(), slabs.end(), std::less<char*>());
+	std::vector<size_t> freeBlocks(slabs.size(), 0);
+	for (FreeBlock* block = m_firstFree; block; block = block->m_next)
+	{
+		auto slab = std::upper_bound(slabs.begin(), slabs.end(), reinterpret_cast<char*>(block), std::less<char*>());
+		freeBlocks[static_cast<size_t>(slab - slabs.begin()) - 1]++;
+	}
+	auto unused = [&](Slab* slab) -> bool
+	{
+		const size_t index = static_cast<size_t>(std::lower_bound(slabs.begin(), slabs.end(),
+			reinterpret_cast<char*>(slab), std::less<char*>()) - slabs.begin());
+		return slab != m_currentSlab && freeBlocks[index] == slab->m_blocks;
+	};
+	auto containing = [&](FreeBlock* block) -> Slab*
+	{
+		auto slab = std::upper_bound(slabs.begin(), slabs.end(), reinterpret_cast<char*>(block), std::less<char*>());
+		return reinterpret_cast<Slab*>(*(slab - 1));
+	};
+
+	// Remove the blocks of the unused slabs from the free list, keeping the order of the other blocks
+	FreeBlock* firstFree = nullptr;
+	FreeBlock* lastFree = nullptr;
+	size_t freeCount = 0;
+	for (FreeBlock* block = m_firstFree; block; block = block->m_next)
+	{
+		if (!unused(containing(block)))
+		{
+			if (lastFree)
+			{
+				lastFree->m_next = block;
+			}
+			else
+			{
+				firstFree = block;
+			}
+			lastFree = block;
+			freeCount++;
+		}
+	}
+	if (lastFree)
+	{
+		lastFree->m_next = nullptr;
+	}
+
+	// Unlink the unused slabs and return them to the heap
+	Slab* previous = nullptr;
+	Slab* current = m_firstSlab;
+	while (current)
+	{
+		Slab* next = current->m_next;
+		if (unused(current))
+		{
+			if (previous)
+			{
+				previous->m_next = next;
+			}
+			else
+			{
+				m_firstSlab = next;
+			}
+			::operator delete(current);
+		}
+		else
+		{
+			previous = current;
+		}
+		current = next;
+	}
+	m_lastSlab = previous;
+	m_firstFree = firstFree;
+	m_lastFree = lastFree;
+	m_freeCount = freeCount;
+}
+
+template<size_t BlocksPerSlab>
+PoolAllocator<BlocksPerSlab>::PoolAllocator(size_t blockSize, size_t alignment) : m_blockSize(0), m_firstSlab(nullptr),
+	m_lastSlab(nullptr), m_firstFree(nullptr), m_lastFree(nullptr), m_currentSlab(nullptr), m_cursor(nullptr),
+	m_end(nullptr), m_freeCount(0), m_reclaimAt(BlocksPerSlab)
+{
+	static_assert(BlocksPerSlab > 0, "A slab must contain at least one block");
+
+	// A block must be able to hold a free list entry and keep the following block aligned
+	if (blockSize < sizeof(FreeBlock))
+	{
+		blockSize = sizeof(FreeBlock);
+	}
+	if (alignment < alignof(FreeBlock))
+	{
+		alignment = alignof(FreeBlock);
+	}
+	m_blockSize = (blockSize + alignment - 1) & ~(alignment - 1);
+}
+
+template<size_t BlocksPerSlab>
+PoolAllocator<BlocksPerSlab>::~PoolAllocator()
+{
+	release();
+}
+
+template<size_t BlocksPerSlab>
+void* PoolAllocator<BlocksPerSlab>::allocate()
+{
+	if (m_firstFree)
+	{
+		// Recycle a deallocated block
+		FreeBlock* block = m_firstFree;
+		m_firstFree = block->m_next;
+		if (!m_firstFree)
+		{
+			m_lastFree = nullptr;
+		}
+		m_freeCount--;
+		return block;
+	}
+
+	if (m_cursor == m_end)
+	{
+		grow(BlocksPerSlab);
+	}
+	void* block = m_cursor;
+	m_cursor += m_blockSize;
+	return block;
+}
+
+template<size_t BlocksPerSlab>
+void PoolAllocator<BlocksPerSlab>::reserve(size_t blocks)
+{
+	if (static_cast<size_t>(m_end - m_cursor) / m_blockSize < blocks)
+	{
+		grow(blocks);
+	}
+}
+
+template<size_t BlocksPerSlab>
+void PoolAllocator<BlocksPerSlab>::deallocate(void* block)
+{
+	FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+	freeBlock->m_next = m_firstFree;
+	if (!m_firstFree)
+	{
+		m_lastFree = freeBlock;
+	}
+	m_firstFree = freeBlock;
+	m_freeCount++;
+}
+
+template<size_t BlocksPerSlab>
+void PoolAllocator<BlocksPerSlab>::release()
+{
+	Slab* current = m_firstSlab;
+	while (current)
+	{
+		Slab* next = current->m_next;
+		::operator delete(current);
+		current = next;
+	}
+	m_firstSlab = nullptr;
+	m_lastSlab = nullptr;
+	m_firstFree = nullptr;
+	m_lastFree = nullptr;
+	m_currentSlab = nullptr;
+	m_cursor = nullptr;
+	m_end = nullptr;
+	m_freeCount = 0;
+	m_reclaimAt = BlocksPerSlab;
+}
+
+template<size_t BlocksPerSlab>
+void PoolAllocator<BlocksPerSlab>::splice(PoolAllocator& other)
+{
+	if (this == &other)
+	{
+		return;
+	}
+
+	take(other);
+
+	// Allocations recycle free blocks before carving new ones, but the slabs taken over add blocks without allocating
+	// them, so a list which only receives nodes by splice would keep the blocks of all its removed nodes. Look for
+	// unused slabs whenever the free blocks have doubled, so the search takes amortized constant time per block.
+	if (m_freeCount >= m_reclaimAt)
+	{
+		reclaim_slabs();
+		m_reclaimAt = std::max(2 * m_freeCount, BlocksPerSlab);
+	}
+}
+
+template<size_t BlocksPerSlab>
+size_t PoolAllocator<BlocksPerSlab>::slab_count() const
+{
+	size_t ret = 0;
+	for (Slab* slab = m_firstSlab; slab; slab = slab->m_next)
+	{
+		ret++;
+	}
+	return ret;
+}
+
+template<size_t BlocksPerSlab>
+void PoolAllocator<BlocksPerSlab>::swap(PoolAllocator& other)
+{
+	PoolAllocator temp(m_blockSize);
+	temp.take(*this);
+	take(other);
+	other.take(temp);
+	std::swap(m_reclaimAt, other.m_reclaimAt);
+}
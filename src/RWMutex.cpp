@@ -0,0 +1,78 @@
+/**
+ * @file RWMutex.cpp
+ * @date 17.10.2026
+ */
+
+#include "RWMutex.hpp"
+
+RWMutex::RWMutex()
+{
+#ifdef __linux__
+	pthread_rwlock_init(&m_lock, nullptr);
+#elif defined(_WIN32)
+	InitializeSRWLock(&m_lock);
+#endif
+}
+
+RWMutex::~RWMutex()
+{
+#ifdef __linux__
+	pthread_rwlock_destroy(&m_lock);
+#elif defined(_WIN32)
+	// Nothing to do, slim reader/writer locks don't need to be destroyed
+#endif
+}
+
+void RWMutex::lock()
+{
+#ifdef __linux__
+	pthread_rwlock_wrlock(&m_lock);
+#elif defined(_WIN32)
+	AcquireSRWLockExclusive(&m_lock);
+#endif
+}
+
+void RWMutex::unlock()
+{
+#ifdef __linux__
+	pthread_rwlock_unlock(&m_lock);
+#elif defined(_WIN32)
+	ReleaseSRWLockExclusive(&m_lock);
+#endif
+}
+
+bool RWMutex::try_lock()
+{
+#ifdef __linux__
+	return (0 == pthread_rwlock_trywrlock(&m_lock));
+#elif defined(_WIN32)
+	return (0 != TryAcquireSRWLockExclusive(&m_lock));
+#endif
+}
+
+void RWMutex::lock_shared()
+{
+#ifdef __linux__
+	pthread_rwlock_rdlock(&m_lock);
+#elif defined(_WIN32)
+	AcquireSRWLockShared(&m_lock);
+#endif
+}
+
+void RWMutex::unlock_shared()
+{
+#ifdef __linux__
+	pthread_rwlock_unlock(&m_lock);
+#elif defined(_WIN32)
+	ReleaseSRWLockShared(&m_lock);
+#endif
+}
+
+bool RWMutex::try_lock_shared()
+{
+#ifdef __linux__
+	return (0 == pthread_rwlock_tryrdlock(&m_lock));
+#elif defined(_WIN32)
+	return (0 != TryAcquireSRWLockShared(&m_lock));
+#endif
+}
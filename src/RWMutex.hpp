@@ -0,0 +1,79 @@
+/**
+ * @file RWMutex.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef RWMUTEX_HPP
+#define RWMUTEX_HPP
+
+
+#ifdef __linux__
+#include <pthread.h>
+#elif defined(_WIN32)
+#include <windows.h>
+#endif
+
+
+/**
+ * @class RWMutex
+ * Reader/writer mutex implementation like the std::shared_mutex class of the STL. Any count of threads can hold the
+ * mutex in shared mode at the same time, but only one thread can hold it in exclusive mode.
+ * In contrast to Mutex the RWMutex is not recursive. A thread must not lock it again while it is holding it.
+ */
+class RWMutex
+{
+private:
+#ifdef __linux__
+	// Read-write lock object of the RWMutex class
+	pthread_rwlock_t m_lock;
+#elif defined(_WIN32)
+	// Slim reader/writer lock object of the RWMutex class
+	SRWLOCK m_lock;
+#endif
+
+public:
+	/**
+	 * Constructor for instances of the class RWMutex.
+	 */
+	RWMutex();
+
+	/**
+	 * Destructor for instances of the class RWMutex.
+	 */
+	virtual ~RWMutex();
+
+	/**
+	 * Blocks until the mutex can be locked exclusively. Locks the mutex for the calling thread.
+	 */
+	void lock();
+
+	/**
+	 * Unlocks the mutex after it was locked exclusively.
+	 */
+	void unlock();
+
+	/**
+	 * Tries to lock the mutex exclusively. The method returns immediately.
+	 * @return	true if the mutex is locked, false otherwise
+	 */
+	bool try_lock();
+
+	/**
+	 * Blocks until the mutex can be locked in shared mode. Other threads may hold the mutex in shared mode as well.
+	 */
+	void lock_shared();
+
+	/**
+	 * Unlocks the mutex after it was locked in shared mode.
+	 */
+	void unlock_shared();
+
+	/**
+	 * Tries to lock the mutex in shared mode. The method returns immediately.
+	 * @return	true if the mutex is locked, false otherwise
+	 */
+	bool try_lock_shared();
+};
+
+
+#endif // #ifndef RWMUTEX_HPP
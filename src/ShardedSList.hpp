@@ -0,0 +1,214 @@
+/**
+ * @file ShardedSList.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef SHARDEDSLIST_HPP
+#define SHARDEDSLIST_HPP
+
+
+#include <atomic>
+#include <cstddef>
+#include "List.hpp"
+#include "Mutex.hpp"
+
+
+/**
+ * @class ShardedSList
+ * A thread-safe list class which consists of several independent lists (shards), each with its own mutex. Every thread
+ * adds elements to and removes elements from its own shard, so threads only contend if they share a shard or if a
+ * thread has to steal elements from another shard because its own shard is empty.
+ * The order of the elements is kept per shard only: elements added by the same thread are removed in the same order
+ * unless they are stolen, there is no global order across the shards.
+ * @tparam	T			Type of the elements of the list
+ * @tparam	Allocator	Allocator for the nodes of the shards, e.g. PoolAllocator (default) or HeapAllocator
+ * @tparam	MutexType	Mutex used to lock a shard, e.g. Mutex (default), RWMutex or AdaptiveMutex
+ */
+template<typename T, typename Allocator = PoolAllocator<>, typename MutexType = Mutex>
+class ShardedSList
+{
+private:
+	/**
+	 * @class Shard
+	 * A list with its own mutex. The padding keeps the mutexes of neighbouring shards in different cache lines.
+	 */
+	struct Shard
+	{
+		// Elements of the shard
+		List<T, Allocator>	m_list;
+		// Mutex guarding m_list
+		mutable MutexType	m_mutex;
+		// Count of elements in m_list, it can be read without locking m_mutex
+		std::atomic<size_t>	m_count;
+		// Padding against false sharing
+		char				m_padding[64];
+
+		/**
+		 * Constructor for instances of the class Shard.
+		 */
+		Shard() : m_list(), m_mutex(), m_count(0) {}
+	};
+
+	/**
+	 * @class ExclusiveLock
+	 * Locks the mutex of a shard exclusively while it exists. m_count is updated before unlocking, also if the locked
+	 * method throws.
+	 */
+	class ExclusiveLock
+	{
+	private:
+		// Shard to lock
+		Shard&	m_shard;
+
+	public:
+		explicit ExclusiveLock(Shard& shard) : m_shard(shard) { m_shard.m_mutex.lock(); }
+		~ExclusiveLock()
+		{
+			m_shard.m_count.store(m_shard.m_list.size(), std::memory_order_release);
+			m_shard.m_mutex.unlock();
+		}
+		ExclusiveLock(const ExclusiveLock&) = delete;
+		ExclusiveLock& operator=(const ExclusiveLock&) = delete;
+	};
+
+	/**
+	 * @class SharedLock
+	 * Locks the mutex of a shard in shared mode while it exists.
+	 */
+	class SharedLock
+	{
+	private:
+		// Shard to lock
+		const Shard&	m_shard;
+
+	public:
+		explicit SharedLock(const Shard& shard) : m_shard(shard) { m_shard.m_mutex.lock_shared(); }
+		~SharedLock() { m_shard.m_mutex.unlock_shared(); }
+		SharedLock(const SharedLock&) = delete;
+		SharedLock& operator=(const SharedLock&) = delete;
+	};
+
+	// Shards of the list
+	Shard*	m_shards;
+	// Count of shards
+	size_t	m_shardCount;
+
+	/**
+	 * Returns the index of the shard of the calling thread. Threads are assigned to shards round-robin on their first
+	 * call.
+	 * @return	Index of the shard of the calling thread
+	 */
+	size_t local_shard() const;
+
+	/**
+	 * Removes the first element from a shard if the shard is not empty.
+	 * @param	shard	Shard to remove the element from
+	 * @param	element	Receives the removed element, it is left unchanged if the shard is empty
+	 * @return			true if an element was removed, false if the shard is empty
+	 */
+	static bool pop_shard(Shard& shard, T& element);
+
+public:
+	/**
+	 * Constructor for instances of the class ShardedSList.
+	 * @param	shards	Count of shards, 0 to use one shard per core
+	 */
+	explicit ShardedSList(size_t shards = 0);
+
+	/**
+	 * Destructor for instances of the class ShardedSList.
+	 */
+	~ShardedSList();
+
+	/**
+	 * Returns the count of shards.
+	 * @return	The count of shards
+	 */
+	size_t shard_count() const;
+
+	/**
+	 * Returns the count of elements in all shards at the time of the call. The shards are not locked, so the result is
+	 * not a consistent snapshot if other threads change the list.
+	 * @return	The count of elements in the list
+	 */
+	size_t size() const;
+
+	/**
+	 * Checks if all shards are empty at the time of the call. The shards are not locked.
+	 * @return	true if the list is empty, otherwise false
+	 */
+	bool empty() const;
+
+	/**
+	 * Removes all elements from the list. The shards are locked one after another.
+	 */
+	void clear();
+
+	/**
+	 * Adds an element to the back of the shard of the calling thread.
+	 * @param	element	Element to add to the list
+	 */
+	void push(const T& element);
+
+	/**
+	 * Adds an element to the back of the shard of the calling thread by moving it into the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push(T&& element);
+
+	/**
+	 * Adds an element to the back of the shard of the calling thread which is constructed in place.
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	void emplace(Args&&... args);
+
+	/**
+	 * Removes the first element of the shard of the calling thread. If the shard is empty, the first element of another
+	 * shard is removed.
+	 * @param	element	Receives the removed element, it is left unchanged if no element was removed
+	 * @return			true if an element was removed, false if all shards are empty
+	 */
+	bool try_pop(T& element);
+
+	/**
+	 * Iterates all shards using a function pointer as callback function for every element in the list. The shards are
+	 * locked one after another, so the iteration is not a consistent snapshot of the whole list.
+	 * @param	func		Pointer to a callback function called for every element in the list
+	 * @param	parameter	A user-defined parameter to be passed to the callback function, it can be NULL
+	 */
+	void iterate(const typename List<T, Allocator>::IterationFunction& func, void* parameter = nullptr);
+
+	/**
+	 * Iterates all shards using a lambda function as callback function for every element in the list. The shards are
+	 * locked one after another, so the iteration is not a consistent snapshot of the whole list.
+	 * The callback lambda function should have the following signature:
+	 * auto func = [your lambda capture list goes here](T& element) -> ListInterationAction { your code goes here };
+	 * @param	func	Callback lambda function called for every element in the list. It receives a reference to the
+	 *					current element as a parameter.
+	 */
+	template<typename Lambda>
+	void iterate(const Lambda& func);
+
+	/**
+	 * Iterates all shards without changing them using a lambda function as callback function for every element in the
+	 * list. The shards are locked in shared mode one after another. The callback lambda function should have the
+	 * following signature:
+	 * auto func = [your lambda capture list goes here](const T& element) -> ListInterationAction { your code goes here };
+	 * @param	func	Callback lambda function called for every element in the list. It receives a const reference to
+	 *					the current element as a parameter.
+	 */
+	template<typename Lambda>
+	void iterate(const Lambda& func) const;
+
+	// Instances of ShardedSList can't be copied since other threads might access them during the copy
+	ShardedSList(const ShardedSList&) = delete;
+	ShardedSList& operator=(const ShardedSList&) = delete;
+};
+
+
+// Include implementation of ShardedSList
+#include "ShardedSList.tpp"
+
+
+#endif // #ifndef SHARDEDSLIST_HPP
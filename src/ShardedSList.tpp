@@ -0,0 +1,183 @@
+/**
+ * @file ShardedSList.tpp
+ * @date 17.10.2026
+ */
+
+#ifndef SHARDEDSLIST_HPP
+#error SHARDEDSLIST_HPP undefined
+#endif
+
+#include <thread>
+#include <utility>
+
+template<typename T, typename Allocator, typename MutexType>
+size_t ShardedSList<T, Allocator, MutexType>::local_shard() const
+{
+	// Hashing the thread id distributes badly since thread ids are often aligned addresses, count the threads instead
+	static std::atomic<size_t> nextThread(0);
+	static thread_local size_t threadIndex = nextThread.fetch_add(1, std::memory_order_relaxed);
+	return threadIndex % m_shardCount;
+}
+
+template<typename T, typename Allocator, typename MutexType>
+bool ShardedSList<T, Allocator, MutexType>::pop_shard(Shard& shard, T& element)
+{
+	ExclusiveLock lock(shard);
+	return shard.m_list.try_pop_front(element);
+}
+
+template<typename T, typename Allocator, typename MutexType>
+ShardedSList<T, Allocator, MutexType>::ShardedSList(size_t shards) : m_shards(nullptr), m_shardCount(shards)
+{
+	if (0 == m_shardCount)
+	{
+		m_shardCount = std::thread::hardware_concurrency();
+		if (0 == m_shardCount)
+		{
+			m_shardCount = 1;
+		}
+	}
+	m_shards = new Shard[m_shardCount];
+}
+
+template<typename T, typename Allocator, typename MutexType>
+ShardedSList<T, Allocator, MutexType>::~ShardedSList()
+{
+	delete[] m_shards;
+}
+
+template<typename T, typename Allocator, typename MutexType>
+size_t ShardedSList<T, Allocator, MutexType>::shard_count() const
+{
+	return m_shardCount;
+}
+
+template<typename T, typename Allocator, typename MutexType>
+size_t ShardedSList<T, Allocator, MutexType>::size() const
+{
+	size_t ret = 0;
+	for (size_t i = 0; i < m_shardCount; i++)
+	{
+		ret += m_shards[i].m_count.load(std::memory_order_acquire);
+	}
+	return ret;
+}
+
+template<typename T, typename Allocator, typename MutexType>
+bool ShardedSList<T, Allocator, MutexType>::empty() const
+{
+	for (size_t i = 0; i < m_shardCount; i++)
+	{
+		if (0 != m_shards[i].m_count.load(std::memory_order_acquire))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+template<typename T, typename Allocator, typename MutexType>
+void ShardedSList<T, Allocator, MutexType>::clear()
+{
+	for (size_t i = 0; i < m_shardCount; i++)
+	{
+		Shard& shard = m_shards[i];
+		ExclusiveLock lock(shard);
+		shard.m_list.clear();
+	}
+}
+
+template<typename T, typename Allocator, typename MutexType>
+void ShardedSList<T, Allocator, MutexType>::push(const T& element)
+{
+	Shard& shard = m_shards[local_shard()];
+	ExclusiveLock lock(shard);
+	shard.m_list.push_back(element);
+}
+
+template<typename T, typename Allocator, typename MutexType>
+void ShardedSList<T, Allocator, MutexType>::push(T&& element)
+{
+	Shard& shard = m_shards[local_shard()];
+	ExclusiveLock lock(shard);
+	shard.m_list.push_back(std::move(element));
+}
+
+template<typename T, typename Allocator, typename MutexType>
+template<typename... Args>
+void ShardedSList<T, Allocator, MutexType>::emplace(Args&&... args)
+{
+	Shard& shard = m_shards[local_shard()];
+	ExclusiveLock lock(shard);
+	shard.m_list.emplace_back(std::forward<Args>(args)...);
+}
+
+template<typename T, typename Allocator, typename MutexType>
+bool ShardedSList<T, Allocator, MutexType>::try_pop(T& element)
+{
+	const size_t local = local_shard();
+	if (pop_shard(m_shards[local], element))
+	{
+		return true;
+	}
+
+	// Steal from the other shards, skip shards which are empty without locking them
+	for (size_t i = 1; i < m_shardCount; i++)
+	{
+		Shard& shard = m_shards[(local + i) % m_shardCount];
+		if (0 != shard.m_count.load(std::memory_order_acquire) && pop_shard(shard, element))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+template<typename T, typename Allocator, typename MutexType>
+void ShardedSList<T, Allocator, MutexType>::iterate(const typename List<T, Allocator>::IterationFunction& func,
+	void* parameter)
+{
+	auto callFunction = [&func, parameter](T& element) -> ListIterationAction
+	{
+		return func(element, parameter);
+	};
+	iterate(callFunction);
+}
+
+template<typename T, typename Allocator, typename MutexType>
+template<typename Lambda>
+void ShardedSList<T, Allocator, MutexType>::iterate(const Lambda& func)
+{
+	bool stop = false;
+	auto callFunction = [&func, &stop](T& element) -> ListIterationAction
+	{
+		ListIterationAction action = func(element);
+		stop = 0 != (action & ListIterationAction::ACTION_BREAK);
+		return action;
+	};
+	for (size_t i = 0; i < m_shardCount && !stop; i++)
+	{
+		Shard& shard = m_shards[i];
+		ExclusiveLock lock(shard);
+		shard.m_list.iterate(callFunction);
+	}
+}
+
+template<typename T, typename Allocator, typename MutexType>
+template<typename Lambda>
+void ShardedSList<T, Allocator, MutexType>::iterate(const Lambda& func) const
+{
+	bool stop = false;
+	auto callFunction = [&func, &stop](const T& element) -> ListIterationAction
+	{
+		ListIterationAction action = func(element);
+		stop = 0 != (action & ListIterationAction::ACTION_BREAK);
+		return action;
+	};
+	for (size_t i = 0; i < m_shardCount && !stop; i++)
+	{
+		const Shard& shard = m_shards[i];
+		SharedLock lock(shard);
+		static_cast<const List<T, Allocator>&>(shard.m_list).iterate(callFunction);
+	}
+}
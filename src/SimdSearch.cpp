@@ -0,0 +1,583 @@
+/**
+ * @file SimdSearch.cpp
+ * @date 17.10.2026
+ */
+
+#include "SimdSearch.hpp"
+
+#include <atomic>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define SIMD_SEARCH_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// g++ and clang only allow intrinsics in functions compiled for their instruction set, Visual Studio allows all of them
+#if defined(SIMD_SEARCH_X86) && defined(__GNUC__)
+#define TARGET_SSE2 __attribute__((target("sse2")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_SSE2
+#define TARGET_AVX2
+#endif
+
+/**
+ * Detects the best instruction set supported by the processor and the operating system.
+ * @return	The best supported instruction set
+ */
+static SimdSearch::InstructionSet detect_instruction_set()
+{
+#if defined(SIMD_SEARCH_X86) && defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	int maxLeaf = info[0];
+	__cpuid(info, 1);
+	bool sse2 = 0 != (info[3] & (1 << 26));
+	// AVX2 needs the operating system to save the upper halves of the registers (OSXSAVE and XCR0)
+	bool avx2 = false;
+	if (maxLeaf >= 7 && 0 != (info[2] & (1 << 27)) && 0 != (info[2] & (1 << 28)) && 6 == (_xgetbv(0) & 6))
+	{
+		__cpuidex(info, 7, 0);
+		avx2 = 0 != (info[1] & (1 << 5));
+	}
+#elif defined(SIMD_SEARCH_X86)
+	// __builtin_cpu_supports checks the support of the operating system as well
+	__builtin_cpu_init();
+	bool sse2 = __builtin_cpu_supports("sse2");
+	bool avx2 = __builtin_cpu_supports("avx2");
+#else
+	bool sse2 = false;
+	bool avx2 = false;
+#endif
+	return avx2 ? SimdSearch::INSTRUCTION_SET_AVX2 : sse2 ? SimdSearch::INSTRUCTION_SET_SSE2 :
+		SimdSearch::INSTRUCTION_SET_SCALAR;
+}
+
+// Best instruction set of the processor
+static const SimdSearch::InstructionSet s_supportedInstructionSet = detect_instruction_set();
+// Instruction set in use. Searches running before the static initialization are zero-initialized, so they run scalar.
+static std::atomic<int> s_instructionSet(s_supportedInstructionSet);
+
+/**
+ * Returns the index of the first element equal to a value one element at a time. The elements are copied out of the
+ * array since it may contain integers of another signedness.
+ * @param	elements	Array to search
+ * @param	count		Count of elements in the array
+ * @param	value		Value to search for
+ * @return				Index of the first element equal to value, count if no element is equal to value
+ */
+template<typename Element>
+static size_t find_scalar(const unsigned char* elements, size_t count, Element value)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		Element element;
+		std::memcpy(&element, elements + i * sizeof(Element), sizeof(Element));
+		if (value == element)
+		{
+			return i;
+		}
+	}
+	return count;
+}
+
+/**
+ * Counts the elements equal to a value one element at a time.
+ * @param	elements	Array to search
+ * @param	count		Count of elements in the array
+ * @param	value		Value to search for
+ * @return				The count of elements equal to value
+ */
+template<typename Element>
+static size_t count_scalar(const unsigned char* elements, size_t count, Element value)
+{
+	size_t matches = 0;
+	for (size_t i = 0; i < count; i++)
+	{
+		Element element;
+		std::memcpy(&element, elements + i * sizeof(Element), sizeof(Element));
+		if (value == element)
+		{
+			matches++;
+		}
+	}
+	return matches;
+}
+
+#ifdef SIMD_SEARCH_X86
+
+/**
+ * Returns the index of the lowest set bit.
+ * @param	mask	Mask with at least one bit set
+ * @return			Index of the lowest set bit
+ */
+static inline unsigned int lowest_bit(unsigned int mask)
+{
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return index;
+#else
+	return __builtin_ctz(mask);
+#endif
+}
+
+// Count of registers summed up per lane before the lanes are added, it keeps 32 bit lanes from overflowing
+static const size_t COUNT_BLOCK = 1 << 16;
+
+/**
+ * Adds the 32 bit lanes of a register.
+ * @param	sums	Register to add
+ * @return			Sum of the lanes
+ */
+TARGET_SSE2 static inline size_t sum_int32_sse2(__m128i sums)
+{
+	uint32_t lanes[4];
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), sums);
+	return static_cast<size_t>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+}
+
+/**
+ * Adds the 64 bit lanes of a register.
+ * @param	sums	Register to add
+ * @return			Sum of the lanes
+ */
+TARGET_SSE2 static inline size_t sum_int64_sse2(__m128i sums)
+{
+	uint64_t lanes[2];
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), sums);
+	return static_cast<size_t>(lanes[0] + lanes[1]);
+}
+
+/**
+ * Adds the 32 bit lanes of a register.
+ * @param	sums	Register to add
+ * @return			Sum of the lanes
+ */
+TARGET_AVX2 static inline size_t sum_int32_avx2(__m256i sums)
+{
+	return sum_int32_sse2(_mm_add_epi32(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1)));
+}
+
+/**
+ * Adds the 64 bit lanes of a register.
+ * @param	sums	Register to add
+ * @return			Sum of the lanes
+ */
+TARGET_AVX2 static inline size_t sum_int64_avx2(__m256i sums)
+{
+	return sum_int64_sse2(_mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1)));
+}
+
+/**
+ * Compares two registers of 64 bit integers. SSE2 only compares 32 bit halves, both halves have to be equal.
+ * @param	a	First register
+ * @param	b	Second register
+ * @return		Register with all bits set in the lanes of equal elements
+ */
+TARGET_SSE2 static inline __m128i compare_int64_sse2(__m128i a, __m128i b)
+{
+	__m128i halves = _mm_cmpeq_epi32(a, b);
+	return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+/*
+ * Kernels of the instruction sets. They compare a register of elements per iteration and the remaining elements one at
+ * a time, the results equal the results of find_scalar and count_scalar.
+ */
+
+TARGET_SSE2 static size_t find_int32_sse2(const unsigned char* elements, size_t count, uint32_t value)
+{
+	const __m128i needle = _mm_set1_epi32(static_cast<int>(value));
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(elements + i * 4));
+		int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle)));
+		if (mask)
+		{
+			return i + lowest_bit(mask);
+		}
+	}
+	return i + find_scalar(elements + i * 4, count - i, value);
+}
+
+TARGET_SSE2 static size_t count_int32_sse2(const unsigned char* elements, size_t count, uint32_t value)
+{
+	const __m128i needle = _mm_set1_epi32(static_cast<int>(value));
+	size_t matches = 0;
+	size_t i = 0;
+	while (i + 4 <= count)
+	{
+		// Equal elements subtract -1 from their lane
+		__m128i sums = _mm_setzero_si128();
+		for (size_t end = i + 4 * COUNT_BLOCK; i + 4 <= count && i < end; i += 4)
+		{
+			__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(elements + i * 4));
+			sums = _mm_sub_epi32(sums, _mm_cmpeq_epi32(block, needle));
+		}
+		matches += sum_int32_sse2(sums);
+	}
+	return matches + count_scalar(elements + i * 4, count - i, value);
+}
+
+TARGET_SSE2 static size_t find_int64_sse2(const unsigned char* elements, size_t count, uint64_t value)
+{
+	const __m128i needle = _mm_set_epi32(static_cast<int>(value >> 32), static_cast<int>(value),
+		static_cast<int>(value >> 32), static_cast<int>(value));
+	size_t i = 0;
+	for (; i + 2 <= count; i += 2)
+	{
+		__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(elements + i * 8));
+		int mask = _mm_movemask_pd(_mm_castsi128_pd(compare_int64_sse2(block, needle)));
+		if (mask)
+		{
+			return i + lowest_bit(mask);
+		}
+	}
+	return i + find_scalar(elements + i * 8, count - i, value);
+}
+
+TARGET_SSE2 static size_t count_int64_sse2(const unsigned char* elements, size_t count, uint64_t value)
+{
+	const __m128i needle = _mm_set_epi32(static_cast<int>(value >> 32), static_cast<int>(value),
+		static_cast<int>(value >> 32), static_cast<int>(value));
+	// Equal elements subtract -1 from their lane
+	__m128i sums = _mm_setzero_si128();
+	size_t i = 0;
+	for (; i + 2 <= count; i += 2)
+	{
+		__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(elements + i * 8));
+		sums = _mm_sub_epi64(sums, compare_int64_sse2(block, needle));
+	}
+	return sum_int64_sse2(sums) + count_scalar(elements + i * 8, count - i, value);
+}
+
+TARGET_SSE2 static size_t find_float_sse2(const float* elements, size_t count, float value)
+{
+	const __m128 needle = _mm_set1_ps(value);
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(elements + i), needle));
+		if (mask)
+		{
+			return i + lowest_bit(mask);
+		}
+	}
+	return i + find_scalar(reinterpret_cast<const unsigned char*>(elements + i), count - i, value);
+}
+
+TARGET_SSE2 static size_t count_float_sse2(const float* elements, size_t count, float value)
+{
+	const __m128 needle = _mm_set1_ps(value);
+	size_t matches = 0;
+	size_t i = 0;
+	while (i + 4 <= count)
+	{
+		// Equal elements subtract -1 from their lane
+		__m128i sums = _mm_setzero_si128();
+		for (size_t end = i + 4 * COUNT_BLOCK; i + 4 <= count && i < end; i += 4)
+		{
+			sums = _mm_sub_epi32(sums, _mm_castps_si128(_mm_cmpeq_ps(_mm_loadu_ps(elements + i), needle)));
+		}
+		matches += sum_int32_sse2(sums);
+	}
+	return matches + count_scalar(reinterpret_cast<const unsigned char*>(elements + i), count - i, value);
+}
+
+TARGET_SSE2 static size_t find_double_sse2(const double* elements, size_t count, double value)
+{
+	const __m128d needle = _mm_set1_pd(value);
+	size_t i = 0;
+	for (; i + 2 <= count; i += 2)
+	{
+		int mask = _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(elements + i), needle));
+		if (mask)
+		{
+			return i + lowest_bit(mask);
+		}
+	}
+	return i + find_scalar(reinterpret_cast<const unsigned char*>(elements + i), count - i, value);
+}
+
+TARGET_SSE2 static size_t count_double_sse2(const double* elements, size_t count, double value)
+{
+	const __m128d needle = _mm_set1_pd(value);
+	// Equal elements subtract -1 from their lane
+	__m128i sums = _mm_setzero_si128();
+	size_t i = 0;
+	for (; i + 2 <= count; i += 2)
+	{
+		sums = _mm_sub_epi64(sums, _mm_castpd_si128(_mm_cmpeq_pd(_mm_loadu_pd(elements + i), needle)));
+	}
+	return sum_int64_sse2(sums) + count_scalar(reinterpret_cast<const unsigned char*>(elements + i), count - i, value);
+}
+
+TARGET_AVX2 static size_t find_int32_avx2(const unsigned char* elements, size_t count, uint32_t value)
+{
+	const __m256i needle = _mm256_set1_epi32(static_cast<int>(value));
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(elements + i * 4));
+		int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle)));
+		if (mask)
+		{
+			return i + lowest_bit(mask);
+		}
+	}
+	return i + find_scalar(elements + i * 4, count - i, value);
+}
+
+TARGET_AVX2 static size_t count_int32_avx2(const unsigned char* elements, size_t count, uint32_t value)
+{
+	const __m256i needle = _mm256_set1_epi32(static_cast<int>(value));
+	size_t matches = 0;
+	size_t i = 0;
+	while (i + 8 <= count)
+	{
+		// Equal elements subtract -1 from their lane
+		__m256i sums = _mm256_setzero_si256();
+		for (size_t end = i + 8 * COUNT_BLOCK; i + 8 <= count && i < end; i += 8)
+		{
+			__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(elements + i * 4));
+			sums = _mm256_sub_epi32(sums, _mm256_cmpeq_epi32(block, needle));
+		}
+		matches += sum_int32_avx2(sums);
+	}
+	return matches + count_scalar(elements + i * 4, count - i, value);
+}
+
+TARGET_AVX2 static size_t find_int64_avx2(const unsigned char* elements, size_t count, uint64_t value)
+{
+	const __m256i needle = _mm256_set1_epi64x(static_cast<long long>(value));
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(elements + i * 8));
+		int mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(block, needle)));
+		if (mask)
+		{
+			return i + lowest_bit(mask);
+		}
+	}
+	return i + find_scalar(elements + i * 8, count - i, value);
+}
+
+TARGET_AVX2 static size_t count_int64_avx2(const unsigned char* elements, size_t count, uint64_t value)
+{
+	const __m256i needle = _mm256_set1_epi64x(static_cast<long long>(value));
+	// Equal elements subtract -1 from their lane
+	__m256i sums = _mm256_setzero_si256();
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(elements + i * 8));
+		sums = _mm256_sub_epi64(sums, _mm256_cmpeq_epi64(block, needle));
+	}
+	return sum_int64_avx2(sums) + count_scalar(elements + i * 8, count - i, value);
+}
+
+TARGET_AVX2 static size_t find_float_avx2(const float* elements, size_t count, float value)
+{
+	const __m256 needle = _mm256_set1_ps(value);
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(elements + i), needle, _CMP_EQ_OQ));
+		if (mask)
+		{
+			return i + lowest_bit(mask);
+		}
+	}
+	return i + find_scalar(reinterpret_cast<const unsigned char*>(elements + i), count - i, value);
+}
+
+TARGET_AVX2 static size_t count_float_avx2(const float* elements, size_t count, float value)
+{
+	const __m256 needle = _mm256_set1_ps(value);
+	size_t matches = 0;
+	size_t i = 0;
+	while (i + 8 <= count)
+	{
+		// Equal elements subtract -1 from their lane
+		__m256i sums = _mm256_setzero_si256();
+		for (size_t end = i + 8 * COUNT_BLOCK; i + 8 <= count && i < end; i += 8)
+		{
+			sums = _mm256_sub_epi32(sums, _mm256_castps_si256(_mm256_cmp_ps(_mm256_loadu_ps(elements + i), needle, _CMP_EQ_OQ)));
+		}
+		matches += sum_int32_avx2(sums);
+	}
+	return matches + count_scalar(reinterpret_cast<const unsigned char*>(elements + i), count - i, value);
+}
+
+TARGET_AVX2 static size_t find_double_avx2(const double* elements, size_t count, double value)
+{
+	const __m256d needle = _mm256_set1_pd(value);
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		int mask = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(elements + i), needle, _CMP_EQ_OQ));
+		if (mask)
+		{
+			return i + lowest_bit(mask);
+		}
+	}
+	return i + find_scalar(reinterpret_cast<const unsigned char*>(elements + i), count - i, value);
+}
+
+TARGET_AVX2 static size_t count_double_avx2(const double* elements, size_t count, double value)
+{
+	const __m256d needle = _mm256_set1_pd(value);
+	// Equal elements subtract -1 from their lane
+	__m256i sums = _mm256_setzero_si256();
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		sums = _mm256_sub_epi64(sums, _mm256_castpd_si256(_mm256_cmp_pd(_mm256_loadu_pd(elements + i), needle, _CMP_EQ_OQ)));
+	}
+	return sum_int64_avx2(sums) + count_scalar(reinterpret_cast<const unsigned char*>(elements + i), count - i, value);
+}
+
+#endif // #ifdef SIMD_SEARCH_X86
+
+SimdSearch::InstructionSet SimdSearch::instruction_set()
+{
+	return static_cast<InstructionSet>(s_instructionSet.load(std::memory_order_relaxed));
+}
+
+SimdSearch::InstructionSet SimdSearch::supported_instruction_set()
+{
+	return s_supportedInstructionSet;
+}
+
+SimdSearch::InstructionSet SimdSearch::set_instruction_set(InstructionSet instructionSet)
+{
+	if (instructionSet > s_supportedInstructionSet)
+	{
+		instructionSet = s_supportedInstructionSet;
+	}
+	s_instructionSet.store(instructionSet, std::memory_order_relaxed);
+	return instructionSet;
+}
+
+size_t SimdSearch::find_int32(const void* elements, size_t count, uint32_t value)
+{
+	const unsigned char* bytes = static_cast<const unsigned char*>(elements);
+#ifdef SIMD_SEARCH_X86
+	switch (s_instructionSet.load(std::memory_order_relaxed))
+	{
+	case INSTRUCTION_SET_AVX2:
+		return find_int32_avx2(bytes, count, value);
+	case INSTRUCTION_SET_SSE2:
+		return find_int32_sse2(bytes, count, value);
+	}
+#endif
+	return find_scalar(bytes, count, value);
+}
+
+size_t SimdSearch::find_int64(const void* elements, size_t count, uint64_t value)
+{
+	const unsigned char* bytes = static_cast<const unsigned char*>(elements);
+#ifdef SIMD_SEARCH_X86
+	switch (s_instructionSet.load(std::memory_order_relaxed))
+	{
+	case INSTRUCTION_SET_AVX2:
+		return find_int64_avx2(bytes, count, value);
+	case INSTRUCTION_SET_SSE2:
+		return find_int64_sse2(bytes, count, value);
+	}
+#endif
+	return find_scalar(bytes, count, value);
+}
+
+size_t SimdSearch::find_float(const float* elements, size_t count, float value)
+{
+#ifdef SIMD_SEARCH_X86
+	switch (s_instructionSet.load(std::memory_order_relaxed))
+	{
+	case INSTRUCTION_SET_AVX2:
+		return find_float_avx2(elements, count, value);
+	case INSTRUCTION_SET_SSE2:
+		return find_float_sse2(elements, count, value);
+	}
+#endif
+	return find_scalar(reinterpret_cast<const unsigned char*>(elements), count, value);
+}
+
+size_t SimdSearch::find_double(const double* elements, size_t count, double value)
+{
+#ifdef SIMD_SEARCH_X86
+	switch (s_instructionSet.load(std::memory_order_relaxed))
+	{
+	case INSTRUCTION_SET_AVX2:
+		return find_double_avx2(elements, count, value);
+	case INSTRUCTION_SET_SSE2:
+		return find_double_sse2(elements, count, value);
+	}
+#endif
+	return find_scalar(reinterpret_cast<const unsigned char*>(elements), count, value);
+}
+
+size_t SimdSearch::count_int32(const void* elements, size_t count, uint32_t value)
+{
+	const unsigned char* bytes = static_cast<const unsigned char*>(elements);
+#ifdef SIMD_SEARCH_X86
+	switch (s_instructionSet.load(std::memory_order_relaxed))
+	{
+	case INSTRUCTION_SET_AVX2:
+		return count_int32_avx2(bytes, count, value);
+	case INSTRUCTION_SET_SSE2:
+		return count_int32_sse2(bytes, count, value);
+	}
+#endif
+	return count_scalar(bytes, count, value);
+}
+
+size_t SimdSearch::count_int64(const void* elements, size_t count, uint64_t value)
+{
+	const unsigned char* bytes = static_cast<const unsigned char*>(elements);
+#ifdef SIMD_SEARCH_X86
+	switch (s_instructionSet.load(std::memory_order_relaxed))
+	{
+	case INSTRUCTION_SET_AVX2:
+		return count_int64_avx2(bytes, count, value);
+	case INSTRUCTION_SET_SSE2:
+		return count_int64_sse2(bytes, count, value);
+	}
+#endif
+	return count_scalar(bytes, count, value);
+}
+
+size_t SimdSearch::count_float(const float* elements, size_t count, float value)
+{
+#ifdef SIMD_SEARCH_X86
+	switch (s_instructionSet.load(std::memory_order_relaxed))
+	{
+	case INSTRUCTION_SET_AVX2:
+		return count_float_avx2(elements, count, value);
+	case INSTRUCTION_SET_SSE2:
+		return count_float_sse2(elements, count, value);
+	}
+#endif
+	return count_scalar(reinterpret_cast<const unsigned char*>(elements), count, value);
+}
+
+size_t SimdSearch::count_double(const double* elements, size_t count, double value)
+{
+#ifdef SIMD_SEARCH_X86
+	switch (s_instructionSet.load(std::memory_order_relaxed))
+	{
+	case INSTRUCTION_SET_AVX2:
+		return count_double_avx2(elements, count, value);
+	case INSTRUCTION_SET_SSE2:
+		return count_double_sse2(elements, count, value);
+	}
+#endif
+	return count_scalar(reinterpret_cast<const unsigned char*>(elements), count, value);
+}
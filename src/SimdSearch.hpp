@@ -0,0 +1,170 @@
+/**
+ * @file SimdSearch.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef SIMDSEARCH_HPP
+#define SIMDSEARCH_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+
+/**
+ * @class SimdSearch
+ * Searches contiguous arrays for elements equal to a value. Arrays of 32 and 64 bit integers, float and double are
+ * compared in SIMD registers (AVX2 or SSE2 on x86 processors, chosen at runtime when the program starts), other types
+ * and other processors are compared one element at a time with operator==. The results are the same for every
+ * instruction set: floating-point elements are compared like operator== does, so NaN is never found and 0.0 equals
+ * -0.0.
+ */
+class SimdSearch
+{
+public:
+	/**
+	 * @enum InstructionSet
+	 * Instruction sets used to compare the elements.
+	 */
+	enum InstructionSet
+	{
+		// One element at a time
+		INSTRUCTION_SET_SCALAR	= 0,
+		// 128 bit registers
+		INSTRUCTION_SET_SSE2	= 1,
+		// 256 bit registers
+		INSTRUCTION_SET_AVX2	= 2
+	};
+
+	/**
+	 * Checks if arrays of a type are compared in SIMD registers.
+	 * @tparam	T	Type of the elements
+	 */
+	template<typename T>
+	struct Vectorized : std::integral_constant<bool, std::is_same<T, float>::value || std::is_same<T, double>::value ||
+		(std::is_integral<T>::value && (4 == sizeof(T) || 8 == sizeof(T)))>
+	{
+	};
+
+	/**
+	 * Returns the index of the first element of an array which is equal to a value.
+	 * @param	elements	Array to search
+	 * @param	count		Count of elements in the array
+	 * @param	value		Value to search for
+	 * @return				Index of the first element equal to value, count if no element is equal to value
+	 */
+	template<typename T>
+	static size_t find(const T* elements, size_t count, const T& value);
+
+	/**
+	 * Counts the elements of an array which are equal to a value.
+	 * @param	elements	Array to search
+	 * @param	count		Count of elements in the array
+	 * @param	value		Value to search for
+	 * @return				The count of elements equal to value
+	 */
+	template<typename T>
+	static size_t count(const T* elements, size_t count, const T& value);
+
+	/**
+	 * Returns the instruction set used for the arrays of vectorized types.
+	 * @return	The instruction set in use
+	 */
+	static InstructionSet instruction_set();
+
+	/**
+	 * Returns the best instruction set supported by the processor and the operating system.
+	 * @return	The best supported instruction set
+	 */
+	static InstructionSet supported_instruction_set();
+
+	/**
+	 * Selects the instruction set used for the arrays of vectorized types, e.g. to compare the instruction sets in
+	 * tests and benchmarks. Instruction sets which are not supported are replaced by the best supported one.
+	 * @param	instructionSet	Requested instruction set
+	 * @return					The instruction set in use
+	 */
+	static InstructionSet set_instruction_set(InstructionSet instructionSet);
+
+private:
+	/**
+	 * @enum ElementKind
+	 * Kinds of elements with a separate kernel. Integers only differ in their size since equal integers have equal
+	 * bits.
+	 */
+	enum ElementKind
+	{
+		ELEMENT_KIND_OTHER	= 0,
+		ELEMENT_KIND_INT32	= 1,
+		ELEMENT_KIND_INT64	= 2,
+		ELEMENT_KIND_FLOAT	= 3,
+		ELEMENT_KIND_DOUBLE	= 4
+	};
+
+	/**
+	 * Returns the kind of the elements of a type.
+	 * @tparam	T	Type of the elements
+	 */
+	template<typename T>
+	struct Kind : std::integral_constant<ElementKind,
+		std::is_same<T, float>::value ? ELEMENT_KIND_FLOAT :
+		std::is_same<T, double>::value ? ELEMENT_KIND_DOUBLE :
+		!std::is_integral<T>::value ? ELEMENT_KIND_OTHER :
+		4 == sizeof(T) ? ELEMENT_KIND_INT32 :
+		8 == sizeof(T) ? ELEMENT_KIND_INT64 : ELEMENT_KIND_OTHER>
+	{
+	};
+
+	template<typename T>
+	static size_t find(const T* elements, size_t count, const T& value, std::integral_constant<ElementKind,
+		ELEMENT_KIND_OTHER>);
+	template<typename T>
+	static size_t find(const T* elements, size_t count, const T& value, std::integral_constant<ElementKind,
+		ELEMENT_KIND_INT32>) { return find_int32(elements, count, static_cast<uint32_t>(value)); }
+	template<typename T>
+	static size_t find(const T* elements, size_t count, const T& value, std::integral_constant<ElementKind,
+		ELEMENT_KIND_INT64>) { return find_int64(elements, count, static_cast<uint64_t>(value)); }
+	template<typename T>
+	static size_t find(const T* elements, size_t count, const T& value, std::integral_constant<ElementKind,
+		ELEMENT_KIND_FLOAT>) { return find_float(elements, count, value); }
+	template<typename T>
+	static size_t find(const T* elements, size_t count, const T& value, std::integral_constant<ElementKind,
+		ELEMENT_KIND_DOUBLE>) { return find_double(elements, count, value); }
+
+	template<typename T>
+	static size_t count(const T* elements, size_t count, const T& value, std::integral_constant<ElementKind,
+		ELEMENT_KIND_OTHER>);
+	template<typename T>
+	static size_t count(const T* elements, size_t count, const T& value, std::integral_constant<ElementKind,
+		ELEMENT_KIND_INT32>) { return count_int32(elements, count, static_cast<uint32_t>(value)); }
+	template<typename T>
+	static size_t count(const T* elements, size_t count, const T& value, std::integral_constant<ElementKind,
+		ELEMENT_KIND_INT64>) { return count_int64(elements, count, static_cast<uint64_t>(value)); }
+	template<typename T>
+	static size_t count(const T* elements, size_t count, const T& value, std::integral_constant<ElementKind,
+		ELEMENT_KIND_FLOAT>) { return count_float(elements, count, value); }
+	template<typename T>
+	static size_t count(const T* elements, size_t count, const T& value, std::integral_constant<ElementKind,
+		ELEMENT_KIND_DOUBLE>) { return count_double(elements, count, value); }
+
+	/**
+	 * Kernels for the vectorized kinds of elements. They dispatch to the selected instruction set, the elements are
+	 * passed untyped since signed and unsigned integers share the kernels.
+	 */
+	static size_t find_int32(const void* elements, size_t count, uint32_t value);
+	static size_t find_int64(const void* elements, size_t count, uint64_t value);
+	static size_t find_float(const float* elements, size_t count, float value);
+	static size_t find_double(const double* elements, size_t count, double value);
+	static size_t count_int32(const void* elements, size_t count, uint32_t value);
+	static size_t count_int64(const void* elements, size_t count, uint64_t value);
+	static size_t count_float(const float* elements, size_t count, float value);
+	static size_t count_double(const double* elements, size_t count, double value);
+};
+
+
+// Include implementation of SimdSearch
+#include "SimdSearch.tpp"
+
+
+#endif // #ifndef SIMDSEARCH_HPP
@@ -0,0 +1,49 @@
+/**
+ * @file SimdSearch.tpp
+ * @date 17.10.2026
+ */
+
+#ifndef SIMDSEARCH_HPP
+#error SIMDSEARCH_HPP undefined
+#endif
+
+template<typename T>
+size_t SimdSearch::find(const T* elements, size_t count, const T& value)
+{
+	return find(elements, count, value, Kind<T>());
+}
+
+template<typename T>
+size_t SimdSearch::count(const T* elements, size_t count, const T& value)
+{
+	return SimdSearch::count(elements, count, value, Kind<T>());
+}
+
+template<typename T>
+size_t SimdSearch::find(const T* elements, size_t count, const T& value, std::integral_constant<ElementKind,
+	ELEMENT_KIND_OTHER>)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		if (value == elements[i])
+		{
+			return i;
+		}
+	}
+	return count;
+}
+
+template<typename T>
+size_t SimdSearch::count(const T* elements, size_t count, const T& value, std::integral_constant<ElementKind,
+	ELEMENT_KIND_OTHER>)
+{
+	size_t matches = 0;
+	for (size_t i = 0; i < count; i++)
+	{
+		if (value == elements[i])
+		{
+			matches++;
+		}
+	}
+	return matches;
+}
@@ -0,0 +1,368 @@
+/**
+ * @file SnapshotSList.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef SNAPSHOTSLIST_HPP
+#define SNAPSHOTSLIST_HPP
+
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include "List.hpp"
+#include "Mutex.hpp"
+
+
+/**
+ * @class SnapshotSList
+ * A thread-safe double-linked list class which provides consistent, immutable snapshots of the list. Taking a snapshot
+ * locks the list only for a constant time, reading a snapshot never locks the list, so readers don't block writers and
+ * writers don't block readers.
+ * Every change of the list gets a new version. Nodes remember the versions in which they were added and removed, a
+ * snapshot only shows the nodes which were part of the list in the version of the snapshot. Removed nodes stay linked
+ * until no snapshot shows them anymore and they are deleted as soon as no snapshot can reach them anymore.
+ * Elements can't be changed after they were added since snapshots might read them at any time.
+ * IMPORTANT: Snapshots must be destroyed before the list.
+ * @tparam	T	Type of the elements of the list
+ */
+template<typename T>
+class SnapshotSList
+{
+private:
+	// Remove version of nodes which were not removed yet
+	static constexpr uint64_t NOT_REMOVED = UINT64_MAX;
+
+	/**
+	 * @class Node
+	 * Class for nodes of the list. m_next is read by snapshots without locking the list, all other pointers are only
+	 * used while the list is locked. m_livePrev and m_liveNext link the nodes of the current version only.
+	 */
+	struct Node
+	{
+		// Previous node of the list
+		Node*					m_prev;
+		// Next node of the list
+		std::atomic<Node*>		m_next;
+		// Previous node of the current version of the list
+		Node*					m_livePrev;
+		// Next node of the current version of the list
+		Node*					m_liveNext;
+		// Version in which the node was added to the list
+		uint64_t				m_insertVersion;
+		// Version in which the node was removed from the list, NOT_REMOVED if it is still part of the list
+		std::atomic<uint64_t>	m_removeVersion;
+		// Version in which the node was unlinked from the list
+		uint64_t				m_unlinkVersion;
+		// Element of the node, it is not changed while the node is part of the list
+		T						m_element;
+
+		/**
+		 * Constructor for instances of the class Node. The element is constructed in place.
+		 * @param	version	Version in which the node is added to the list
+		 * @param	args	Arguments passed to the constructor of the element
+		 */
+		template<typename... Args>
+		Node(uint64_t version, Args&&... args) : m_prev(nullptr), m_next(nullptr), m_livePrev(nullptr),
+			m_liveNext(nullptr), m_insertVersion(version),
+			m_removeVersion(NOT_REMOVED), m_unlinkVersion(0), m_element(std::forward<Args>(args)...) {}
+	};
+
+	/**
+	 * @class ExclusiveLock
+	 * Locks m_mutex while it exists, also if the locked method throws.
+	 */
+	class ExclusiveLock
+	{
+	private:
+		// List to lock
+		const SnapshotSList*	m_list;
+
+	public:
+		explicit ExclusiveLock(const SnapshotSList* list) : m_list(list) { m_list->m_mutex.lock(); }
+		~ExclusiveLock() { m_list->m_mutex.unlock(); }
+		ExclusiveLock(const ExclusiveLock&) = delete;
+		ExclusiveLock& operator=(const ExclusiveLock&) = delete;
+	};
+
+	// Mutex guarding all members except of m_count
+	mutable Mutex			m_mutex;
+	// First linked node of the list, it may have been removed already
+	Node*					m_first;
+	// Last linked node of the list, it may have been removed already
+	Node*					m_last;
+	// First node of the current version of the list
+	Node*					m_liveFirst;
+	// Last node of the current version of the list
+	Node*					m_liveLast;
+	// Current version of the list
+	uint64_t				m_version;
+	// Count of elements in the current version of the list
+	std::atomic<size_t>		m_count;
+	// Versions of all existing snapshots and the count of snapshots per version
+	std::map<uint64_t, size_t>	m_snapshots;
+	// Removed nodes which are still linked since snapshots show them, in the order of their removal
+	std::deque<Node*>		m_removed;
+	// Unlinked nodes which snapshots might still reach, in the order of unlinking
+	std::deque<Node*>		m_retired;
+
+	/**
+	 * Links a new node at the back or at the front of the list. m_mutex has to be locked.
+	 * @param	back	true to add the node to the back of the list, false to add it to the front
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	void insert(bool back, Args&&... args);
+
+	/**
+	 * Removes a node in a given version. The node is unlinked and deleted immediately if no snapshot exists, otherwise
+	 * it is unlinked later. m_mutex has to be locked.
+	 * @param	node	Node to remove
+	 * @param	version	Version of the change
+	 */
+	void erase(Node* node, uint64_t version);
+
+	/**
+	 * Unlinks a node from the list. Snapshots iterating the list either see the node or skip it, the next pointer of
+	 * the node is left unchanged. m_mutex has to be locked.
+	 * @param	node	Node to unlink
+	 */
+	void unlink(Node* node);
+
+	/**
+	 * Unlinks the removed nodes which no snapshot shows anymore and deletes the unlinked nodes which no snapshot can
+	 * reach anymore. m_mutex has to be locked.
+	 */
+	void collect();
+
+	/**
+	 * Returns the first or the last node of the current version of the list. m_mutex has to be locked.
+	 * @param	back	true to return the last node, false to return the first node
+	 * @return			The first or last node, nullptr if the list is empty
+	 */
+	Node* end_node(bool back);
+
+	/**
+	 * Removes the first or the last node of the list and copies or moves its element. m_mutex has to be locked.
+	 * @param	back	true to remove the last node, false to remove the first node
+	 * @param	element	Receives the element of the removed node, it is left unchanged if the list is empty
+	 * @return			true if an element was removed, false if the list is empty
+	 */
+	bool pop(bool back, T& element);
+
+	/**
+	 * Unregisters a snapshot and deletes the nodes which are not needed anymore.
+	 * @param	version	Version of the snapshot
+	 */
+	void release(uint64_t version);
+
+public:
+	/**
+	 * @class Snapshot
+	 * Immutable view of the list in the version in which the snapshot was taken. It can be read by any thread without
+	 * locking the list. Snapshots can be moved but not copied.
+	 */
+	class Snapshot
+	{
+	private:
+		friend class SnapshotSList;
+
+		// List of the snapshot, nullptr if the snapshot was moved
+		SnapshotSList*	m_list;
+		// First linked node of the list when the snapshot was taken
+		const Node*		m_first;
+		// Version of the snapshot
+		uint64_t		m_version;
+		// Count of elements in the snapshot
+		size_t			m_size;
+
+		/**
+		 * Constructor for instances of the class Snapshot. The snapshot has to be registered already.
+		 */
+		Snapshot(SnapshotSList* list, const Node* first, uint64_t version, size_t size) : m_list(list), m_first(first),
+			m_version(version), m_size(size) {}
+
+	public:
+		/**
+		 * Move-constructor for instances of the class Snapshot.
+		 * @param	other	Snapshot to move, it is empty afterwards
+		 */
+		Snapshot(Snapshot&& other);
+
+		/**
+		 * Destructor for instances of the class Snapshot. Allows the list to delete the nodes of the snapshot.
+		 */
+		~Snapshot();
+
+		/**
+		 * Returns the count of elements in the snapshot.
+		 * @return	The count of elements in the snapshot
+		 */
+		size_t size() const;
+
+		/**
+		 * Checks if the snapshot is empty (= does not contain any elements).
+		 * @return	true if the snapshot is empty, otherwise false
+		 */
+		bool empty() const;
+
+		/**
+		 * Iterates from the front to the back of the snapshot using a function pointer as callback function for every
+		 * element. ACTION_REMOVE is ignored.
+		 * @param	func		Pointer to a callback function called for every element in the snapshot
+		 * @param	parameter	A user-defined parameter to be passed to the callback function, it can be NULL
+		 */
+		void iterate(const typename List<T>::ConstIterationFunction& func, void* parameter = nullptr) const;
+
+		/**
+		 * Iterates from the front to the back of the snapshot using a lambda function as callback function for every
+		 * element. ACTION_REMOVE is ignored. The callback lambda function should have the following signature:
+		 * auto func = [your lambda capture list goes here](const T& element) -> ListInterationAction { your code goes here };
+		 * @param	func	Callback lambda function called for every element in the snapshot. It receives a const
+		 *					reference to the current element as a parameter.
+		 */
+		template<typename Lambda>
+		void iterate(const Lambda& func) const;
+
+		/**
+		 * Copies the elements of the snapshot to a new list.
+		 * @return	List containing the elements of the snapshot
+		 */
+		template<typename Allocator = PoolAllocator<>>
+		List<T, Allocator> to_list() const;
+
+		Snapshot(const Snapshot&) = delete;
+		Snapshot& operator=(const Snapshot&) = delete;
+	};
+
+	/**
+	 * Default constructor for instances of the class SnapshotSList.
+	 */
+	SnapshotSList();
+
+	/**
+	 * Destructor for instances of the class SnapshotSList.
+	 */
+	~SnapshotSList();
+
+	/**
+	 * Returns the count of elements in the list at the time of the call. m_mutex is not locked.
+	 * @return	The count of elements in the list
+	 */
+	size_t size() const;
+
+	/**
+	 * Checks if the list is empty (= does not contain any elements) at the time of the call. m_mutex is not locked.
+	 * @return	true if the list is empty, otherwise false
+	 */
+	bool empty() const;
+
+	/**
+	 * Removes all elements from the list.
+	 */
+	void clear();
+
+	/**
+	 * Adds an element to the back of the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_back(const T& element);
+
+	/**
+	 * Adds an element to the back of the list by moving it into the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_back(T&& element);
+
+	/**
+	 * Adds an element to the back of the list which is constructed in place.
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	void emplace_back(Args&&... args);
+
+	/**
+	 * Adds an element to the front of the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_front(const T& element);
+
+	/**
+	 * Adds an element to the front of the list by moving it into the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_front(T&& element);
+
+	/**
+	 * Removes the last element from the list and returns it. The element is copied if a snapshot might read it,
+	 * otherwise it is moved out of the list.
+	 * @return	The removed last element or a value-initialized element if the list is empty
+	 */
+	T pop_back();
+
+	/**
+	 * Removes the last element from the list if the list is not empty.
+	 * @param	element	Receives the removed last element, it is left unchanged if the list is empty
+	 * @return			true if an element was removed, false if the list is empty
+	 */
+	bool try_pop_back(T& element);
+
+	/**
+	 * Removes the first element from the list and returns it. The element is copied if a snapshot might read it,
+	 * otherwise it is moved out of the list.
+	 * @return	The removed first element or a value-initialized element if the list is empty
+	 */
+	T pop_front();
+
+	/**
+	 * Removes the first element from the list if the list is not empty.
+	 * @param	element	Receives the removed first element, it is left unchanged if the list is empty
+	 * @return			true if an element was removed, false if the list is empty
+	 */
+	bool try_pop_front(T& element);
+
+	/**
+	 * Removes elements from the list.
+	 * @param	element	Element to remove from the list
+	 */
+	void remove(const T& element);
+
+	/**
+	 * Iterates from the front to the back of the list using a function pointer as callback function for every element
+	 * in the list. m_mutex is locked, all elements removed by the iteration are removed in the same version.
+	 * @param	func		Pointer to a callback function called for every element in the list, it may return
+	 *						ACTION_REMOVE
+	 * @param	parameter	A user-defined parameter to be passed to the callback function, it can be NULL
+	 */
+	void iterate(const typename List<T>::ConstIterationFunction& func, void* parameter = nullptr);
+
+	/**
+	 * Iterates from the front to the back of the list using a lambda function as callback function for every element
+	 * in the list. m_mutex is locked, all elements removed by the iteration are removed in the same version.
+	 * The callback lambda function should have the following signature:
+	 * auto func = [your lambda capture list goes here](const T& element) -> ListInterationAction { your code goes here };
+	 * @param	func	Callback lambda function called for every element in the list, it may return ACTION_REMOVE.
+	 *					It receives a const reference to the current element as a parameter.
+	 */
+	template<typename Lambda>
+	void iterate(const Lambda& func);
+
+	/**
+	 * Takes a snapshot of the current version of the list. m_mutex is locked for a constant time only.
+	 * @return	Snapshot of the list
+	 */
+	Snapshot snapshot();
+
+	// Instances of SnapshotSList can't be copied, take a snapshot and copy it instead
+	SnapshotSList(const SnapshotSList&) = delete;
+	SnapshotSList& operator=(const SnapshotSList&) = delete;
+};
+
+
+// Include implementation of SnapshotSList
+#include "SnapshotSList.tpp"
+
+
+#endif // #ifndef SNAPSHOTSLIST_HPP
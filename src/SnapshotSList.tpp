@@ -0,0 +1,455 @@
+/**
+ * @file SnapshotSList.tpp
+ * @date 17.10.2026
+ */
+
+#ifndef SNAPSHOTSLIST_HPP
+#error SNAPSHOTSLIST_HPP undefined
+#endif
+
+#include <utility>
+
+template<typename T>
+constexpr uint64_t SnapshotSList<T>::NOT_REMOVED;
+
+template<typename T>
+template<typename... Args>
+void SnapshotSList<T>::insert(bool back, Args&&... args)
+{
+	Node* node = new Node(m_version + 1, std::forward<Args>(args)...);
+	m_version++;
+
+	if (!m_first)
+	{
+		// List is empty
+		m_first = node;
+		m_last = node;
+		m_liveFirst = node;
+		m_liveLast = node;
+	}
+	else if (back)
+	{
+		// Snapshots never read behind their last element, but publish the node completely anyway
+		node->m_prev = m_last;
+		m_last->m_next.store(node, std::memory_order_release);
+		m_last = node;
+		if (m_liveLast)
+		{
+			node->m_livePrev = m_liveLast;
+			m_liveLast->m_liveNext = node;
+		}
+		else
+		{
+			m_liveFirst = node;
+		}
+		m_liveLast = node;
+	}
+	else
+	{
+		// Snapshots start at the first node at the time they were taken, they never see the new first node
+		node->m_next.store(m_first, std::memory_order_relaxed);
+		m_first->m_prev = node;
+		m_first = node;
+		if (m_liveFirst)
+		{
+			node->m_liveNext = m_liveFirst;
+			m_liveFirst->m_livePrev = node;
+		}
+		else
+		{
+			m_liveLast = node;
+		}
+		m_liveFirst = node;
+	}
+	m_count.fetch_add(1, std::memory_order_release);
+}
+
+template<typename T>
+void SnapshotSList<T>::erase(Node* node, uint64_t version)
+{
+	node->m_removeVersion.store(version, std::memory_order_release);
+	m_count.fetch_sub(1, std::memory_order_release);
+
+	// Removed nodes may stay linked for snapshots, but they leave the current version immediately
+	if (node->m_livePrev)
+	{
+		node->m_livePrev->m_liveNext = node->m_liveNext;
+	}
+	else
+	{
+		m_liveFirst = node->m_liveNext;
+	}
+	if (node->m_liveNext)
+	{
+		node->m_liveNext->m_livePrev = node->m_livePrev;
+	}
+	else
+	{
+		m_liveLast = node->m_livePrev;
+	}
+
+	if (m_snapshots.empty())
+	{
+		unlink(node);
+		delete node;
+	}
+	else
+	{
+		// Existing snapshots still show the node
+		m_removed.push_back(node);
+	}
+}
+
+template<typename T>
+void SnapshotSList<T>::unlink(Node* node)
+{
+	Node* next = node->m_next.load(std::memory_order_relaxed);
+	if (node->m_prev)
+	{
+		node->m_prev->m_next.store(next, std::memory_order_release);
+	}
+	else
+	{
+		m_first = next;
+	}
+
+	if (next)
+	{
+		next->m_prev = node->m_prev;
+	}
+	else
+	{
+		m_last = node->m_prev;
+	}
+}
+
+template<typename T>
+void SnapshotSList<T>::collect()
+{
+	const uint64_t oldest = m_snapshots.empty() ? NOT_REMOVED : m_snapshots.begin()->first;
+
+	// Nodes removed in a version up to the oldest snapshot are not shown by any snapshot anymore
+	while (!m_removed.empty() && m_removed.front()->m_removeVersion.load(std::memory_order_relaxed) <= oldest)
+	{
+		Node* node = m_removed.front();
+		m_removed.pop_front();
+		unlink(node);
+		if (m_snapshots.empty())
+		{
+			delete node;
+		}
+		else
+		{
+			// Snapshots taken before the node was unlinked might be iterating over it right now
+			node->m_unlinkVersion = m_version;
+			m_retired.push_back(node);
+		}
+	}
+
+	// Snapshots taken after a node was unlinked have a greater version and can't reach the node
+	while (!m_retired.empty() && m_retired.front()->m_unlinkVersion < oldest)
+	{
+		delete m_retired.front();
+		m_retired.pop_front();
+	}
+}
+
+template<typename T>
+typename SnapshotSList<T>::Node* SnapshotSList<T>::end_node(bool back)
+{
+	return back ? m_liveLast : m_liveFirst;
+}
+
+template<typename T>
+bool SnapshotSList<T>::pop(bool back, T& element)
+{
+	Node* node = end_node(back);
+	if (!node)
+	{
+		return false;
+	}
+
+	if (m_snapshots.empty())
+	{
+		element = std::move(node->m_element);
+	}
+	else
+	{
+		// Snapshots might read the element at the same time
+		element = node->m_element;
+	}
+	erase(node, ++m_version);
+	collect();
+	return true;
+}
+
+template<typename T>
+void SnapshotSList<T>::release(uint64_t version)
+{
+	ExclusiveLock lock(this);
+	auto snapshot = m_snapshots.find(version);
+	if (0 == --snapshot->second)
+	{
+		m_snapshots.erase(snapshot);
+	}
+	collect();
+}
+
+template<typename T>
+SnapshotSList<T>::Snapshot::Snapshot(Snapshot&& other) : m_list(other.m_list), m_first(other.m_first),
+	m_version(other.m_version), m_size(other.m_size)
+{
+	other.m_list = nullptr;
+	other.m_first = nullptr;
+	other.m_size = 0;
+}
+
+template<typename T>
+SnapshotSList<T>::Snapshot::~Snapshot()
+{
+	if (m_list)
+	{
+		m_list->release(m_version);
+	}
+}
+
+template<typename T>
+size_t SnapshotSList<T>::Snapshot::size() const
+{
+	return m_size;
+}
+
+template<typename T>
+bool SnapshotSList<T>::Snapshot::empty() const
+{
+	return 0 == m_size;
+}
+
+template<typename T>
+void SnapshotSList<T>::Snapshot::iterate(const typename List<T>::ConstIterationFunction& func, void* parameter) const
+{
+	auto callFunction = [&func, parameter](const T& element) -> ListIterationAction
+	{
+		return func(element, parameter);
+	};
+	iterate(callFunction);
+}
+
+template<typename T>
+template<typename Lambda>
+void SnapshotSList<T>::Snapshot::iterate(const Lambda& func) const
+{
+	// Stop behind the last element of the snapshot, nodes added to the back later are never read
+	size_t visited = 0;
+	const Node* current = m_first;
+	while (current && visited < m_size)
+	{
+		if (current->m_insertVersion <= m_version &&
+			current->m_removeVersion.load(std::memory_order_acquire) > m_version)
+		{
+			visited++;
+			if (func(current->m_element) & ListIterationAction::ACTION_BREAK)
+			{
+				break;
+			}
+		}
+		current = current->m_next.load(std::memory_order_acquire);
+	}
+}
+
+template<typename T>
+template<typename Allocator>
+List<T, Allocator> SnapshotSList<T>::Snapshot::to_list() const
+{
+	List<T, Allocator> ret;
+	iterate([&ret](const T& element) -> ListIterationAction
+	{
+		ret.push_back(element);
+		return ListIterationAction::ACTION_CONTINUE;
+	});
+	return ret;
+}
+
+template<typename T>
+SnapshotSList<T>::SnapshotSList() : m_mutex(), m_first(nullptr), m_last(nullptr), m_liveFirst(nullptr),
+	m_liveLast(nullptr), m_version(0), m_count(0), m_snapshots(), m_removed(), m_retired()
+{
+	// Nothing to do yet
+}
+
+template<typename T>
+SnapshotSList<T>::~SnapshotSList()
+{
+	Node* current = m_first;
+	while (current)
+	{
+		Node* next = current->m_next.load(std::memory_order_relaxed);
+		delete current;
+		current = next;
+	}
+	for (Node* node : m_retired)
+	{
+		delete node;
+	}
+}
+
+template<typename T>
+size_t SnapshotSList<T>::size() const
+{
+	return m_count.load(std::memory_order_acquire);
+}
+
+template<typename T>
+bool SnapshotSList<T>::empty() const
+{
+	return 0 == m_count.load(std::memory_order_acquire);
+}
+
+template<typename T>
+void SnapshotSList<T>::clear()
+{
+	auto removeAll = [](const T& /*element*/) -> ListIterationAction
+	{
+		return ListIterationAction::ACTION_REMOVE;
+	};
+	iterate(removeAll);
+}
+
+template<typename T>
+void SnapshotSList<T>::push_back(const T& element)
+{
+	ExclusiveLock lock(this);
+	insert(true, element);
+}
+
+template<typename T>
+void SnapshotSList<T>::push_back(T&& element)
+{
+	ExclusiveLock lock(this);
+	insert(true, std::move(element));
+}
+
+template<typename T>
+template<typename... Args>
+void SnapshotSList<T>::emplace_back(Args&&... args)
+{
+	ExclusiveLock lock(this);
+	insert(true, std::forward<Args>(args)...);
+}
+
+template<typename T>
+void SnapshotSList<T>::push_front(const T& element)
+{
+	ExclusiveLock lock(this);
+	insert(false, element);
+}
+
+template<typename T>
+void SnapshotSList<T>::push_front(T&& element)
+{
+	ExclusiveLock lock(this);
+	insert(false, std::move(element));
+}
+
+template<typename T>
+T SnapshotSList<T>::pop_back()
+{
+	T element = T();
+	ExclusiveLock lock(this);
+	pop(true, element);
+	return element;
+}
+
+template<typename T>
+bool SnapshotSList<T>::try_pop_back(T& element)
+{
+	ExclusiveLock lock(this);
+	return pop(true, element);
+}
+
+template<typename T>
+T SnapshotSList<T>::pop_front()
+{
+	T element = T();
+	ExclusiveLock lock(this);
+	pop(false, element);
+	return element;
+}
+
+template<typename T>
+bool SnapshotSList<T>::try_pop_front(T& element)
+{
+	ExclusiveLock lock(this);
+	return pop(false, element);
+}
+
+template<typename T>
+void SnapshotSList<T>::remove(const T& element)
+{
+	auto removeEqual = [&element](const T& current) -> ListIterationAction
+	{
+		return element == current ? ListIterationAction::ACTION_REMOVE : ListIterationAction::ACTION_CONTINUE;
+	};
+	iterate(removeEqual);
+}
+
+template<typename T>
+void SnapshotSList<T>::iterate(const typename List<T>::ConstIterationFunction& func, void* parameter)
+{
+	auto callFunction = [&func, parameter](const T& element) -> ListIterationAction
+	{
+		return func(element, parameter);
+	};
+	iterate(callFunction);
+}
+
+template<typename T>
+template<typename Lambda>
+void SnapshotSList<T>::iterate(const Lambda& func)
+{
+	ExclusiveLock lock(this);
+	const uint64_t version = m_version + 1;
+	bool changed = false;
+	try
+	{
+		Node* current = m_liveFirst;
+		while (current)
+		{
+			Node* next = current->m_liveNext;
+			ListIterationAction action = func(static_cast<const T&>(current->m_element));
+			if (action & ListIterationAction::ACTION_REMOVE)
+			{
+				erase(current, version);
+				changed = true;
+			}
+			if (action & ListIterationAction::ACTION_BREAK)
+			{
+				break;
+			}
+			current = next;
+		}
+	}
+	catch (...)
+	{
+		// The nodes removed before the exception carry the new version already, commit it before rethrowing
+		if (changed)
+		{
+			m_version = version;
+			collect();
+		}
+		throw;
+	}
+	if (changed)
+	{
+		m_version = version;
+		collect();
+	}
+}
+
+template<typename T>
+typename SnapshotSList<T>::Snapshot SnapshotSList<T>::snapshot()
+{
+	ExclusiveLock lock(this);
+	m_snapshots[m_version]++;
+	return Snapshot(this, m_first, m_version, m_count.load(std::memory_order_relaxed));
+}
@@ -0,0 +1,587 @@
+/**
+ * @file UnrolledList.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef UNROLLEDLIST_HPP
+#define UNROLLEDLIST_HPP
+
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "List.hpp"
+#include "LockPolicy.hpp"
+#include "PoolAllocator.hpp"
+#include "SimdSearch.hpp"
+
+
+/**
+ * @class BasicUnrolledList
+ * A double-linked list class which stores up to ChunkSize elements per node (unrolled list). It provides the same
+ * methods as BasicList and is locked by a lock policy like BasicList: UnrolledList doesn't lock at all and
+ * UnrolledSList locks every method, including the lambda iterate methods. No method is virtual, the methods taking
+ * another list accept lists with any lock policy.
+ * The elements of a node are stored contiguously, so iterating the list touches one node per ChunkSize elements instead
+ * of one node per element and the pointers of the nodes are shared by all of their elements. Elements removed from the
+ * middle of the list are compacted within their node while iterating, empty nodes are returned to the allocator.
+ * Since the elements of a node are contiguous, find, count, contains and remove compare the elements of integers and
+ * floating-point types in SIMD registers (see SimdSearch) and remove only compacts nodes containing a removed element.
+ * IMPORTANT: Elements are moved within their node when a preceding element of the same node is removed, so references
+ * to elements are only valid until the list is changed. The move constructor of T should not throw.
+ * @tparam	T			Type of the elements of the list
+ * @tparam	ChunkSize	Maximum count of elements per node
+ * @tparam	Allocator	Allocator for the nodes of the list, e.g. PoolAllocator (default) or HeapAllocator
+ * @tparam	LockPolicy	Lock of the list, NoLock (default) or a mutex like Mutex, RWMutex or AdaptiveMutex, see BasicList
+ */
+template<typename T, size_t ChunkSize = 16, typename Allocator = PoolAllocator<>, typename LockPolicy = NoLock>
+class BasicUnrolledList
+{
+private:
+	template<typename, size_t, typename, typename> friend class BasicUnrolledList;
+
+	static_assert(ChunkSize > 0 && ChunkSize <= 0xFFFF, "ChunkSize must be between 1 and 65535");
+
+	/**
+	 * @class Chunk
+	 * Class for nodes of the list. They contain storage for up to ChunkSize elements as well as pointers to the
+	 * previous and next nodes in the list. The elements occupy the range [m_begin, m_end) of the storage.
+	 */
+	struct Chunk
+	{
+		// Previous node of the list
+		Chunk*			m_prev;
+		// Next node of the list
+		Chunk*			m_next;
+		// Index of the first element in m_elements
+		unsigned int	m_begin;
+		// Index behind the last element in m_elements
+		unsigned int	m_end;
+		// Uninitialized storage for the elements of the node
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type	m_elements[ChunkSize];
+
+		/**
+		 * Constructor for instances of the class Chunk.
+		 * @param	position	Index of the storage where the first element will be added
+		 */
+		explicit Chunk(unsigned int position) : m_prev(nullptr), m_next(nullptr), m_begin(position), m_end(position) {}
+
+		/**
+		 * Returns the storage of an element.
+		 * @param	index	Index of the storage
+		 * @return			Pointer to the storage
+		 */
+		T* element(unsigned int index) { return reinterpret_cast<T*>(&m_elements[index]); }
+
+		/**
+		 * Returns the storage of an element.
+		 * @param	index	Index of the storage
+		 * @return			Pointer to the storage
+		 */
+		const T* element(unsigned int index) const { return reinterpret_cast<const T*>(&m_elements[index]); }
+	};
+
+	/**
+	 * @class ExclusiveLock
+	 * Locks m_lock exclusively while it exists. m_count is updated before unlocking, also if the locked method throws.
+	 */
+	class ExclusiveLock
+	{
+	private:
+		// List to lock
+		BasicUnrolledList*	m_list;
+
+	public:
+		explicit ExclusiveLock(BasicUnrolledList* list) : m_list(list) { m_list->m_lock.lock(); }
+		~ExclusiveLock() { m_list->update_count(); m_list->m_lock.unlock(); }
+		ExclusiveLock(const ExclusiveLock&) = delete;
+		ExclusiveLock& operator=(const ExclusiveLock&) = delete;
+	};
+
+	/**
+	 * @class SharedLock
+	 * Locks m_lock in shared mode while it exists.
+	 */
+	class SharedLock
+	{
+	private:
+		// List to lock
+		const BasicUnrolledList*	m_list;
+
+	public:
+		explicit SharedLock(const BasicUnrolledList* list) : m_list(list) { m_list->m_lock.lock_shared(); }
+		~SharedLock() { m_list->m_lock.unlock_shared(); }
+		SharedLock(const SharedLock&) = delete;
+		SharedLock& operator=(const SharedLock&) = delete;
+	};
+
+	// First node of the list
+	Chunk*		m_first;
+	// Last node of the list
+	Chunk*		m_last;
+	// Count of elements in the list
+	size_t		m_size;
+	// Allocator for the nodes of the list
+	Allocator	m_allocator;
+	// Lock of the list
+	mutable LockPolicy	m_lock;
+	// Count of elements in the list. It is updated while m_lock is locked exclusively and can be read without locking
+	// m_lock, lists whose lock policy doesn't synchronize don't update it.
+	std::atomic<size_t>	m_count;
+
+	/**
+	 * Updates m_count after the list was changed and informs the lock policy about the change by
+	 * LockPolicyTraits::count_changed. m_lock has to be locked exclusively.
+	 */
+	void update_count();
+
+	/**
+	 * Locks the list and another list in the order of their addresses, so threads locking the same two lists can't
+	 * deadlock. The lists must be different.
+	 * @param	shared		true to lock the list in shared mode, false to lock it exclusively
+	 * @param	other		Other list to lock
+	 * @param	otherShared	true to lock the other list in shared mode, false to lock it exclusively
+	 */
+	template<typename OtherLock>
+	void lock_pair(bool shared, const BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other, bool otherShared) const;
+
+	/**
+	 * Unlocks two lists locked by lock_pair.
+	 * @param	shared		true if the list is locked in shared mode
+	 * @param	other		Other list to unlock
+	 * @param	otherShared	true if the other list is locked in shared mode
+	 */
+	template<typename OtherLock>
+	void unlock_pair(bool shared, const BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other, bool otherShared) const;
+
+	/**
+	 * Locks the list for methods working on two lists.
+	 * @param	shared	true to lock the list in shared mode for reading, false to lock it exclusively
+	 */
+	void lock_list(bool shared) const;
+
+	/**
+	 * Unlocks the list after methods working on two lists accessed it. Updates m_count if the list is locked
+	 * exclusively since the list might have been changed.
+	 * @param	shared	true if the list is locked in shared mode, false if it is locked exclusively
+	 */
+	void unlock_list(bool shared) const;
+
+	/**
+	 * Returns the last node if it has space left behind its last element, otherwise adds a new node to the back of
+	 * the list.
+	 * @return	Node to add an element to the back of the list
+	 */
+	Chunk* back_chunk();
+
+	/**
+	 * Returns the first node if it has space left in front of its first element, otherwise adds a new node to the
+	 * front of the list.
+	 * @return	Node to add an element to the front of the list
+	 */
+	Chunk* front_chunk();
+
+	/**
+	 * Removes an empty node from the list and returns it to the allocator.
+	 * @param	chunk	Node to remove from the list
+	 */
+	void destroy_chunk(Chunk* chunk);
+
+	/**
+	 * Constructs an element behind the last element of the list.
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	void construct_back(Args&&... args);
+
+	/**
+	 * Constructs an element in front of the first element of the list.
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	void construct_front(Args&&... args);
+
+	/**
+	 * Destructs the last element of the list. The list must not be empty.
+	 */
+	void destroy_back();
+
+	/**
+	 * Destructs the first element of the list. The list must not be empty.
+	 */
+	void destroy_front();
+
+	/**
+	 * Destructs all elements and returns all nodes to the allocator. m_lock has to be locked exclusively.
+	 */
+	void destroy_chunks();
+
+	/**
+	 * Closes the gap of unused storage in front of the element at read by moving the elements from read to the end of a
+	 * node to write. It is used to keep a node consistent if an element throws while the node is compacted.
+	 * @param	chunk	Node to compact
+	 * @param	write	First unused position in front of read
+	 * @param	read	Position of the first element to keep
+	 */
+	void close_gap(Chunk* chunk, unsigned int write, unsigned int read);
+
+	/**
+	 * Calls a function for every element of the list, removes the elements for which the function returns
+	 * ACTION_REMOVE and compacts the remaining elements of every node. If the function throws, the current node is
+	 * compacted before the exception is passed on.
+	 * @param	func	Function called for every element in the list
+	 */
+	template<typename Function>
+	void filter(const Function& func);
+
+	/**
+	 * Calls a function for every element of the list without changing it until the function returns ACTION_BREAK.
+	 * @param	func	Function called for every element in the list
+	 */
+	template<typename Function>
+	void visit(const Function& func) const;
+
+	/**
+	 * Returns the first element of the list which is equal to an element. m_lock has to be locked.
+	 * @param	element	Element to search for
+	 * @return			Pointer to the first equal element, nullptr if no element is equal
+	 */
+	const T* find_element(const T& element) const;
+
+	/**
+	 * Takes over the nodes of another list in constant time. The list has to be empty, the other list is empty
+	 * afterwards. Both lists have to be locked exclusively.
+	 * @param	other	List to take the nodes from
+	 */
+	template<typename OtherLock>
+	void take(BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other);
+
+	/**
+	 * Clears the list and creates a deep copy of another list. Both lists are locked in the order of their addresses.
+	 * @param	other	List to copy
+	 */
+	template<typename OtherLock>
+	void copy(const BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other);
+
+	/**
+	 * Clears the list and takes over the nodes of another list in constant time. Both lists are locked exclusively in
+	 * the order of their addresses.
+	 * @param	other	List to move, it is empty afterwards
+	 */
+	template<typename OtherLock>
+	void move(BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other);
+
+	/**
+	 * Checks if the elements of the list are equal to the elements of another list and if they are sorted in the same
+	 * order. Both lists are locked in shared mode in the order of their addresses. Lists of different sizes are
+	 * unequal without comparing any element.
+	 * @param	other	List to compare to
+	 * @return			true if the lists contain equal elements in the same order, false otherwise
+	 */
+	template<typename OtherLock>
+	bool equals(const BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other) const;
+
+public:
+	/**
+	 * Function pointer to pass to the iterate method for usage as callback function for every element in the list.
+	 */
+	typedef typename List<T, Allocator>::IterationFunction IterationFunction;
+
+	/**
+	 * Function pointer to pass to the read-only iterate method for usage as callback function for every element in the
+	 * list. ACTION_REMOVE is ignored.
+	 */
+	typedef typename List<T, Allocator>::ConstIterationFunction ConstIterationFunction;
+
+	/**
+	 * Default constructor for instances of the class BasicUnrolledList.
+	 */
+	BasicUnrolledList();
+
+	/**
+	 * Copy-constructor for instances of the class BasicUnrolledList. The other list is locked in shared mode.
+	 * @param	other	List to copy
+	 */
+	BasicUnrolledList(const BasicUnrolledList& other);
+
+	/**
+	 * Copy-constructor for instances of the class BasicUnrolledList from a list with another lock policy. The other
+	 * list is locked in shared mode.
+	 * @param	other	List to copy
+	 */
+	template<typename OtherLock>
+	BasicUnrolledList(const BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other);
+
+	/**
+	 * Move-constructor for instances of the class BasicUnrolledList. Takes over the nodes of another list in constant
+	 * time while the other list is locked.
+	 * @param	other	List to move, it is empty afterwards
+	 */
+	BasicUnrolledList(BasicUnrolledList&& other);
+
+	/**
+	 * Move-constructor for instances of the class BasicUnrolledList from a list with another lock policy. Takes over
+	 * the nodes of the other list in constant time while the other list is locked.
+	 * @param	other	List to move, it is empty afterwards
+	 */
+	template<typename OtherLock>
+	BasicUnrolledList(BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>&& other);
+
+	/**
+	 * Constructor which creates an instance of the class BasicUnrolledList from an array.
+	 * @param	arr	Array to copy elements from
+	 */
+	template<size_t N>
+	BasicUnrolledList(const T (&arr)[N]);
+
+	/**
+	 * Destructor for instances of the class BasicUnrolledList.
+	 */
+	~BasicUnrolledList();
+
+	/**
+	 * Returns the count of elements in the list. Synchronized lists return the count at the time of the call without
+	 * locking the list.
+	 * @return	The count of elements in the list
+	 */
+	size_t size() const;
+
+	/**
+	 * Checks if the list is empty (= does not contain any elements). Synchronized lists don't lock the list.
+	 * @return	true if the list is empty, otherwise false
+	 */
+	bool empty() const;
+
+	/**
+	 * Removes all elements from the list.
+	 */
+	void clear();
+
+	/**
+	 * Adds an element to the back of the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_back(const T& element);
+
+	/**
+	 * Adds an element to the back of the list by moving it into the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_back(T&& element);
+
+	/**
+	 * Adds an element to the back of the list which is constructed in place.
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	void emplace_back(Args&&... args);
+
+	/**
+	 * Adds an element to the front of the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_front(const T& element);
+
+	/**
+	 * Adds an element to the front of the list by moving it into the list.
+	 * @param	element	Element to add to the list
+	 */
+	void push_front(T&& element);
+
+	/**
+	 * Adds an element to the front of the list which is constructed in place.
+	 * @param	args	Arguments passed to the constructor of the element
+	 */
+	template<typename... Args>
+	void emplace_front(Args&&... args);
+
+	/**
+	 * Removes the last element from the list and returns it. The element is moved out of the list.
+	 * @return	The removed last element or a value-initialized element if the list is empty
+	 */
+	T pop_back();
+
+	/**
+	 * Removes the last element from the list if the list is not empty. The element is moved out of the list.
+	 * @param	element	Receives the removed last element, it is left unchanged if the list is empty
+	 * @return			true if an element was removed, false if the list is empty
+	 */
+	bool try_pop_back(T& element);
+
+	/**
+	 * Removes the first element from the list and returns it. The element is moved out of the list.
+	 * @return	The removed first element or a value-initialized element if the list is empty
+	 */
+	T pop_front();
+
+	/**
+	 * Removes the first element from the list if the list is not empty. The element is moved out of the list.
+	 * @param	element	Receives the removed first element, it is left unchanged if the list is empty
+	 * @return			true if an element was removed, false if the list is empty
+	 */
+	bool try_pop_front(T& element);
+
+	/**
+	 * Removes elements from the list.
+	 * @param	element	Element to remove from the list
+	 */
+	void remove(const T& element);
+
+	/**
+	 * Removes the elements for which a predicate returns true.
+	 * @param	pred	Function object called for every element in the list
+	 * @return			The count of removed elements
+	 */
+	template<typename Predicate>
+	size_t remove_if(const Predicate& pred);
+
+	/**
+	 * Returns the first element of the list which is equal to an element. Only lists which are not synchronized
+	 * provide find, the element could be removed by another thread as soon as a synchronized list is unlocked.
+	 * @param	element	Element to search for
+	 * @return			Pointer to the first equal element, it is valid until the list is changed. nullptr if no
+	 *					element is equal.
+	 */
+	T* find(const T& element);
+
+	/**
+	 * Returns the first element of the list which is equal to an element. Only lists which are not synchronized
+	 * provide find.
+	 * @param	element	Element to search for
+	 * @return			Pointer to the first equal element, it is valid until the list is changed. nullptr if no
+	 *					element is equal.
+	 */
+	const T* find(const T& element) const;
+
+	/**
+	 * Counts the elements of the list which are equal to an element. m_lock is locked in shared mode.
+	 * @param	element	Element to search for
+	 * @return			The count of equal elements
+	 */
+	size_t count(const T& element) const;
+
+	/**
+	 * Checks if the list contains an element which is equal to an element. m_lock is locked in shared mode.
+	 * @param	element	Element to search for
+	 * @return			true if an equal element was found, otherwise false
+	 */
+	bool contains(const T& element) const;
+
+	/**
+	 * Iterates from the front to the back of the list using a function pointer as callback function for every element
+	 * in the list.
+	 * @param	func		Pointer to a callback function called for every element in the list
+	 * @param	parameter	A user-defined parameter to be passed to the callback function, can be NULL
+	 */
+	void iterate(const IterationFunction& func, void* parameter = nullptr);
+
+	/**
+	 * Iterates from the front to the back of the list without changing it using a function pointer as callback function
+	 * for every element in the list. m_lock is locked in shared mode.
+	 * @param	func		Pointer to a callback function called for every element in the list
+	 * @param	parameter	A user-defined parameter to be passed to the callback function, can be NULL
+	 */
+	void iterate(const ConstIterationFunction& func, void* parameter = nullptr) const;
+
+	/**
+	 * Iterates a non-const list without changing it using a function pointer as callback function for every element in
+	 * the list, like the const overload. Without it a ConstIterationFunction passed without parameter would be taken
+	 * for a lambda function.
+	 * @param	func		Pointer to a callback function called for every element in the list
+	 * @param	parameter	A user-defined parameter to be passed to the callback function, can be NULL
+	 */
+	void iterate(const ConstIterationFunction& func, void* parameter = nullptr);
+
+	/**
+	 * Iterates from the front to the back of the list using a lambda function as callback function for every element
+	 * in the list. The callback lambda function should have the following signature:
+	 * auto func = [your lambda capture list goes here](T& element) -> ListInterationAction { your code goes here };
+	 * @param	func	Callback lambda function called for every element in the list. It receives a reference to the
+	 *					current element as a parameter.
+	 */
+	template<typename Lambda>
+	void iterate(const Lambda& func);
+
+	/**
+	 * Iterates from the front to the back of the list without changing it using a lambda function as callback function
+	 * for every element in the list. This method is called for const lists, call it through a const reference to
+	 * iterate a non-const list read-only. m_lock is locked in shared mode. The callback lambda function should have the
+	 * following signature:
+	 * auto func = [your lambda capture list goes here](const T& element) -> ListInterationAction { your code goes here };
+	 * ACTION_REMOVE is ignored since the elements can't be removed by a read-only iteration.
+	 * @param	func	Callback lambda function called for every element in the list. It receives a const reference to
+	 *					the current element as a parameter.
+	 */
+	template<typename Lambda>
+	void iterate(const Lambda& func) const;
+
+	/**
+	 * Clears the list and creates a deep copy of another list. Both lists are locked in the order of their addresses.
+	 * @param	other	List to copy
+	 * @return			Reference to the BasicUnrolledList instance
+	 */
+	BasicUnrolledList& operator=(const BasicUnrolledList& other);
+
+	/**
+	 * Clears the list and creates a deep copy of a list with another lock policy. Both lists are locked in the order of
+	 * their addresses.
+	 * @param	other	List to copy
+	 * @return			Reference to the BasicUnrolledList instance
+	 */
+	template<typename OtherLock>
+	BasicUnrolledList& operator=(const BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other);
+
+	/**
+	 * Clears the list and takes over the nodes of another list in constant time. Both lists are locked in the order of
+	 * their addresses.
+	 * @param	other	List to move, it is empty afterwards
+	 * @return			Reference to the BasicUnrolledList instance
+	 */
+	BasicUnrolledList& operator=(BasicUnrolledList&& other);
+
+	/**
+	 * Clears the list and takes over the nodes of a list with another lock policy in constant time. Both lists are
+	 * locked in the order of their addresses.
+	 * @param	other	List to move, it is empty afterwards
+	 * @return			Reference to the BasicUnrolledList instance
+	 */
+	template<typename OtherLock>
+	BasicUnrolledList& operator=(BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>&& other);
+
+	/**
+	 * Checks if the elements of the list are equal to the elements of another list and if they are sorted in the same
+	 * order. Both lists are locked in shared mode in the order of their addresses.
+	 * @param	other	List to compare to
+	 * @return			true if the lists contain equal elements in the same order, false otherwise
+	 */
+	template<typename OtherLock>
+	bool operator==(const BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other) const;
+
+	/**
+	 * Checks if the elements of the list are unequal to the elements of another list or if they are sorted in a different
+	 * order. Both lists are locked in shared mode in the order of their addresses.
+	 * @param	other	List to compare to
+	 * @return			true if the lists contain unequal elements or if they are sorted in a different order,
+	 *					false otherwise
+	 */
+	template<typename OtherLock>
+	bool operator!=(const BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other) const;
+};
+
+
+/**
+ * An unrolled list class which doesn't lock at all. It must not be used by several threads at the same time.
+ * @tparam	T			Type of the elements of the list
+ * @tparam	ChunkSize	Maximum count of elements per node
+ * @tparam	Allocator	Allocator for the nodes of the list, e.g. PoolAllocator (default) or HeapAllocator
+ */
+template<typename T, size_t ChunkSize = 16, typename Allocator = PoolAllocator<>>
+using UnrolledList = BasicUnrolledList<T, ChunkSize, Allocator, NoLock>;
+
+
+// Include implementation of BasicUnrolledList
+#include "UnrolledList.tpp"
+
+
+#endif // #ifndef UNROLLEDLIST_HPP
@@ -0,0 +1,793 @@
+/**
+ * @file UnrolledList.tpp
+ * @date 17.10.2026
+ */
+
+#ifndef UNROLLEDLIST_HPP
+#error UNROLLEDLIST_HPP undefined
+#endif
+
+#include <functional>
+#include <new>
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::update_count()
+{
+	if (LockPolicyTraits<LockPolicy>::SYNCHRONIZED)
+	{
+		size_t before = m_count.load(std::memory_order_relaxed);
+		m_count.store(m_size, std::memory_order_release);
+		if (before != m_size)
+		{
+			LockPolicyTraits<LockPolicy>::count_changed(m_lock, before, m_size);
+		}
+	}
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::lock_pair(bool shared, const BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other, bool otherShared) const
+{
+	if (std::less<const void*>()(&other, this))
+	{
+		other.lock_list(otherShared);
+		lock_list(shared);
+	}
+	else
+	{
+		lock_list(shared);
+		other.lock_list(otherShared);
+	}
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::unlock_pair(bool shared, const BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other, bool otherShared) const
+{
+	unlock_list(shared);
+	other.unlock_list(otherShared);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::lock_list(bool shared) const
+{
+	if (shared)
+	{
+		m_lock.lock_shared();
+	}
+	else
+	{
+		m_lock.lock();
+	}
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::unlock_list(bool shared) const
+{
+	if (shared)
+	{
+		m_lock.unlock_shared();
+	}
+	else
+	{
+		// Only non-const methods lock the list exclusively, so the list itself isn't const
+		const_cast<BasicUnrolledList*>(this)->update_count();
+		m_lock.unlock();
+	}
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+typename BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::Chunk* BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::back_chunk()
+{
+	if (m_last && ChunkSize != m_last->m_end)
+	{
+		return m_last;
+	}
+
+	// Elements added to the back fill a new node from its start
+	Chunk* chunk = new (m_allocator.allocate()) Chunk(0);
+	if (m_last)
+	{
+		chunk->m_prev = m_last;
+		m_last->m_next = chunk;
+	}
+	else
+	{
+		m_first = chunk;
+	}
+	m_last = chunk;
+	return chunk;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+typename BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::Chunk* BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::front_chunk()
+{
+	if (m_first && 0 != m_first->m_begin)
+	{
+		return m_first;
+	}
+
+	// Elements added to the front fill a new node from its end
+	Chunk* chunk = new (m_allocator.allocate()) Chunk(ChunkSize);
+	if (m_first)
+	{
+		chunk->m_next = m_first;
+		m_first->m_prev = chunk;
+	}
+	else
+	{
+		m_last = chunk;
+	}
+	m_first = chunk;
+	return chunk;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::destroy_chunk(Chunk* chunk)
+{
+	if (chunk->m_prev)
+	{
+		chunk->m_prev->m_next = chunk->m_next;
+	}
+	else
+	{
+		m_first = chunk->m_next;
+	}
+
+	if (chunk->m_next)
+	{
+		chunk->m_next->m_prev = chunk->m_prev;
+	}
+	else
+	{
+		m_last = chunk->m_prev;
+	}
+
+	chunk->~Chunk();
+	m_allocator.deallocate(chunk);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename... Args>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::construct_back(Args&&... args)
+{
+	Chunk* chunk = back_chunk();
+	try
+	{
+		new (chunk->element(chunk->m_end)) T(std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		// The constructor of the element threw, don't leak a new node
+		if (chunk->m_begin == chunk->m_end)
+		{
+			destroy_chunk(chunk);
+		}
+		throw;
+	}
+	chunk->m_end++;
+	m_size++;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename... Args>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::construct_front(Args&&... args)
+{
+	Chunk* chunk = front_chunk();
+	try
+	{
+		new (chunk->element(chunk->m_begin - 1)) T(std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		// The constructor of the element threw, don't leak a new node
+		if (chunk->m_begin == chunk->m_end)
+		{
+			destroy_chunk(chunk);
+		}
+		throw;
+	}
+	chunk->m_begin--;
+	m_size++;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::destroy_back()
+{
+	Chunk* chunk = m_last;
+	chunk->m_end--;
+	chunk->element(chunk->m_end)->~T();
+	m_size--;
+	if (chunk->m_begin == chunk->m_end)
+	{
+		destroy_chunk(chunk);
+	}
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::destroy_front()
+{
+	Chunk* chunk = m_first;
+	chunk->element(chunk->m_begin)->~T();
+	chunk->m_begin++;
+	m_size--;
+	if (chunk->m_begin == chunk->m_end)
+	{
+		destroy_chunk(chunk);
+	}
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::destroy_chunks()
+{
+	if (!Allocator::BULK_RELEASE || !std::is_trivially_destructible<T>::value)
+	{
+		Chunk* current = m_first;
+		while (current)
+		{
+			Chunk* next = current->m_next;
+			for (unsigned int i = current->m_begin; i < current->m_end; i++)
+			{
+				current->element(i)->~T();
+			}
+			current->~Chunk();
+			if (!Allocator::BULK_RELEASE)
+			{
+				m_allocator.deallocate(current);
+			}
+			current = next;
+		}
+	}
+	// Return whole slabs instead of single nodes if the allocator supports it
+	m_allocator.release();
+	m_first = nullptr;
+	m_last = nullptr;
+	m_size = 0;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::close_gap(Chunk* chunk, unsigned int write, unsigned int read)
+{
+	for (; read < chunk->m_end; read++, write++)
+	{
+		if (write != read)
+		{
+			new (chunk->element(write)) T(std::move(*chunk->element(read)));
+			chunk->element(read)->~T();
+		}
+	}
+	chunk->m_end = write;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename Function>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::filter(const Function& func)
+{
+	bool stop = false;
+	Chunk* chunk = m_first;
+	while (chunk && !stop)
+	{
+		Chunk* next = chunk->m_next;
+
+		// Invariant: the storage in the range [write, read) is unused
+		unsigned int write = chunk->m_begin;
+		for (unsigned int read = chunk->m_begin; read < chunk->m_end; read++)
+		{
+			T* element = chunk->element(read);
+			// After a break the remaining elements of the node are only compacted
+			ListIterationAction action = ListIterationAction::ACTION_CONTINUE;
+			try
+			{
+				action = stop ? ListIterationAction::ACTION_CONTINUE : func(*element);
+			}
+			catch (...)
+			{
+				// The current element is kept like all elements behind it
+				close_gap(chunk, write, read);
+				throw;
+			}
+			if (action & ListIterationAction::ACTION_REMOVE)
+			{
+				element->~T();
+				m_size--;
+			}
+			else
+			{
+				if (write != read)
+				{
+					new (chunk->element(write)) T(std::move(*element));
+					element->~T();
+				}
+				write++;
+			}
+			if (action & ListIterationAction::ACTION_BREAK)
+			{
+				stop = true;
+			}
+		}
+		chunk->m_end = write;
+
+		if (chunk->m_begin == chunk->m_end)
+		{
+			destroy_chunk(chunk);
+		}
+		chunk = next;
+	}
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename Function>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::visit(const Function& func) const
+{
+	for (const Chunk* current = m_first; current; current = current->m_next)
+	{
+		for (unsigned int i = current->m_begin; i < current->m_end; i++)
+		{
+			if (func(*current->element(i)) & ListIterationAction::ACTION_BREAK)
+			{
+				return;
+			}
+		}
+	}
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+const T* BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::find_element(const T& element) const
+{
+	for (const Chunk* current = m_first; current; current = current->m_next)
+	{
+		size_t count = current->m_end - current->m_begin;
+		size_t index = SimdSearch::find(current->element(current->m_begin), count, element);
+		if (index < count)
+		{
+			return current->element(current->m_begin + static_cast<unsigned int>(index));
+		}
+	}
+	return nullptr;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::take(BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other)
+{
+	m_first = other.m_first;
+	m_last = other.m_last;
+	m_size = other.m_size;
+	// The nodes belong to the allocator of the other list, so take the allocator along with them
+	m_allocator.swap(other.m_allocator);
+	other.m_first = nullptr;
+	other.m_last = nullptr;
+	other.m_size = 0;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::copy(const BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other)
+{
+	if (static_cast<const void*>(this) != static_cast<const void*>(&other))
+	{
+		lock_pair(false, other, true);
+		try
+		{
+			// Walk the nodes of the other list directly, both lists are locked already
+			destroy_chunks();
+			for (const typename BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>::Chunk* chunk = other.m_first; chunk; chunk = chunk->m_next)
+			{
+				for (unsigned int i = chunk->m_begin; i < chunk->m_end; i++)
+				{
+					construct_back(*chunk->element(i));
+				}
+			}
+		}
+		catch (...)
+		{
+			unlock_pair(false, other, true);
+			throw;
+		}
+		unlock_pair(false, other, true);
+	}
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::move(BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other)
+{
+	if (static_cast<const void*>(this) != static_cast<const void*>(&other))
+	{
+		lock_pair(false, other, false);
+		destroy_chunks();
+		take(other);
+		unlock_pair(false, other, false);
+	}
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+bool BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::equals(const BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other) const
+{
+	if (static_cast<const void*>(this) == static_cast<const void*>(&other))
+	{
+		return true;
+	}
+
+	lock_pair(true, other, true);
+	// Both lists are locked, so lists of different sizes are unequal without comparing any element
+	bool ret = m_size == other.m_size;
+	try
+	{
+		// Walk both lists along each other, their nodes may hold different counts of elements
+		const Chunk* chunk = m_first;
+		unsigned int index = chunk ? chunk->m_begin : 0;
+		for (const typename BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>::Chunk* otherChunk = other.m_first; ret && otherChunk; otherChunk = otherChunk->m_next)
+		{
+			for (unsigned int i = otherChunk->m_begin; ret && i < otherChunk->m_end; i++)
+			{
+				ret = *chunk->element(index) == *otherChunk->element(i);
+				if (++index == chunk->m_end)
+				{
+					chunk = chunk->m_next;
+					index = chunk ? chunk->m_begin : 0;
+				}
+			}
+		}
+	}
+	catch (...)
+	{
+		unlock_pair(true, other, true);
+		throw;
+	}
+	unlock_pair(true, other, true);
+	return ret;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::BasicUnrolledList() : m_first(nullptr), m_last(nullptr), m_size(0),
+	m_allocator(sizeof(Chunk), alignof(Chunk)), m_lock(), m_count(0)
+{
+	// Nothing to do yet
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::BasicUnrolledList(const BasicUnrolledList& other) : m_first(nullptr), m_last(nullptr),
+	m_size(0), m_allocator(sizeof(Chunk), alignof(Chunk)), m_lock(), m_count(0)
+{
+	copy(other);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::BasicUnrolledList(const BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other) : m_first(nullptr),
+	m_last(nullptr), m_size(0), m_allocator(sizeof(Chunk), alignof(Chunk)), m_lock(), m_count(0)
+{
+	copy(other);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::BasicUnrolledList(BasicUnrolledList&& other) : m_first(nullptr), m_last(nullptr),
+	m_size(0), m_allocator(sizeof(Chunk), alignof(Chunk)), m_lock(), m_count(0)
+{
+	move(other);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::BasicUnrolledList(BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>&& other) : m_first(nullptr), m_last(nullptr),
+	m_size(0), m_allocator(sizeof(Chunk), alignof(Chunk)), m_lock(), m_count(0)
+{
+	move(other);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<size_t N>
+BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::BasicUnrolledList(const T (&arr)[N]) : m_first(nullptr), m_last(nullptr),
+	m_size(0), m_allocator(sizeof(Chunk), alignof(Chunk)), m_lock(), m_count(0)
+{
+	for (size_t i = 0; i < N; i++)
+	{
+		construct_back(arr[i]);
+	}
+	update_count();
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::~BasicUnrolledList()
+{
+	destroy_chunks();
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+size_t BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::size() const
+{
+	if (LockPolicyTraits<LockPolicy>::SYNCHRONIZED)
+	{
+		return m_count.load(std::memory_order_acquire);
+	}
+	return m_size;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+bool BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::empty() const
+{
+	return 0 == size();
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::clear()
+{
+	ExclusiveLock lock(this);
+	destroy_chunks();
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::push_back(const T& element)
+{
+	ExclusiveLock lock(this);
+	construct_back(element);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::push_back(T&& element)
+{
+	ExclusiveLock lock(this);
+	construct_back(std::move(element));
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename... Args>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::emplace_back(Args&&... args)
+{
+	ExclusiveLock lock(this);
+	construct_back(std::forward<Args>(args)...);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::push_front(const T& element)
+{
+	ExclusiveLock lock(this);
+	construct_front(element);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::push_front(T&& element)
+{
+	ExclusiveLock lock(this);
+	construct_front(std::move(element));
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename... Args>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::emplace_front(Args&&... args)
+{
+	ExclusiveLock lock(this);
+	construct_front(std::forward<Args>(args)...);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+T BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::pop_back()
+{
+	T element = T();
+	try_pop_back(element);
+	return element;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+bool BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::try_pop_back(T& element)
+{
+	ExclusiveLock lock(this);
+	if (m_last)
+	{
+		element = std::move(*m_last->element(m_last->m_end - 1));
+		destroy_back();
+		return true;
+	}
+	return false;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+T BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::pop_front()
+{
+	T element = T();
+	try_pop_front(element);
+	return element;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+bool BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::try_pop_front(T& element)
+{
+	ExclusiveLock lock(this);
+	if (m_first)
+	{
+		element = std::move(*m_first->element(m_first->m_begin));
+		destroy_front();
+		return true;
+	}
+	return false;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::remove(const T& element)
+{
+	ExclusiveLock lock(this);
+	Chunk* chunk = m_first;
+	while (chunk)
+	{
+		Chunk* next = chunk->m_next;
+
+		// Nodes without an equal element are skipped, the others are compacted from their first equal element on
+		unsigned int write = chunk->m_begin + static_cast<unsigned int>(SimdSearch::find(chunk->element(chunk->m_begin),
+			chunk->m_end - chunk->m_begin, element));
+		if (write < chunk->m_end)
+		{
+			for (unsigned int read = write; read < chunk->m_end; read++)
+			{
+				T* current = chunk->element(read);
+				bool equal;
+				try
+				{
+					equal = element == *current;
+				}
+				catch (...)
+				{
+					// The elements in [write, read) are already destroyed or moved, the current one is kept
+					close_gap(chunk, write, read);
+					throw;
+				}
+				if (equal)
+				{
+					current->~T();
+					m_size--;
+				}
+				else
+				{
+					if (write != read)
+					{
+						new (chunk->element(write)) T(std::move(*current));
+						current->~T();
+					}
+					write++;
+				}
+			}
+			chunk->m_end = write;
+
+			if (chunk->m_begin == chunk->m_end)
+			{
+				destroy_chunk(chunk);
+			}
+		}
+		chunk = next;
+	}
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename Predicate>
+size_t BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::remove_if(const Predicate& pred)
+{
+	ExclusiveLock lock(this);
+	size_t size = m_size;
+	filter([&pred](T& current) -> ListIterationAction
+	{
+		return pred(current) ? ListIterationAction::ACTION_REMOVE : ListIterationAction::ACTION_CONTINUE;
+	});
+	return size - m_size;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+T* BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::find(const T& element)
+{
+	static_assert(!LockPolicyTraits<LockPolicy>::SYNCHRONIZED,
+		"Pointers to elements can't be used without locking the list, use contains or iterate instead");
+	return const_cast<T*>(find_element(element));
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+const T* BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::find(const T& element) const
+{
+	static_assert(!LockPolicyTraits<LockPolicy>::SYNCHRONIZED,
+		"Pointers to elements can't be used without locking the list, use contains or iterate instead");
+	return find_element(element);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+size_t BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::count(const T& element) const
+{
+	SharedLock lock(this);
+	size_t matches = 0;
+	for (const Chunk* current = m_first; current; current = current->m_next)
+	{
+		matches += SimdSearch::count(current->element(current->m_begin), current->m_end - current->m_begin, element);
+	}
+	return matches;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+bool BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::contains(const T& element) const
+{
+	SharedLock lock(this);
+	return nullptr != find_element(element);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::iterate(const IterationFunction& func, void* parameter)
+{
+	ExclusiveLock lock(this);
+	filter([&func, parameter](T& element) -> ListIterationAction
+	{
+		return func(element, parameter);
+	});
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::iterate(const ConstIterationFunction& func, void* parameter) const
+{
+	SharedLock lock(this);
+	visit([&func, parameter](const T& element) -> ListIterationAction
+	{
+		return func(element, parameter);
+	});
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::iterate(const ConstIterationFunction& func, void* parameter)
+{
+	static_cast<const BasicUnrolledList*>(this)->iterate(func, parameter);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename Lambda>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::iterate(const Lambda& func)
+{
+	ExclusiveLock lock(this);
+	filter(func);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename Lambda>
+void BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::iterate(const Lambda& func) const
+{
+	SharedLock lock(this);
+	visit(func);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>& BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::operator=(const BasicUnrolledList& other)
+{
+	copy(other);
+	return *this;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>& BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::operator=(const BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other)
+{
+	copy(other);
+	return *this;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>& BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::operator=(BasicUnrolledList&& other)
+{
+	move(other);
+	return *this;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>& BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::operator=(BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>&& other)
+{
+	move(other);
+	return *this;
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+bool BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::operator==(const BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other) const
+{
+	return equals(other);
+}
+
+template<typename T, size_t ChunkSize, typename Allocator, typename LockPolicy>
+template<typename OtherLock>
+bool BasicUnrolledList<T, ChunkSize, Allocator, LockPolicy>::operator!=(const BasicUnrolledList<T, ChunkSize, Allocator, OtherLock>& other) const
+{
+	return !equals(other);
+}
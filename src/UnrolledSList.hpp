@@ -0,0 +1,28 @@
+/**
+ * @file UnrolledSList.hpp
+ * @date 17.10.2026
+ */
+
+#ifndef UNROLLEDSLIST_HPP
+#define UNROLLEDSLIST_HPP
+
+
+#include "UnrolledList.hpp"
+#include "Mutex.hpp"
+
+
+/**
+ * A thread-safe unrolled list class. It provides the same methods as SList and stores up to ChunkSize elements per
+ * node like UnrolledList. UnrolledSList is a BasicUnrolledList whose lock policy is a mutex, so every method locks the
+ * list, including the lambda iterate methods, and size() and empty() don't lock the list. find is not available since
+ * its result could be removed by another thread.
+ * @tparam	T			Type of the elements of the list
+ * @tparam	ChunkSize	Maximum count of elements per node
+ * @tparam	Allocator	Allocator for the nodes of the list, e.g. PoolAllocator (default) or HeapAllocator
+ * @tparam	MutexType	Mutex used to lock the list, e.g. Mutex (default), RWMutex or AdaptiveMutex
+ */
+template<typename T, size_t ChunkSize = 16, typename Allocator = PoolAllocator<>, typename MutexType = Mutex>
+using UnrolledSList = BasicUnrolledList<T, ChunkSize, Allocator, MutexType>;
+
+
+#endif // #ifndef UNROLLEDSLIST_HPP
@@ -1,7 +1,35 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
 #include <thread>
+#include <type_traits>
+#include <vector>
 #include "../src/List.hpp"
 #include "../src/SList.hpp"
+#include "../src/AdaptiveMutex.hpp"
+#include "../src/BlockingSList.hpp"
+#include "../src/CachingAllocator.hpp"
+#include "../src/FlatCombiningSList.hpp"
+#include "../src/HeapAllocator.hpp"
+#include "../src/IndexedSList.hpp"
+#include "../src/IntrusiveSList.hpp"
+#include "../src/LockCouplingSList.hpp"
+#include "../src/LockFreeSList.hpp"
+#include "../src/ParallelForEach.hpp"
+#include "../src/RWMutex.hpp"
+#include "../src/ShardedSList.hpp"
+#include "../src/SimdSearch.hpp"
+#include "../src/SnapshotSList.hpp"
+#include "../src/UnrolledList.hpp"
+#include "../src/UnrolledSList.hpp"
 
 /**
  * Prints an error message to the standart error stream if a given expression is false.
@@ -167,209 +195,2755 @@ static void TestPushAndPopMethods()
 }
 
 /**
- * Tests the remove method of List and SList.
+ * Tests the try_pop_back/try_pop_front methods of List and SList as well as the try_lock_pop_back/try_lock_pop_front
+ * methods of SList.
  */
-static void TestRemoveMethod()
+static void TestTryPopMethods()
 {
-	const int elements[] = { 0,1,2,0,0,0,6,7,8,0 };
-
-	// Prepare lists
+	const int elements[] = { 1,2,3 };
 	List<int> list(elements);
 	SList<int> slist(elements);
 
-	// Test remove
-	list.remove(0);
-	dynamic_assert(5 == list.size(), "Error in List<T>::remove");
-	slist.remove(0);
-	dynamic_assert(5 == slist.size(), "Error in SList<T>::remove");
+	// Test try_pop methods for filled lists
+	int front = 0;
+	int back = 0;
+	dynamic_assert(list.try_pop_front(front) && 1 == front, "Error in List<T>::try_pop_front");
+	dynamic_assert(list.try_pop_back(back) && 3 == back, "Error in List<T>::try_pop_back");
+	dynamic_assert(slist.try_pop_front(front) && 1 == front, "Error in SList<T>::try_pop_front");
+	dynamic_assert(slist.try_pop_back(back) && 3 == back, "Error in SList<T>::try_pop_back");
+
+	// Test try_pop methods for empty lists, the element must be left unchanged
+	dynamic_assert(list.try_pop_front(front) && !list.try_pop_front(front) && !list.try_pop_back(back) && 2 == front && 3 == back, "Error in List<T>::try_pop_front or List<T>::try_pop_back for an empty list");
+	dynamic_assert(slist.try_pop_back(back) && !slist.try_pop_front(front) && !slist.try_pop_back(back) && 2 == front && 2 == back, "Error in SList<T>::try_pop_front or SList<T>::try_pop_back for an empty list");
+
+	// pop methods return a value-initialized element for empty lists, so they work for types without an int constructor
+	List<std::string> list2;
+	SList<std::string> slist2;
+	dynamic_assert(list2.pop_front().empty() && list2.pop_back().empty(), "Error in List<T>::pop_front or List<T>::pop_back for an empty list");
+	dynamic_assert(slist2.pop_front().empty() && slist2.pop_back().empty(), "Error in SList<T>::pop_front or SList<T>::pop_back for an empty list");
+
+	// try_lock_pop methods must fail immediately while another thread holds the lock of the list
+	slist.push_back(4);
+	slist.push_back(5);
+	bool removedWhileLocked = true;
+	slist.iterate([&](int& /*element*/) -> ListIterationAction
+	{
+		std::thread thread([&]() -> void
+		{
+			int element;
+			removedWhileLocked = slist.try_lock_pop_front(element) || slist.try_lock_pop_back(element);
+		});
+		thread.join();
+		return ListIterationAction::ACTION_BREAK;
+	});
+	dynamic_assert(!removedWhileLocked && 2 == slist.size(), "Error in SList<T>::try_lock_pop_front or SList<T>::try_lock_pop_back for a locked list");
+	dynamic_assert(slist.try_lock_pop_front(front) && 4 == front, "Error in SList<T>::try_lock_pop_front");
+	dynamic_assert(slist.try_lock_pop_back(back) && 5 == back, "Error in SList<T>::try_lock_pop_back");
+	dynamic_assert(!slist.try_lock_pop_front(front) && !slist.try_lock_pop_back(back), "Error in SList<T>::try_lock_pop_front or SList<T>::try_lock_pop_back for an empty list");
 }
 
 /**
- * Tests the iterate method of List and SList which takes a function pointer as parameter.
+ * Element whose copy constructor and copy assignment throw for negative values.
  */
-static void TestFirstIterateMethod()
+struct CopyThrowingElement
 {
-	const int elements[] = { 0,1,2,3,4,5,6,7,8,9 };
-
-	// Prepare lists
-	List<int> list(elements);
-	SList<int> slist(elements);
+	int m_value;
 
-	// Prepare parameters
-	struct IterationParams
+	CopyThrowingElement(int value = 0) : m_value(value) {}
+	CopyThrowingElement(const CopyThrowingElement& other) : m_value(other.m_value)
 	{
-		int			m_index;
-		const int*	m_elements;
-	} params, sparams;
-	params.m_index		= 0;
-	params.m_elements	= elements;
-	sparams.m_index		= 0;
-	sparams.m_elements	= elements;
-
-	// Prepare iteration functions
-	auto iterateFunc = [](int& element, void* parameter) -> ListIterationAction
+		if (m_value < 0)
+		{
+			throw std::runtime_error("negative element");
+		}
+	}
+	CopyThrowingElement& operator=(const CopyThrowingElement& other)
 	{
-		IterationParams* params = static_cast<IterationParams*>(parameter);
-		if (element == params->m_elements[params->m_index])
+		if (other.m_value < 0)
 		{
-			params->m_index++;
-			return ListIterationAction::ACTION_CONTINUE;
+			throw std::runtime_error("negative element");
 		}
-		return ListIterationAction::ACTION_BREAK;
-	};
+		m_value = other.m_value;
+		return *this;
+	}
+};
 
-	List<int>::IterationFunction func = iterateFunc;
-	SList<int>::IterationFunction sfunc = iterateFunc;
+/**
+ * Tests the bulk operations of List, SList and BlockingSList.
+ */
+static void TestBulkOperations()
+{
+	const int elements[] = { 1,2,3,4,5 };
+	List<int> list;
+	SList<int> slist;
 
-	// Iterate the lists
-	list.iterate(func, &params);
-	slist.iterate(sfunc, &sparams);
+	// Test range push_back methods
+	list.push_back(elements, elements + 5);
+	slist.push_back(elements, elements + 5);
+	dynamic_assert(list == List<int>(elements), "Error in List<T>::push_back for a range");
+	dynamic_assert(slist == List<int>(elements), "Error in SList<T>::push_back for a range");
 
-	// Check the results of the iterations
-	dynamic_assert(params.m_index == sizeof(elements) / sizeof(int), "Error in List<T>iterate(const typename List<T>::IterationFunction& func, void* parameter)");
-	dynamic_assert(sparams.m_index == sizeof(elements) / sizeof(int), "Error in SList<T>iterate(const typename List<T>::IterationFunction& func, void* parameter)");
+	// Test pop_front_n methods
+	int popped[5] = { 0 };
+	dynamic_assert(3 == list.pop_front_n(3, popped) && 1 == popped[0] && 3 == popped[2] && 2 == list.size(), "Error in List<T>::pop_front_n");
+	dynamic_assert(2 == list.pop_front_n(3, popped) && 4 == popped[0] && 5 == popped[1] && list.empty(), "Error in List<T>::pop_front_n for less elements than requested");
+	dynamic_assert(5 == slist.pop_front_n(10, popped) && 5 == popped[4] && slist.empty() && 0 == slist.pop_front_n(1, popped), "Error in SList<T>::pop_front_n");
 
-	// TODO: Test iterate methods using ListIterationAction::ACTION_BREAK and ListIterationAction::ACTION_REMOVE
+	// Test append methods, the nodes must stay valid after the other list has been destroyed
+	{
+		List<int> other(elements);
+		list.push_back(0);
+		list.append(std::move(other));
+		dynamic_assert(other.empty() && 6 == list.size(), "Error in List<T>::append");
+	}
+	{
+		List<int> other(elements);
+		slist.append(std::move(other));
+		dynamic_assert(other.empty() && 5 == slist.size(), "Error in SList<T>::append");
+	}
+	list.push_back(6);
+	dynamic_assert(0 == list.pop_front() && 6 == list.pop_back() && 5 == list.pop_back() && 4 == list.size(), "Error in List<T>::append for a non-empty list");
+	slist.append(List<int>());
+	dynamic_assert(slist == List<int>(elements), "Error in SList<T>::append for an empty list");
+
+	// Range push_back of BlockingSList must wait for space while a consumer removes elements
+	BlockingSList<int> blist(2);
+	int sum = 0;
+	std::thread consumer([&]() -> void
+	{
+		int element;
+		for (int i = 0; i < 5 && blist.wait_pop_front(element); i++)
+		{
+			sum += element;
+		}
+	});
+	blist.push_back(elements, elements + 5);
+	consumer.join();
+	dynamic_assert(15 == sum && blist.empty(), "Error in BlockingSList<T>::push_back for a range");
+
+	// An exception thrown by an element must unlock the list, the elements added before stay in the list
+	SList<CopyThrowingElement> throwing;
+	const CopyThrowingElement throwingElements[] = { 1, -2, 3 };
+	bool thrown = false;
+	try
+	{
+		throwing.push_back(throwingElements, throwingElements + 3);
+	}
+	catch (const std::runtime_error&)
+	{
+		thrown = true;
+	}
+	bool unlocked = false;
+	std::thread([&]() -> void
+	{
+		CopyThrowingElement element;
+		unlocked = throwing.try_lock_pop_front(element) && 1 == element.m_value;
+	}).join();
+	dynamic_assert(thrown && unlocked && throwing.empty(), "Error in SList<T>::push_back for a range, the list stayed locked after an exception");
+
+	// The element which can't be assigned to the output stays in the list
+	throwing.emplace_back(-4);
+	throwing.emplace_back(5);
+	CopyThrowingElement output[2];
+	thrown = false;
+	try
+	{
+		throwing.pop_front_n(2, output);
+	}
+	catch (const std::runtime_error&)
+	{
+		thrown = true;
+	}
+	unlocked = false;
+	std::thread([&]() -> void
+	{
+		CopyThrowingElement element;
+		unlocked = throwing.try_lock_pop_back(element) && 5 == element.m_value;
+	}).join();
+	dynamic_assert(thrown && unlocked && 1 == throwing.size(), "Error in SList<T>::pop_front_n, the list stayed locked after an exception");
 }
 
 /**
- * Tests the iterate method of List and SList which takes a lambda function as parameter.
+ * Tests sort, merge, unique and reverse of List and SList.
  */
-static void TestSecondIterateMethod()
+static void TestSortMethods()
 {
-	const int elements[] = { 0,1,2,3,4,5,6,7,8,9 };
+	// Sort pseudo-random numbers and compare the result to std::sort
+	std::vector<int> numbers;
+	unsigned int seed = 12345;
+	for (int i = 0; i < 1000; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		numbers.push_back(static_cast<int>((seed >> 16) % 100));
+	}
+	List<int> list;
+	list.push_back(numbers.begin(), numbers.end());
+	list.sort();
+	std::sort(numbers.begin(), numbers.end());
+	dynamic_assert(1000 == list.size() && std::equal(numbers.begin(), numbers.end(), list.begin()), "Error in List<T>::sort");
+	// m_prev and m_last have to be linked again
+	dynamic_assert(std::equal(numbers.rbegin(), numbers.rend(), std::reverse_iterator<List<int>::iterator>(list.end())), "Error in List<T>::sort, the nodes are not linked backwards");
 
-	// Prepare lists
-	List<int> list(elements);
-	SList<int> slist(elements);
+	// Test unique and reverse
+	dynamic_assert(900 == list.unique() && 100 == list.size() && 0 == *list.begin() && 99 == *(--list.end()), "Error in List<T>::unique");
+	list.reverse();
+	int expected = 99;
+	bool reversed = true;
+	for (int element : list)
+	{
+		reversed = reversed && expected-- == element;
+	}
+	dynamic_assert(reversed && 0 == list.pop_back() && 99 == list.pop_front(), "Error in List<T>::reverse");
 
-	int index;
-	auto iterateFunc = [&](int& element) -> ListIterationAction
+	// Sorting has to keep the order of equal elements
+	List<std::pair<int, int>> pairs;
+	for (int i = 0; i < 100; i++)
 	{
-		if (element == elements[index])
-		{
-			index++;
-			return ListIterationAction::ACTION_CONTINUE;
-		}
-		return ListIterationAction::ACTION_BREAK;
-	};
+		pairs.push_back(std::make_pair(i % 3, i));
+	}
+	pairs.sort([](const std::pair<int, int>& first, const std::pair<int, int>& second) -> bool
+	{
+		return first.first < second.first;
+	});
+	dynamic_assert(std::is_sorted(pairs.begin(), pairs.end()), "Error in List<T>::sort, the order of equal elements is not kept");
 
-	// Iterate the first list
-	index = 0;
-	list.iterate(iterateFunc);
-	dynamic_assert(index == sizeof(elements) / sizeof(int), "Error in List<T>::iterate(const Lambda& func)");
+	// Test merge with a custom comparison, the other list is empty afterwards
+	const int descending1[] = { 9,7,5,3,1 };
+	const int descending2[] = { 8,6,4,2,0 };
+	const int merged[] = { 9,8,7,6,5,4,3,2,1,0 };
+	List<int> list1(descending1);
+	List<int> list2(descending2);
+	list1.merge(std::move(list2), std::greater<int>());
+	dynamic_assert(list1 == List<int>(merged) && list2.empty() && 10 == list1.size(), "Error in List<T>::merge");
+	list2.push_back(5);
+	dynamic_assert(1 == list2.size(), "Error in List<T>::merge, the other list is unusable");
 
-	// Iterate the second list
-	index = 0;
-	slist.iterate(iterateFunc);
-	dynamic_assert(index == sizeof(elements) / sizeof(int), "Error in SList<T>::iterate(const Lambda& func)");
+	// A throwing comparison must not lose any element
+	int comparisons = 0;
+	bool thrown = false;
+	try
+	{
+		list1.sort([&comparisons](int first, int second) -> bool
+		{
+			if (++comparisons > 10)
+			{
+				throw std::runtime_error("Comparison failed");
+			}
+			return first < second;
+		});
+	}
+	catch (const std::runtime_error&)
+	{
+		thrown = true;
+	}
+	std::vector<int> elements(list1.begin(), list1.end());
+	std::sort(elements.begin(), elements.end());
+	dynamic_assert(thrown && 10 == list1.size() && 10 == elements.size() && 0 == elements.front() && 9 == elements.back(), "Error in List<T>::sort with a throwing comparison");
 
-	// TODO: Test iterate methods using ListIterationAction::ACTION_BREAK and ListIterationAction::ACTION_REMOVE
+	// Test SList, its count has to follow unique and merge
+	const int unsorted[] = { 3,1,2,3,1,2 };
+	const int sorted[] = { 1,2,3,4 };
+	SList<int> slist(unsorted);
+	slist.sort();
+	dynamic_assert(3 == slist.unique() && 3 == slist.size(), "Error in SList<T>::sort or SList<T>::unique");
+	List<int> other;
+	other.push_back(4);
+	slist.merge(std::move(other));
+	dynamic_assert(slist == List<int>(sorted) && 4 == slist.size(), "Error in SList<T>::merge");
+	slist.reverse();
+	dynamic_assert(4 == slist.pop_front() && 1 == slist.pop_back(), "Error in SList<T>::reverse");
 }
 
 /**
- * Tests the operator methods of List and SList.
+ * Tests UnrolledList and UnrolledSList.
  */
-static void TestOperators()
+static void TestUnrolledList()
 {
-	const int elements1[] = { 0,1,2,3,4,5,6,7,8,9 };
-	const int elements2[] = { 0,1,2,3,4,5,6,7,8,0 };
-	const int elements3[] = { 0,1,2,3,4,5,6,7,8,9,10 };
+	// Use small nodes, so elements are spread over several nodes
+	const int elements[] = { 1,2,3,4,5,6,7,8,9,10 };
+	UnrolledList<int, 4> list(elements);
+	UnrolledSList<int, 4> slist(elements);
+	dynamic_assert(10 == list.size() && 10 == slist.size(), "Error in UnrolledList<T>::UnrolledList(const T (&)[N]) or UnrolledSList<T>::UnrolledSList(const T (&)[N])");
+	dynamic_assert(list == UnrolledList<int, 4>(elements) && slist == list && list != UnrolledList<int, 4>(), "Error in UnrolledList<T>::operator== or UnrolledList<T>::operator!=");
 
-	// Prepare lists
-	List<int> list1(elements1);
-	List<int> list2;
-	List<int> list3(elements2);
-	List<int> list4(elements3);
-	SList<int> slist1(elements1);
-	SList<int> slist2;
-	SList<int> slist3(elements2);
-	SList<int> slist4(elements3);
+	// Test push and pop methods at both ends
+	for (int i = 0; i < 6; i++)
+	{
+		list.push_front(-i);
+		slist.push_front(-i);
+	}
+	dynamic_assert(-5 == list.pop_front() && 10 == list.pop_back() && 14 == list.size(), "Error in UnrolledList<T>::pop_front or UnrolledList<T>::pop_back");
+	int element = 0;
+	dynamic_assert(slist.try_pop_front(element) && -5 == element && slist.try_pop_back(element) && 10 == element, "Error in UnrolledSList<T>::try_pop_front or UnrolledSList<T>::try_pop_back");
 
-	// Test operator=
-	list2 = list1;
-	slist2 = slist1;
+	// Test removing elements from the middle of the nodes, the remaining elements must keep their order
+	list.iterate([](int& current) -> ListIterationAction
+	{
+		return 0 == current % 2 ? ListIterationAction::ACTION_REMOVE : ListIterationAction::ACTION_CONTINUE;
+	});
+	const int odd[] = { -3,-1,1,3,5,7,9 };
+	dynamic_assert(list == UnrolledList<int, 4>(odd) && 7 == list.size(), "Error in UnrolledList<T>::iterate with ACTION_REMOVE");
 
-	// Test operator==
-	dynamic_assert(list1 == list2, "Error in List<T>::operator== or List<T>::operator=");
-	dynamic_assert(slist1 == slist2, "Error in SList<T>::operator== or SList<T>::operator=");
-	dynamic_assert(!(list1 == list4), "Error in List<T>::operator==");
-	dynamic_assert(!(slist1 == slist4), "Error in SList<T>::operator==");
+	// Remove and break within a node, the elements behind the break must be kept
+	list.iterate([](int& current) -> ListIterationAction
+	{
+		return 1 == current ? static_cast<ListIterationAction>(ListIterationAction::ACTION_REMOVE | ListIterationAction::ACTION_BREAK) : ListIterationAction::ACTION_CONTINUE;
+	});
+	list.remove(7);
+	const int rest[] = { -3,-1,3,5,9 };
+	dynamic_assert(list == UnrolledList<int, 4>(rest), "Error in UnrolledList<T>::iterate with ACTION_BREAK or UnrolledList<T>::remove");
 
-	// Test operator!=
-	dynamic_assert(list1 != list3, "Error in List<T>::operator!=");
-	dynamic_assert(slist1 != slist3, "Error in SList<T>::operator!=");
-	dynamic_assert(list1 != list4, "Error in List<T>::operator!=");
-	dynamic_assert(slist1 != slist4, "Error in SList<T>::operator!=");
+	// Test read-only iteration and removing all elements
+	int sum = 0;
+	const UnrolledSList<int, 4>& constSList = slist;
+	constSList.iterate([&sum](const int& current) -> ListIterationAction
+	{
+		sum += current;
+		return ListIterationAction::ACTION_CONTINUE;
+	});
+	dynamic_assert(35 == sum, "Error in UnrolledSList<T>::iterate const");
+	UnrolledSList<int, 4>::ConstIterationFunction sumFunc = [](const int& current, void* parameter) -> ListIterationAction
+	{
+		*static_cast<int*>(parameter) += current;
+		return ListIterationAction::ACTION_REMOVE;
+	};
+	sum = 0;
+	slist.iterate(sumFunc, &sum);
+	static int constCalls;
+	constCalls = 0;
+	UnrolledSList<int, 4>::ConstIterationFunction countFunc = [](const int& /*current*/, void* /*parameter*/) -> ListIterationAction
+	{
+		constCalls++;
+		return ListIterationAction::ACTION_REMOVE;
+	};
+	slist.iterate(countFunc);
+	dynamic_assert(35 == sum && 14 == constCalls && 14 == slist.size(), "Error in UnrolledSList<T>::iterate(const ConstIterationFunction& func) for a non-const list");
+	slist.iterate([](int& /*current*/) -> ListIterationAction
+	{
+		return ListIterationAction::ACTION_REMOVE;
+	});
+	dynamic_assert(slist.empty() && 0 == slist.pop_back(), "Error in UnrolledSList<T>::iterate with ACTION_REMOVE for all elements");
+
+	// Test copy and move semantics with non-trivial elements
+	UnrolledList<std::string, 4> strings;
+	for (int i = 0; i < 10; i++)
+	{
+		strings.emplace_back(static_cast<size_t>(i + 1), 'x');
+	}
+	UnrolledList<std::string, 4> copied(strings);
+	UnrolledList<std::string, 4> moved(std::move(strings));
+	dynamic_assert(strings.empty() && copied == moved && "xxxxxxxxxx" == moved.pop_back(), "Error in UnrolledList<T>::UnrolledList(const UnrolledList&) or UnrolledList<T>::UnrolledList(UnrolledList&&)");
+	moved.clear();
+	dynamic_assert(moved.empty() && copied != moved, "Error in UnrolledList<T>::clear");
+
+	// If operator== throws while remove compacts a node, the node keeps exactly the elements which weren't removed
+	struct EqualThrowingString
+	{
+		std::string m_value;
+
+		EqualThrowingString(const std::string& value = std::string()) : m_value(value) {}
+		bool operator==(const EqualThrowingString& other) const
+		{
+			if (std::string(32, 't') == other.m_value)
+			{
+				throw std::runtime_error("throwing element");
+			}
+			return m_value == other.m_value;
+		}
+	};
+	const std::string removed(32, 'a');
+	const std::string kept(32, 'k');
+	UnrolledList<EqualThrowingString, 4> throwing;
+	throwing.push_back(EqualThrowingString(removed));
+	throwing.push_back(EqualThrowingString(kept));
+	throwing.push_back(EqualThrowingString(removed));
+	throwing.push_back(EqualThrowingString(std::string(32, 't')));
+	throwing.push_back(EqualThrowingString(kept));
+	bool thrown = false;
+	try
+	{
+		throwing.remove(EqualThrowingString(removed));
+	}
+	catch (const std::runtime_error&)
+	{
+		thrown = true;
+	}
+	std::string remaining;
+	throwing.iterate([&remaining](const EqualThrowingString& current) -> ListIterationAction
+	{
+		remaining += current.m_value[0];
+		return ListIterationAction::ACTION_CONTINUE;
+	});
+	dynamic_assert(thrown && 3 == throwing.size() && "ktk" == remaining, "Error in UnrolledList<T>::remove, the node wasn't compacted after operator== threw");
+
+	// Compare and assign lists in opposite directions, the locks are acquired in the same order
+	UnrolledSList<int, 4> slist1(elements);
+	UnrolledSList<int, 4> slist2(odd);
+	dynamic_assert(slist1 != slist2 && !(slist2 == slist1), "Error in UnrolledSList<T>::operator== for lists of different sizes");
+	std::atomic<int> equalCount(0);
+	auto compareAndAssign = [&equalCount](UnrolledSList<int, 4>* first, UnrolledSList<int, 4>* second)
+	{
+		for (int i = 0; i < 1000; i++)
+		{
+			if (*first == *second)
+			{
+				equalCount++;
+			}
+			*first = *second;
+		}
+	};
+	std::thread thread1(compareAndAssign, &slist1, &slist2);
+	std::thread thread2(compareAndAssign, &slist2, &slist1);
+	thread1.join();
+	thread2.join();
+	dynamic_assert(equalCount > 0 && slist1 == slist2 && slist1.size() == slist2.size(), "Error in UnrolledSList<T>::operator= or UnrolledSList<T>::operator==");
 }
 
 /**
- * Tests the thread-safety of SList.
+ * Tests the iterators of List, the locked views of SList and parallel_for_each.
  */
-static void TestThreadSafety()
+static void TestIterators()
 {
-	int result[300];
-	std::thread threads[300];
-	SList<int> slist;
-	
-	// Fill the result array with zeros
-	for(int i = 0; i < 300; i++)
+	const int elements[] = { 1,2,3,4,5 };
+	List<int> list(elements);
+	const List<int>& constList = list;
+
+	// Test iterators with algorithms of the STL
+	dynamic_assert(15 == std::accumulate(constList.begin(), constList.end(), 0), "Error in List<T>::begin const or List<T>::end const");
+	dynamic_assert(3 == *std::find(list.begin(), list.end(), 3) && list.end() == std::find(list.begin(), list.end(), 6), "Error in List<T>::iterator with std::find");
+	std::reverse(list.begin(), list.end());
+	const int reversed[] = { 5,4,3,2,1 };
+	dynamic_assert(list == List<int>(reversed), "Error in List<T>::iterator with std::reverse");
+	dynamic_assert(1 == *--list.end() && 5 == *list.begin()++ && 4 == *++list.begin(), "Error in List<T>::iterator increment or decrement operators");
+
+	// Test erase, the returned iterator refers to the next element
+	List<int>::iterator it = list.erase(std::find(list.begin(), list.end(), 3));
+	dynamic_assert(2 == *it && 4 == list.size(), "Error in List<T>::erase");
+	dynamic_assert(list.end() == list.erase(--list.end()) && 3 == list.size(), "Error in List<T>::erase for the last element");
+
+	// Locked views keep the list locked while iterating
+	SList<int> slist(elements);
+	bool lockedWhileIterating = false;
 	{
-		result[i] = 0;
+		SList<int>::LockedView view = slist.locked_view();
+		std::thread thread([&]() -> void
+		{
+			int element;
+			lockedWhileIterating = !slist.try_lock_pop_front(element);
+		});
+		thread.join();
+		for (SList<int>::iterator current = view.begin(); current != view.end(); ++current)
+		{
+			*current *= 2;
+		}
+		view.erase(view.begin());
+		view.list().push_back(12);
+	}
+	const int doubled[] = { 4,6,8,10,12 };
+	dynamic_assert(lockedWhileIterating && slist == List<int>(doubled) && 5 == slist.size(), "Error in SList<T>::locked_view");
+	const SList<int>& constSList = slist;
+	{
+		SList<int>::ConstLockedView view = constSList.locked_view();
+		dynamic_assert(40 == std::accumulate(view.begin(), view.end(), 0) && 5 == view.size(), "Error in SList<T>::locked_view const");
 	}
 
-	auto pushBackThread = [&](int element) -> void
+	// parallel_for_each must visit every element exactly once
+	List<long> numbers;
+	for (long i = 0; i < 100000; i++)
 	{
-		slist.push_back(element);
-	};
+		numbers.push_back(i);
+	}
+	parallel_for_each(numbers, [](long& element) -> void
+	{
+		element *= 2;
+	}, 4);
+	dynamic_assert(2L * (99999L * 100000L / 2) == std::accumulate(numbers.begin(), numbers.end(), 0L), "Error in parallel_for_each for a List");
 
-	auto pushFrontThread = [&](int element) -> void
+	std::atomic<int> sum(0);
+	parallel_for_each(slist.locked_view(), [&sum](int& element) -> void
 	{
-		slist.push_front(element);
-	};
-	
-	// Fill slist with numbers from 0 to 149 using threads calling push_back
-	for(int i = 0; i < 150; i++)
+		sum += element;
+	}, 3);
+	dynamic_assert(40 == sum, "Error in parallel_for_each for a locked view of an SList");
+
+	// Exceptions thrown by the function are passed to the caller
+	bool thrown = false;
+	try
 	{
-		threads[i] = std::thread(pushBackThread, i);
+		parallel_for_each(numbers, [](long& element) -> void
+		{
+			if (1000 == element)
+			{
+				throw std::runtime_error("error");
+			}
+		}, 4);
 	}
-	
-	// Fill slist with numbers from 150 to 299 using threads calling push_front
-	for(int i = 150; i < 300; i++)
+	catch (const std::runtime_error&)
 	{
-		threads[i] = std::thread(pushFrontThread, i);
+		thrown = true;
 	}
-	
-	// Wait for all threads to finish
-	for(int i = 0; i < 300; i++)
+	dynamic_assert(thrown, "Error in parallel_for_each for a throwing function");
+}
+
+/**
+ * Tests ShardedSList.
+ */
+static void TestShardedSList()
+{
+	ShardedSList<int> empty(4);
+	int element = -1;
+	dynamic_assert(4 == empty.shard_count() && empty.empty() && 0 == empty.size(), "Error in ShardedSList<T>::ShardedSList or ShardedSList<T>::size");
+	dynamic_assert(!empty.try_pop(element) && -1 == element, "Error in ShardedSList<T>::try_pop for an empty list");
+
+	// Elements added by a single thread are removed in the same order
+	ShardedSList<int> slist(4);
+	for (int i = 0; i < 10; i++)
 	{
-		threads[i].join();
+		slist.push(i);
 	}
-	
-	// Fill the result array with values from slist
-	int index = 0;
-	auto listToArray = [&](int& element) -> ListIterationAction
+	dynamic_assert(slist.try_pop(element) && 0 == element && 9 == slist.size(), "Error in ShardedSList<T>::push or ShardedSList<T>::try_pop");
+
+	// Elements in the shard of another thread must be stolen
+	std::thread thread([&]() -> void
 	{
-		result[index++] = element;
+		for (int i = 1; i < 10; i++)
+		{
+			int stolen;
+			dynamic_assert(slist.try_pop(stolen) && i == stolen, "Error in ShardedSList<T>::try_pop stealing from another shard");
+		}
+	});
+	thread.join();
+	dynamic_assert(slist.empty(), "Error in ShardedSList<T>::empty");
+
+	// Test aggregate iteration across the shards, removing elements and breaking the iteration
+	const unsigned int threadCount = 4;
+	const int itemsPerThread = 1000;
+	std::vector<std::thread> producers;
+	for (unsigned int t = 0; t < threadCount; t++)
+	{
+		producers.push_back(std::thread([&]() -> void
+		{
+			for (int i = 1; i <= itemsPerThread; i++)
+			{
+				slist.emplace(i);
+			}
+		}));
+	}
+	for (auto& producer : producers)
+	{
+		producer.join();
+	}
+	long sum = 0;
+	const ShardedSList<int>& constSList = slist;
+	constSList.iterate([&sum](const int& current) -> ListIterationAction
+	{
+		sum += current;
 		return ListIterationAction::ACTION_CONTINUE;
-	};
-	slist.iterate(listToArray);
-	
-	// Check the values of the result array
-	for(int i = 0; i < 300; i++)
+	});
+	dynamic_assert(threadCount * itemsPerThread * (itemsPerThread + 1) / 2 == sum && threadCount * itemsPerThread == slist.size(), "Error in ShardedSList<T>::iterate const");
+	int visited = 0;
+	slist.iterate([&visited](int& current) -> ListIterationAction
 	{
-		bool foundOnce = false;
-		for(int j = 0; j < 300; j++)
+		visited++;
+		return 1 == current ? static_cast<ListIterationAction>(ListIterationAction::ACTION_REMOVE | ListIterationAction::ACTION_BREAK) : ListIterationAction::ACTION_CONTINUE;
+	});
+	dynamic_assert(1 == visited && threadCount * itemsPerThread - 1 == slist.size(), "Error in ShardedSList<T>::iterate with ACTION_BREAK");
+
+	// Consumers must remove every element exactly once
+	std::atomic<long> popped(0);
+	std::vector<std::thread> consumers;
+	for (unsigned int t = 0; t < threadCount; t++)
+	{
+		consumers.push_back(std::thread([&]() -> void
 		{
-			dynamic_assert(result[j] >= 0 && result[j] < 300, "Error testing the thread-safety, result arrray contains an unexpected value");
-			if(i == result[j])
+			int current;
+			while (slist.try_pop(current))
 			{
-				dynamic_assert(!foundOnce, "Error testing the thread-safety, result array contains a value more than once");
-				foundOnce = true;
+				popped += current;
 			}
+		}));
+	}
+	for (auto& consumer : consumers)
+	{
+		consumer.join();
+	}
+	dynamic_assert(sum - 1 == popped && slist.empty(), "Error in ShardedSList<T>::try_pop for several threads");
+	slist.push(1);
+	slist.clear();
+	dynamic_assert(slist.empty(), "Error in ShardedSList<T>::clear");
+
+	// A throwing element or function must unlock the shard and leave its count correct
+	ShardedSList<CopyThrowingElement> throwing(1);
+	throwing.push(CopyThrowingElement(1));
+	const CopyThrowingElement negative(-2);
+	bool thrown = false;
+	try
+	{
+		throwing.push(negative);
+	}
+	catch (const std::runtime_error&)
+	{
+		thrown = true;
+	}
+	dynamic_assert(thrown && 1 == throwing.size(), "Error in ShardedSList<T>::push for a throwing element");
+	thrown = false;
+	try
+	{
+		throwing.iterate([](CopyThrowingElement&) -> ListIterationAction
+		{
+			throw std::runtime_error("iteration failed");
+		});
+	}
+	catch (const std::runtime_error&)
+	{
+		thrown = true;
+	}
+	throwing.emplace(3);
+	CopyThrowingElement front;
+	dynamic_assert(thrown && 2 == throwing.size() && throwing.try_pop(front) && 1 == front.m_value && 1 == throwing.size(), "Error in ShardedSList<T>::iterate for a throwing function");
+}
+
+/**
+ * Element whose move constructor throws for negative values.
+ */
+struct ThrowingElement
+{
+	int m_value;
+
+	ThrowingElement(int value = 0) : m_value(value) {}
+	ThrowingElement(const ThrowingElement& other) = default;
+	ThrowingElement(ThrowingElement&& other) : m_value(other.m_value)
+	{
+		if (m_value < 0)
+		{
+			throw std::runtime_error("negative element");
+		}
+	}
+	ThrowingElement& operator=(const ThrowingElement& other) = default;
+};
+
+/**
+ * Tests FlatCombiningSList.
+ */
+static void TestFlatCombiningSList()
+{
+	FlatCombiningSList<int> empty(4);
+	int element = -1;
+	dynamic_assert(4 == empty.slot_count() && empty.empty() && 0 == empty.size(), "Error in FlatCombiningSList<T>::FlatCombiningSList or FlatCombiningSList<T>::size");
+	dynamic_assert(!empty.try_pop_front(element) && !empty.try_pop_back(element) && -1 == element, "Error in FlatCombiningSList<T>::try_pop_front for an empty list");
+
+	FlatCombiningSList<int> slist(4);
+	const int one = 1;
+	slist.push_back(one);
+	slist.push_back(2);
+	slist.emplace_back(3);
+	slist.push_front(0);
+	slist.emplace_front(-1);
+	dynamic_assert(5 == slist.size() && -1 == slist.pop_front() && 3 == slist.pop_back(), "Error in FlatCombiningSList<T>::push_back, push_front or pop methods");
+	int sum = 0;
+	slist.iterate([&sum](int& current) -> ListIterationAction
+	{
+		sum += current;
+		return 1 == current ? ListIterationAction::ACTION_REMOVE : ListIterationAction::ACTION_CONTINUE;
+	});
+	dynamic_assert(3 == sum && 2 == slist.size() && slist.try_pop_front(element) && 0 == element, "Error in FlatCombiningSList<T>::iterate");
+	slist.clear();
+	dynamic_assert(slist.empty(), "Error in FlatCombiningSList<T>::clear");
+
+	// An exception thrown while a combiner executes the operation is passed to the publishing thread
+	FlatCombiningSList<ThrowingElement> tlist(2);
+	bool thrown = false;
+	try
+	{
+		tlist.push_back(ThrowingElement(-1));
+	}
+	catch (const std::runtime_error&)
+	{
+		thrown = true;
+	}
+	tlist.push_back(ThrowingElement(1));
+	dynamic_assert(thrown && 1 == tlist.size() && 1 == tlist.pop_front().m_value, "Error in FlatCombiningSList<T>, an exception was not passed to the publishing thread");
+
+	// More threads than slots, so some threads share a slot and execute their operations directly. Every thread adds
+	// an element before it removes one, so no removal can fail.
+	const unsigned int threadCount = 8;
+	const int itemsPerThread = 5000;
+	std::atomic<long> popped(0);
+	std::atomic<int> failed(0);
+	std::vector<std::thread> threads;
+	for (unsigned int t = 0; t < threadCount; t++)
+	{
+		threads.push_back(std::thread([&, t]() -> void
+		{
+			for (int i = 1; i <= itemsPerThread; i++)
+			{
+				int current;
+				slist.push_back(i);
+				if (0 == t % 2 ? slist.try_pop_front(current) : slist.try_pop_back(current))
+				{
+					popped += current;
+				}
+				else
+				{
+					failed++;
+				}
+			}
+		}));
+	}
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+	dynamic_assert(0 == failed && static_cast<long>(threadCount) * itemsPerThread * (itemsPerThread + 1) / 2 == popped && slist.empty(), "Error in FlatCombiningSList<T> for several threads");
+}
+
+/**
+ * Tests SnapshotSList.
+ */
+static void TestSnapshotSList()
+{
+	const int elements[] = { 1,2,3,4,5 };
+	SnapshotSList<int> slist;
+	for (int element : elements)
+	{
+		slist.push_back(element);
+	}
+
+	// A snapshot must not see changes made after it was taken
+	{
+		SnapshotSList<int>::Snapshot snapshot = slist.snapshot();
+		slist.push_back(6);
+		slist.push_front(0);
+		slist.remove(3);
+		int front = -1;
+		dynamic_assert(slist.try_pop_front(front) && 0 == front && 1 == slist.pop_front() && 6 == slist.pop_back(), "Error in SnapshotSList<T>::pop_front or SnapshotSList<T>::pop_back while a snapshot exists");
+		const int current[] = { 2,4,5 };
+		SnapshotSList<int>::Snapshot second = slist.snapshot();
+		dynamic_assert(3 == slist.size() && second.to_list() == List<int>(current), "Error in SnapshotSList<T>::snapshot after changes");
+		dynamic_assert(5 == snapshot.size() && snapshot.to_list() == List<int>(elements), "Error in SnapshotSList<T>::Snapshot after changes of the list");
+
+		// Test breaking the iteration of a snapshot and moving a snapshot
+		SnapshotSList<int>::Snapshot moved(std::move(snapshot));
+		int visited = 0;
+		moved.iterate([&visited](const int& element) -> ListIterationAction
+		{
+			visited++;
+			return 2 == element ? ListIterationAction::ACTION_BREAK : ListIterationAction::ACTION_CONTINUE;
+		});
+		dynamic_assert(2 == visited && snapshot.empty(), "Error in SnapshotSList<T>::Snapshot::iterate with ACTION_BREAK");
+		slist.clear();
+		dynamic_assert(slist.empty() && 0 == slist.pop_back() && 3 == second.size() && 5 == moved.size(), "Error in SnapshotSList<T>::clear while snapshots exist");
+	}
+
+	// Using the list as a queue while a snapshot keeps all removed nodes linked
+	{
+		SnapshotSList<int>::Snapshot snapshot = slist.snapshot();
+		bool fifo = true;
+		for (int i = 0; i < 10000; i++)
+		{
+			slist.push_back(i);
+			slist.push_front(-i);
+			fifo = fifo && i == slist.pop_back() && -i == slist.pop_front();
+		}
+		slist.push_back(1);
+		slist.push_back(2);
+		size_t visited = 0;
+		slist.iterate([&visited](const int&) -> ListIterationAction
+		{
+			visited++;
+			return ListIterationAction::ACTION_CONTINUE;
+		});
+		dynamic_assert(fifo && 2 == visited && 1 == slist.pop_front() && 2 == slist.pop_front() && slist.empty() && snapshot.empty(), "Error in SnapshotSList<T>::pop_front or SnapshotSList<T>::pop_back while a snapshot keeps removed nodes");
+	}
+
+	// Readers iterating snapshots must see consistent versions while a writer changes the list. Every version of the
+	// list contains consecutive numbers since the writer only adds the next number and removes the first one.
+	slist.push_back(0);
+	std::atomic<bool> done(false);
+	std::atomic<bool> consistent(true);
+	std::vector<std::thread> readers;
+	for (int t = 0; t < 2; t++)
+	{
+		readers.push_back(std::thread([&]() -> void
+		{
+			while (!done)
+			{
+				SnapshotSList<int>::Snapshot snapshot = slist.snapshot();
+				int previous = -1;
+				size_t count = 0;
+				snapshot.iterate([&](const int& element) -> ListIterationAction
+				{
+					if (count > 0 && previous + 1 != element)
+					{
+						consistent = false;
+					}
+					previous = element;
+					count++;
+					return ListIterationAction::ACTION_CONTINUE;
+				});
+				if (count != snapshot.size())
+				{
+					consistent = false;
+				}
+			}
+		}));
+	}
+	for (int i = 1; i < 20000; i++)
+	{
+		slist.push_back(i);
+		if (0 == i % 3)
+		{
+			slist.pop_front();
+		}
+	}
+	done = true;
+	for (auto& reader : readers)
+	{
+		reader.join();
+	}
+	dynamic_assert(consistent && 20000 - 20000 / 3 == slist.size(), "Error in SnapshotSList<T>::Snapshot for concurrent changes");
+
+	// A throwing element or function must unlock the list, removals before the exception must be committed
+	SnapshotSList<CopyThrowingElement> throwing;
+	throwing.push_back(CopyThrowingElement(1));
+	throwing.push_back(CopyThrowingElement(2));
+	const CopyThrowingElement negative(-3);
+	bool thrown = false;
+	try
+	{
+		throwing.push_front(negative);
+	}
+	catch (const std::runtime_error&)
+	{
+		thrown = true;
+	}
+	dynamic_assert(thrown && 2 == throwing.size(), "Error in SnapshotSList<T>::push_front for a throwing element");
+	thrown = false;
+	auto beforeSnapshot = throwing.snapshot();
+	try
+	{
+		throwing.iterate([](const CopyThrowingElement& current) -> ListIterationAction
+		{
+			if (2 == current.m_value)
+			{
+				throw std::runtime_error("iteration failed");
+			}
+			return ListIterationAction::ACTION_REMOVE;
+		});
+	}
+	catch (const std::runtime_error&)
+	{
+		thrown = true;
+	}
+	auto afterSnapshot = throwing.snapshot();
+	int snapshotSum = 0;
+	afterSnapshot.iterate([&snapshotSum](const CopyThrowingElement& current) -> ListIterationAction
+	{
+		snapshotSum += current.m_value;
+		return ListIterationAction::ACTION_CONTINUE;
+	});
+	throwing.push_back(CopyThrowingElement(4));
+	dynamic_assert(thrown && 2 == throwing.size() && 2 == beforeSnapshot.size() && 2 == snapshotSum, "Error in SnapshotSList<T>::iterate for a throwing function");
+}
+
+/**
+ * Job type with an id used as key of an IndexedList.
+ */
+struct Job
+{
+	int			m_id;
+	std::string	m_name;
+
+	Job(int id = 0, const std::string& name = std::string()) : m_id(id), m_name(name) {}
+	bool operator==(const Job& other) const { return m_id == other.m_id && m_name == other.m_name; }
+};
+
+/**
+ * Key extractor returning the id of a job.
+ */
+struct JobId
+{
+	int operator()(const Job& job) const { return job.m_id; }
+};
+
+/**
+ * Tests IndexedList and IndexedSList.
+ */
+static void TestIndexedList()
+{
+	const int elements[] = { 0,1,2,3,4,5,6,7,8,9 };
+	const int remaining[] = { 1,2,4,6,8 };
+
+	// Test the index while adding and removing elements at both ends and in the middle
+	IndexedList<int> ilist;
+	for (int element : elements)
+	{
+		ilist.push_back(element);
+	}
+	ilist.push_front(3);
+	ilist.emplace_back(3);
+	dynamic_assert(12 == ilist.size() && 3 == ilist.count(3) && ilist.contains(9) && !ilist.contains(10), "Error in IndexedList<T>::contains or IndexedList<T>::count");
+	dynamic_assert(3 == ilist.remove(3) && 0 == ilist.remove(3) && !ilist.contains(3) && 9 == ilist.size(), "Error in IndexedList<T>::remove");
+	dynamic_assert(0 == ilist.pop_front() && 9 == ilist.pop_back() && !ilist.contains(0) && !ilist.contains(9), "Error in IndexedList<T>::pop_front or IndexedList<T>::pop_back");
+	int element = -1;
+	dynamic_assert(ilist.find(5, element) && 5 == element && !ilist.find(0, element) && 5 == element, "Error in IndexedList<T>::find");
+	ilist.iterate([](const int& current) -> ListIterationAction
+	{
+		return (current % 2) && 1 != current ? ListIterationAction::ACTION_REMOVE : ListIterationAction::ACTION_CONTINUE;
+	});
+	dynamic_assert(!ilist.contains(5) && !ilist.contains(7) && ilist.contains(8) && 5 == ilist.size(), "Error in IndexedList<T>::iterate with ACTION_REMOVE");
+
+	// Insertion order is kept
+	List<int> copy;
+	const IndexedList<int>& constList = ilist;
+	constList.iterate([&copy](const int& current) -> ListIterationAction
+	{
+		copy.push_back(current);
+		return ListIterationAction::ACTION_CONTINUE;
+	});
+	dynamic_assert(copy == List<int>(remaining), "Error in IndexedList<T>::iterate");
+	IndexedList<int> other;
+	for (int current : remaining)
+	{
+		other.push_back(current);
+	}
+	dynamic_assert(ilist == other && !(ilist != other), "Error in IndexedList<T>::operator==");
+	other.pop_back();
+	dynamic_assert(ilist != other, "Error in IndexedList<T>::operator!= for lists of different sizes");
+	dynamic_assert(ilist.index_memory() >= 5 * sizeof(int), "Error in IndexedList<T>::index_memory");
+	ilist.clear();
+	dynamic_assert(ilist.empty() && !ilist.contains(1) && !ilist.try_pop_back(element) && 0 == ilist.pop_front(), "Error in IndexedList<T>::clear");
+
+	// Test a key extractor and cancelling queued jobs from several threads
+	IndexedSList<Job, int, JobId> jobs;
+	for (int i = 0; i < 1000; i++)
+	{
+		jobs.emplace_back(i, "job");
+	}
+	std::vector<std::thread> threads;
+	std::atomic<size_t> cancelled(0);
+	for (int t = 0; t < 4; t++)
+	{
+		threads.emplace_back([&jobs, &cancelled, t]()
+		{
+			for (int id = t; id < 1000; id += 4)
+			{
+				if (id % 2)
+				{
+					cancelled += jobs.remove(id);
+				}
+			}
+		});
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+	Job job;
+	dynamic_assert(500 == cancelled && 500 == jobs.size() && !jobs.contains(1) && jobs.find(998, job) && 998 == job.m_id, "Error in IndexedSList<T>::remove");
+	dynamic_assert(jobs.try_pop_front(job) && 0 == job.m_id && !jobs.contains(0) && 499 == jobs.size(), "Error in IndexedSList<T>::try_pop_front");
+
+	// Compare lists in opposite directions, the locks are acquired in the same order
+	IndexedSList<int> slist1;
+	IndexedSList<int> slist2;
+	for (int current : remaining)
+	{
+		slist1.push_back(current);
+		slist2.push_back(current);
+	}
+	std::atomic<int> equalCount(0);
+	auto compare = [&equalCount](IndexedSList<int>* first, IndexedSList<int>* second)
+	{
+		for (int i = 0; i < 1000; i++)
+		{
+			if (*first == *second)
+			{
+				equalCount++;
+			}
+		}
+	};
+	std::thread thread1(compare, &slist1, &slist2);
+	std::thread thread2(compare, &slist2, &slist1);
+	thread1.join();
+	thread2.join();
+	slist2.push_back(10);
+	dynamic_assert(2000 == equalCount && slist1 != slist2, "Error in IndexedSList<T>::operator== or IndexedSList<T>::operator!=");
+}
+
+/**
+ * Message type which can be part of two intrusive lists at the same time.
+ */
+struct Message
+{
+	int							m_id;
+	IntrusiveListHook<Message>	m_queueHook;
+	IntrusiveListHook<Message>	m_allHook;
+
+	Message(int id = 0) : m_id(id) {}
+};
+
+/**
+ * Tests IntrusiveList and IntrusiveSList.
+ */
+static void TestIntrusiveList()
+{
+	Message messages[10];
+	for (int i = 0; i < 10; i++)
+	{
+		messages[i].m_id = i;
+	}
+
+	// Test adding, removing and popping elements without copying them
+	IntrusiveList<Message, &Message::m_queueHook> queue;
+	IntrusiveList<Message, &Message::m_allHook> all;
+	for (int i = 0; i < 10; i++)
+	{
+		dynamic_assert(queue.push_back(messages[i]) && all.push_front(messages[i]), "Error in IntrusiveList<T>::push_back or IntrusiveList<T>::push_front");
+	}
+	dynamic_assert(!queue.push_back(messages[3]) && 10 == queue.size() && 10 == all.size(), "Error in IntrusiveList<T>::push_back of a linked element");
+	dynamic_assert(queue.remove(messages[5]) && !queue.remove(messages[5]) && !queue.contains(messages[5]) && all.contains(messages[5]), "Error in IntrusiveList<T>::remove");
+	dynamic_assert(&messages[0] == queue.pop_front() && &messages[9] == queue.pop_back() && &messages[9] == all.pop_front(), "Error in IntrusiveList<T>::pop_front or IntrusiveList<T>::pop_back");
+	dynamic_assert(!messages[0].m_queueHook.is_linked() && messages[0].m_allHook.is_linked() && 7 == queue.size(), "Error in IntrusiveList<T>::pop_front");
+
+	// Test iterate with ACTION_REMOVE and ACTION_BREAK
+	queue.iterate([](Message& message) -> ListIterationAction
+	{
+		return message.m_id % 2 ? ListIterationAction::ACTION_REMOVE : ListIterationAction::ACTION_CONTINUE;
+	});
+	int sum = 0;
+	const IntrusiveList<Message, &Message::m_queueHook>& constQueue = queue;
+	constQueue.iterate([&sum](const Message& message) -> ListIterationAction
+	{
+		sum += message.m_id;
+		return 6 == message.m_id ? ListIterationAction::ACTION_BREAK : ListIterationAction::ACTION_CONTINUE;
+	});
+	dynamic_assert(4 == queue.size() && 12 == sum && !queue.contains(messages[7]), "Error in IntrusiveList<T>::iterate");
+	static int constCalls;
+	constCalls = 0;
+	IntrusiveList<Message, &Message::m_queueHook>::ConstIterationFunction countFunc = [](const Message& /*message*/, void* /*parameter*/) -> ListIterationAction
+	{
+		constCalls++;
+		return ListIterationAction::ACTION_REMOVE;
+	};
+	queue.iterate(countFunc);
+	dynamic_assert(4 == constCalls && 4 == queue.size(), "Error in IntrusiveList<T>::iterate(const ConstIterationFunction& func) for a non-const list");
+	queue.clear();
+	dynamic_assert(queue.empty() && nullptr == queue.pop_back() && !messages[2].m_queueHook.is_linked(), "Error in IntrusiveList<T>::clear");
+	dynamic_assert(queue.push_front(messages[2]), "Error in IntrusiveList<T>::clear, an element can't be added again");
+
+	// Several threads add messages to a shared list and remove half of them again, the messages have to outlive the list
+	std::vector<Message> pool(1000);
+	IntrusiveSList<Message, &Message::m_queueHook> shared;
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; t++)
+	{
+		threads.emplace_back([&shared, &pool, t]()
+		{
+			for (int i = t * 250; i < (t + 1) * 250; i++)
+			{
+				pool[i].m_id = i;
+				shared.push_back(pool[i]);
+			}
+			for (int i = t * 250; i < (t + 1) * 250; i += 2)
+			{
+				shared.remove(pool[i]);
+			}
+		});
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+	size_t odd = 0;
+	shared.iterate([&odd](const Message& message) -> ListIterationAction
+	{
+		odd += message.m_id % 2;
+		return ListIterationAction::ACTION_CONTINUE;
+	});
+	dynamic_assert(500 == shared.size() && 500 == odd && !shared.contains(pool[0]) && shared.contains(pool[1]), "Error in IntrusiveSList<T>::push_back or IntrusiveSList<T>::remove");
+
+	// The lambda iterate method locks the list, so elements can be removed by it while other threads add elements
+	std::thread remover([&shared]()
+	{
+		shared.iterate([](Message& message) -> ListIterationAction
+		{
+			return 1 == message.m_id % 4 ? ListIterationAction::ACTION_REMOVE : ListIterationAction::ACTION_CONTINUE;
+		});
+	});
+	for (int i = 0; i < 1000; i += 2)
+	{
+		shared.push_back(pool[i]);
+	}
+	remover.join();
+	size_t removed = 0;
+	shared.iterate([&removed](const Message& message) -> ListIterationAction
+	{
+		removed += 1 == message.m_id % 4;
+		return ListIterationAction::ACTION_CONTINUE;
+	});
+	dynamic_assert(750 == shared.size() && 0 == removed, "Error in IntrusiveSList<T>::iterate with concurrent push_back");
+}
+
+/**
+ * Tests the remove method of List and SList.
+ */
+static void TestRemoveMethod()
+{
+	const int elements[] = { 0,1,2,0,0,0,6,7,8,0 };
+
+	// Prepare lists
+	List<int> list(elements);
+	SList<int> slist(elements);
+
+	// Test remove
+	list.remove(0);
+	dynamic_assert(5 == list.size(), "Error in List<T>::remove");
+	slist.remove(0);
+	dynamic_assert(5 == slist.size(), "Error in SList<T>::remove");
+}
+
+/**
+ * Tests the search kernels of SimdSearch with an array of a vectorized type. Every position of the array is searched
+ * for arrays of every length up to the length of two AVX2 registers, so every kernel hits matches in its registers and
+ * in its remaining elements.
+ * @param	errorMessage	Error message printed if a search fails
+ */
+template<typename T>
+static void TestSimdSearch(const char* errorMessage)
+{
+	static_assert(SimdSearch::Vectorized<T>::value, "T has to be vectorized");
+	const size_t length = 64 / sizeof(T) + 3;
+	std::vector<T> elements(length);
+	bool correct = true;
+	for (size_t count = 0; count <= length; count++)
+	{
+		for (size_t position = 0; position < count; position++)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				elements[i] = static_cast<T>(i + 1);
+			}
+			elements[position] = static_cast<T>(0);
+			correct = correct && position == SimdSearch::find(elements.data(), count, static_cast<T>(0));
+			correct = correct && 1 == SimdSearch::count(elements.data(), count, static_cast<T>(0));
+			correct = correct && count == SimdSearch::find(elements.data(), count, static_cast<T>(length + 1));
+		}
+		std::fill(elements.begin(), elements.end(), static_cast<T>(-1));
+		correct = correct && count == SimdSearch::count(elements.data(), count, static_cast<T>(-1));
+	}
+	dynamic_assert(correct, errorMessage);
+}
+
+/**
+ * Tests count, contains, find and remove_if of List, SList, UnrolledList and UnrolledSList as well as the SIMD kernels
+ * of SimdSearch with every instruction set supported by the processor.
+ */
+static void TestSearchMethods()
+{
+	const int elements[] = { 0,1,2,0,0,0,6,7,8,0 };
+
+	// Test the node-based lists
+	List<int> list(elements);
+	SList<int> slist(elements);
+	dynamic_assert(5 == list.count(0) && 0 == list.count(3) && 5 == slist.count(0), "Error in List<T>::count or SList<T>::count");
+	dynamic_assert(list.contains(8) && !list.contains(3) && slist.contains(8) && !slist.contains(3), "Error in List<T>::contains or SList<T>::contains");
+	dynamic_assert(6 == *list.find(6) && 7 == *++list.find(6) && list.end() == list.find(3), "Error in List<T>::find");
+	dynamic_assert(3 == list.remove_if([](int current) { return current > 5; }) && 7 == list.size() && !list.contains(7), "Error in List<T>::remove_if");
+	dynamic_assert(5 == slist.remove_if([](int current) { return 0 == current; }) && 5 == slist.size() && !slist.contains(0), "Error in SList<T>::remove_if");
+
+	// Test the kernels of every instruction set, the scalar results are the reference
+	SimdSearch::InstructionSet supported = SimdSearch::supported_instruction_set();
+	for (int instructionSet = SimdSearch::INSTRUCTION_SET_SCALAR; instructionSet <= supported; instructionSet++)
+	{
+		SimdSearch::set_instruction_set(static_cast<SimdSearch::InstructionSet>(instructionSet));
+		dynamic_assert(instructionSet == SimdSearch::instruction_set(), "Error in SimdSearch::set_instruction_set");
+		TestSimdSearch<int>("Error in SimdSearch::find or SimdSearch::count with int");
+		TestSimdSearch<uint64_t>("Error in SimdSearch::find or SimdSearch::count with uint64_t");
+		TestSimdSearch<float>("Error in SimdSearch::find or SimdSearch::count with float");
+		TestSimdSearch<double>("Error in SimdSearch::find or SimdSearch::count with double");
+
+		// Count more equal elements than the 32 bit lanes of the registers count before they are added
+		std::vector<float> large(1100000, 7.0f);
+		dynamic_assert(large.size() == SimdSearch::count(large.data(), large.size(), 7.0f), "Error in SimdSearch::count with many equal elements");
+
+		// Floating-point elements are compared like operator== does, the bits of -0.0 and 0.0 differ
+		const double special[] = { 1.0, -0.0, std::numeric_limits<double>::quiet_NaN(), 2.0, 3.0 };
+		dynamic_assert(1 == SimdSearch::find(special, 5, 0.0) && 5 == SimdSearch::find(special, 5, special[2]), "Error in SimdSearch::find with -0.0 or NaN");
+		const float specialFloats[] = { std::numeric_limits<float>::quiet_NaN(), -0.0f, 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, -0.0f };
+		dynamic_assert(3 == SimdSearch::count(specialFloats, 9, 0.0f) && 0 == SimdSearch::count(specialFloats, 9, specialFloats[0]), "Error in SimdSearch::count with -0.0 or NaN");
+
+		// Signed integers share the kernels of unsigned integers
+		const int64_t negative[] = { 5, -1, 4294967295LL, -4294967296LL, 7 };
+		dynamic_assert(3 == SimdSearch::find(negative, 5, static_cast<int64_t>(-4294967296LL)) && 1 == SimdSearch::count(negative, 5, static_cast<int64_t>(-1)), "Error in SimdSearch::find or SimdSearch::count with int64_t");
+
+		// Search lists spread over small nodes whose elements don't start at the beginning of their storage
+		UnrolledList<int, 6> unrolled;
+		UnrolledSList<float, 6> unrolledSList;
+		std::vector<int> reference;
+		for (int i = 0; i < 100; i++)
+		{
+			unrolled.push_back(i % 10);
+			unrolled.push_front(i % 7);
+			unrolledSList.push_back(static_cast<float>(i % 10));
+			reference.push_back(i % 10);
+			reference.insert(reference.begin(), i % 7);
+		}
+		dynamic_assert(24 == unrolled.count(6) && 10 == unrolled.count(9) && 0 == unrolled.count(10), "Error in UnrolledList<T>::count");
+		dynamic_assert(unrolled.contains(9) && !unrolled.contains(-1) && 6 == *unrolled.find(6) && nullptr == unrolled.find(10), "Error in UnrolledList<T>::contains or UnrolledList<T>::find");
+		dynamic_assert(10 == unrolledSList.count(3.0f) && unrolledSList.contains(9.0f) && !unrolledSList.contains(0.5f), "Error in UnrolledSList<T>::count or UnrolledSList<T>::contains");
+
+		// Remove elements, the remaining elements must keep their order
+		unrolled.remove(6);
+		reference.erase(std::remove(reference.begin(), reference.end(), 6), reference.end());
+		size_t removed = unrolled.remove_if([](int current) { return 0 == current % 3; });
+		size_t expected = reference.size();
+		reference.erase(std::remove_if(reference.begin(), reference.end(), [](int current) { return 0 == current % 3; }), reference.end());
+		std::vector<int> remaining;
+		unrolled.iterate([&remaining](const int& current) -> ListIterationAction
+		{
+			remaining.push_back(current);
+			return ListIterationAction::ACTION_CONTINUE;
+		});
+		dynamic_assert(expected - reference.size() == removed && remaining == reference && reference.size() == unrolled.size(), "Error in UnrolledList<T>::remove or UnrolledList<T>::remove_if");
+		dynamic_assert(10 == unrolledSList.remove_if([](float current) { return 4.0f == current; }) && 90 == unrolledSList.size() && !unrolledSList.contains(4.0f), "Error in UnrolledSList<T>::remove_if");
+	}
+	SimdSearch::set_instruction_set(supported);
+}
+
+/**
+ * Tests saving lists to files and loading them, the streaming ListWriter, the checks of ListReader and
+ * PoolAllocator::reserve.
+ */
+static void TestSerialization()
+{
+	const char* path = "TestSerialization.slst";
+
+	// Reserved blocks are carved out of one slab
+	PoolAllocator<4> pool(32);
+	pool.reserve(100);
+	char* first = static_cast<char*>(pool.allocate());
+	bool contiguous = true;
+	for (int i = 1; i < 100; i++)
+	{
+		contiguous = contiguous && first + i * 32 == pool.allocate();
+	}
+	dynamic_assert(contiguous, "Error in PoolAllocator<BlocksPerSlab>::reserve");
+
+	// Trivially copyable elements are stored as one block
+	List<int> numbers;
+	for (int i = 0; i < 10000; i++)
+	{
+		numbers.push_back(i * 7 - 5000);
+	}
+	dynamic_assert(numbers.save(path), "Error in List<T>::save");
+	List<int> loadedNumbers;
+	dynamic_assert(loadedNumbers.load(path) && loadedNumbers == numbers, "Error in List<T>::load");
+	SList<int> slist;
+	slist.push_back(1);
+	dynamic_assert(slist.load(path) && 10001 == slist.size() && 1 == slist.pop_front() && slist == numbers, "Error in SList<T>::load, the elements must be added to the back");
+
+	// Files of another element type are rejected and leave the list unchanged
+	List<int64_t> wide;
+	dynamic_assert(!wide.load(path) && wide.empty() && !loadedNumbers.load("does/not/exist.slst") && 10000 == loadedNumbers.size(), "Error in List<T>::load with a file of another type or a missing file");
+
+	// Strings are stored one by one
+	SList<std::string> strings;
+	strings.push_back("");
+	strings.push_back("short");
+	strings.push_back(std::string(1000, 'x'));
+	dynamic_assert(strings.save(path), "Error in SList<std::string>::save");
+	List<std::string> loadedStrings;
+	dynamic_assert(loadedStrings.load(path) && strings == loadedStrings && loadedStrings.pop_front().empty(), "Error in List<std::string>::load");
+	dynamic_assert(!loadedNumbers.load(path), "Error in List<T>::load with a file of strings");
+
+	// Truncated files are rejected
+	std::vector<char> bytes;
+	std::FILE* file = std::fopen(path, "rb");
+	for (int byte = std::fgetc(file); EOF != byte; byte = std::fgetc(file))
+	{
+		bytes.push_back(static_cast<char>(byte));
+	}
+	std::fclose(file);
+	file = std::fopen(path, "wb");
+	std::fwrite(bytes.data(), 1, bytes.size() - 1, file);
+	std::fclose(file);
+	dynamic_assert(!loadedStrings.load(path) && 2 == loadedStrings.size(), "Error in List<std::string>::load with a truncated file");
+
+	// A count larger than the file can hold is rejected before any node is reserved, every string takes its length
+	ListFileHeader header;
+	std::memcpy(&header, bytes.data(), sizeof(header));
+	header.m_count = (bytes.size() - sizeof(header)) / sizeof(uint64_t) + 1;
+	std::memcpy(&bytes[0], &header, sizeof(header));
+	file = std::fopen(path, "wb");
+	std::fwrite(bytes.data(), 1, bytes.size(), file);
+	std::fclose(file);
+	dynamic_assert(!ListReader<std::string>(path).is_open() && !loadedStrings.load(path) && 2 == loadedStrings.size(), "Error in ListReader<std::string> with a corrupted count");
+
+	// Write several lists and a range to one file
+	{
+		ListWriter<int> writer(path);
+		const int range[] = { 1,2,3 };
+		dynamic_assert(numbers.save(writer) && slist.save(writer) && writer.write(range, range + 3) && writer.write(4), "Error in List<T>::save(ListWriter<T>&) or ListWriter<T>::write");
+		dynamic_assert(20004 == writer.count() && writer.close(), "Error in ListWriter<T>::count or ListWriter<T>::close");
+	}
+	ListReader<int> reader(path);
+	int element = 0;
+	dynamic_assert(reader.is_open() && 20004 == reader.size() && reader.read(element) && -5000 == element, "Error in ListReader<T>::read");
+	List<int> combined;
+	dynamic_assert(combined.load(path) && 20004 == combined.size() && 4 == combined.pop_back(), "Error in List<T>::load with a file written by ListWriter");
+
+	// Files of writers which were not closed are incomplete
+	{
+		ListWriter<int> writer(path);
+		writer.write(1);
+	}
+	dynamic_assert(!combined.load(path) && 20003 == combined.size(), "Error in ~ListWriter, files which were not closed must not be loadable");
+
+	// Save an SList of several chunks while another thread pushes greater numbers and pops the smallest ones. Every
+	// chunk continues behind the written elements, so the file contains increasing numbers and every number which was
+	// in the list during the whole save.
+	SList<int> queue;
+	for (int i = 0; i < 100000; i++)
+	{
+		queue.push_back(i);
+	}
+	List<int> chunks;
+	dynamic_assert(queue.save(path) && chunks.load(path) && queue == chunks, "Error in SList<T>::save with several chunks");
+	std::atomic<bool> stop(false);
+	std::atomic<int> popped(0);
+	std::atomic<int> pushed(100000);
+	std::thread writerThread([&queue, &stop, &popped, &pushed]()
+	{
+		while (!stop.load())
+		{
+			queue.push_back(pushed.load());
+			pushed++;
+			// Count the number before popping it, so the main thread never expects a popped number in the file
+			popped++;
+			queue.pop_front();
+		}
+	});
+	bool consistent = true;
+	for (int i = 0; i < 20; i++)
+	{
+		List<int> snapshot;
+		// Numbers from the first one not popped after the save to the last one pushed before it are untouched
+		const int last = pushed.load() - 1;
+		consistent = consistent && queue.save(path);
+		const int first = popped.load();
+		consistent = consistent && snapshot.load(path);
+		int previous = -1;
+		int untouched = 0;
+		for (int number : snapshot)
+		{
+			consistent = consistent && number > previous;
+			untouched += number >= first && number <= last ? 1 : 0;
+			previous = number;
+		}
+		consistent = consistent && untouched == last - first + 1;
+	}
+	stop.store(true);
+	writerThread.join();
+	dynamic_assert(consistent, "Error in SList<T>::save while other threads change the list");
+	std::remove(path);
+}
+
+/**
+ * Tests the iterate method of List and SList which takes a function pointer as parameter.
+ */
+static void TestFirstIterateMethod()
+{
+	const int elements[] = { 0,1,2,3,4,5,6,7,8,9 };
+
+	// Prepare lists
+	List<int> list(elements);
+	SList<int> slist(elements);
+
+	// Prepare parameters
+	struct IterationParams
+	{
+		int			m_index;
+		const int*	m_elements;
+	} params, sparams;
+	params.m_index		= 0;
+	params.m_elements	= elements;
+	sparams.m_index		= 0;
+	sparams.m_elements	= elements;
+
+	// Prepare iteration functions
+	auto iterateFunc = [](int& element, void* parameter) -> ListIterationAction
+	{
+		IterationParams* params = static_cast<IterationParams*>(parameter);
+		if (element == params->m_elements[params->m_index])
+		{
+			params->m_index++;
+			return ListIterationAction::ACTION_CONTINUE;
+		}
+		return ListIterationAction::ACTION_BREAK;
+	};
+
+	List<int>::IterationFunction func = iterateFunc;
+	SList<int>::IterationFunction sfunc = iterateFunc;
+
+	// Iterate the lists
+	list.iterate(func, &params);
+	slist.iterate(sfunc, &sparams);
+
+	// Check the results of the iterations
+	dynamic_assert(params.m_index == sizeof(elements) / sizeof(int), "Error in List<T>iterate(const typename List<T>::IterationFunction& func, void* parameter)");
+	dynamic_assert(sparams.m_index == sizeof(elements) / sizeof(int), "Error in SList<T>iterate(const typename List<T>::IterationFunction& func, void* parameter)");
+
+	// TODO: Test iterate methods using ListIterationAction::ACTION_BREAK and ListIterationAction::ACTION_REMOVE
+}
+
+/**
+ * Tests the iterate method of List and SList which takes a lambda function as parameter.
+ */
+static void TestSecondIterateMethod()
+{
+	const int elements[] = { 0,1,2,3,4,5,6,7,8,9 };
+
+	// Prepare lists
+	List<int> list(elements);
+	SList<int> slist(elements);
+
+	int index;
+	auto iterateFunc = [&](int& element) -> ListIterationAction
+	{
+		if (element == elements[index])
+		{
+			index++;
+			return ListIterationAction::ACTION_CONTINUE;
+		}
+		return ListIterationAction::ACTION_BREAK;
+	};
+
+	// Iterate the first list
+	index = 0;
+	list.iterate(iterateFunc);
+	dynamic_assert(index == sizeof(elements) / sizeof(int), "Error in List<T>::iterate(const Lambda& func)");
+
+	// Iterate the second list
+	index = 0;
+	slist.iterate(iterateFunc);
+	dynamic_assert(index == sizeof(elements) / sizeof(int), "Error in SList<T>::iterate(const Lambda& func)");
+
+	// TODO: Test iterate methods using ListIterationAction::ACTION_BREAK and ListIterationAction::ACTION_REMOVE
+}
+
+/**
+ * Tests the operator methods of List and SList.
+ */
+static void TestOperators()
+{
+	const int elements1[] = { 0,1,2,3,4,5,6,7,8,9 };
+	const int elements2[] = { 0,1,2,3,4,5,6,7,8,0 };
+	const int elements3[] = { 0,1,2,3,4,5,6,7,8,9,10 };
+
+	// Prepare lists
+	List<int> list1(elements1);
+	List<int> list2;
+	List<int> list3(elements2);
+	List<int> list4(elements3);
+	SList<int> slist1(elements1);
+	SList<int> slist2;
+	SList<int> slist3(elements2);
+	SList<int> slist4(elements3);
+
+	// Test operator=
+	list2 = list1;
+	slist2 = slist1;
+
+	// Test operator==
+	dynamic_assert(list1 == list2, "Error in List<T>::operator== or List<T>::operator=");
+	dynamic_assert(slist1 == slist2, "Error in SList<T>::operator== or SList<T>::operator=");
+	dynamic_assert(!(list1 == list4), "Error in List<T>::operator==");
+	dynamic_assert(!(slist1 == slist4), "Error in SList<T>::operator==");
+
+	// Test operator!=
+	dynamic_assert(list1 != list3, "Error in List<T>::operator!=");
+	dynamic_assert(slist1 != slist3, "Error in SList<T>::operator!=");
+	dynamic_assert(list1 != list4, "Error in List<T>::operator!=");
+	dynamic_assert(slist1 != slist4, "Error in SList<T>::operator!=");
+}
+
+/**
+ * Tests swap as well as comparing and assigning two instances of SList concurrently in opposite directions.
+ */
+static void TestTwoListOperations()
+{
+	const int elements1[] = { 0,1,2,3,4,5,6,7,8,9 };
+	const int elements2[] = { 9,8,7 };
+
+	// Test swap
+	List<int> list1(elements1);
+	List<int> list2(elements2);
+	list1.swap(list2);
+	dynamic_assert(list1 == List<int>(elements2) && list2 == List<int>(elements1), "Error in List<T>::swap");
+	dynamic_assert(3 == list1.size() && 10 == list2.size(), "Error in List<T>::swap");
+	list1.push_back(6);
+	list2.push_front(-1);
+	dynamic_assert(4 == list1.size() && 11 == list2.size(), "Error in List<T>::swap");
+
+	SList<int, PoolAllocator<>, RWMutex> slist1(elements1);
+	SList<int, PoolAllocator<>, RWMutex> slist2(elements2);
+	slist1.swap(slist2);
+	dynamic_assert(3 == slist1.size() && 10 == slist2.size(), "Error in SList<T>::swap");
+	dynamic_assert(slist1 == List<int>(elements2) && slist2 == List<int>(elements1), "Error in SList<T>::swap");
+	dynamic_assert(slist1 != slist2 && slist2 != slist1, "Error in SList<T>::operator!=");
+
+	// Compare and assign the lists in opposite directions, the locks are acquired in the same order
+	std::atomic<int> equalCount(0);
+	auto compareAndAssign = [&](SList<int, PoolAllocator<>, RWMutex>* first, SList<int, PoolAllocator<>, RWMutex>* second)
+	{
+		for (int i = 0; i < 1000; i++)
+		{
+			if (*first == *second)
+			{
+				equalCount++;
+			}
+			*first = *second;
+		}
+	};
+	std::thread thread1(compareAndAssign, &slist1, &slist2);
+	std::thread thread2(compareAndAssign, &slist2, &slist1);
+	thread1.join();
+	thread2.join();
+
+	dynamic_assert(equalCount > 0, "Error in SList<T>::operator= or SList<T>::operator==");
+	dynamic_assert(slist1 == slist2, "Error in SList<T>::operator= or SList<T>::operator==");
+	dynamic_assert(slist1.size() == slist2.size(), "Error in SList<T>::operator=");
+}
+
+/**
+ * Element type counting how often instances are copied.
+ */
+struct CopyCounter
+{
+	// Count of copies of all instances
+	static int s_copies;
+	// Value of the instance
+	int m_value;
+
+	CopyCounter(int value = 0) : m_value(value) {}
+	CopyCounter(const CopyCounter& other) : m_value(other.m_value) { s_copies++; }
+	CopyCounter(CopyCounter&& other) : m_value(other.m_value) {}
+	CopyCounter& operator=(const CopyCounter& other) { m_value = other.m_value; s_copies++; return *this; }
+	CopyCounter& operator=(CopyCounter&& other) { m_value = other.m_value; return *this; }
+	bool operator==(const CopyCounter& other) const { return m_value == other.m_value; }
+};
+int CopyCounter::s_copies = 0;
+
+/**
+ * Tests the move constructors, move assignment operators as well as the methods moving or constructing elements in
+ * place of List and SList.
+ */
+static void TestMoveSemantics()
+{
+	List<CopyCounter> list1;
+	SList<CopyCounter> slist1;
+
+	// Elements must not be copied when they are moved into or out of the lists
+	CopyCounter::s_copies = 0;
+	list1.push_back(CopyCounter(1));
+	list1.push_front(CopyCounter(0));
+	list1.emplace_back(2);
+	list1.emplace_front(-1);
+	slist1.push_back(CopyCounter(1));
+	slist1.push_front(CopyCounter(0));
+	slist1.emplace_back(2);
+	slist1.emplace_front(-1);
+	dynamic_assert(4 == list1.size() && 4 == slist1.size(), "Error in push_back(T&&), push_front(T&&), emplace_back or emplace_front");
+	dynamic_assert(-1 == list1.pop_front().m_value && 2 == list1.pop_back().m_value, "Error in List<T>::pop_front or List<T>::pop_back");
+	dynamic_assert(-1 == slist1.pop_front().m_value && 2 == slist1.pop_back().m_value, "Error in SList<T>::pop_front or SList<T>::pop_back");
+	dynamic_assert(0 == CopyCounter::s_copies, "Error in List<T> or SList<T>, elements were copied instead of moved");
+
+	// Moving whole lists must neither copy elements nor leave elements in the moved list
+	List<CopyCounter> list2(std::move(list1));
+	SList<CopyCounter> slist2(std::move(slist1));
+	dynamic_assert(2 == list2.size() && list1.empty(), "Error in List<T>::List(List<T>&& other)");
+	dynamic_assert(2 == slist2.size() && slist1.empty(), "Error in SList<T>::SList(SList<T>&& other)");
+	list1 = std::move(list2);
+	slist1 = std::move(slist2);
+	dynamic_assert(2 == list1.size() && list2.empty(), "Error in List<T>::operator=(List<T>&& other)");
+	dynamic_assert(2 == slist1.size() && slist2.empty(), "Error in SList<T>::operator=(SList<T>&& other)");
+	SList<CopyCounter> slist3(std::move(list1));
+	dynamic_assert(2 == slist3.size() && list1.empty() && slist3 == slist1, "Error in SList<T>::SList(List<T>&& other)");
+	dynamic_assert(0 == CopyCounter::s_copies, "Error in List<T> or SList<T>, elements were copied when moving a list");
+
+	// Moved lists must still be usable
+	list2.push_back(CopyCounter(5));
+	slist2.push_back(CopyCounter(5));
+	dynamic_assert(5 == list2.pop_front().m_value && 5 == slist2.pop_front().m_value, "Error using a moved list");
+
+	// Test move semantics with a type managing memory
+	List<std::string> list4;
+	std::string value("an element which does not fit into the small string buffer");
+	list4.push_back(std::move(value));
+	list4.emplace_back(3, 'x');
+	dynamic_assert("xxx" == list4.pop_back(), "Error in List<std::string>::emplace_back");
+	dynamic_assert("an element which does not fit into the small string buffer" == list4.pop_front(), "Error in List<std::string>::push_back(T&& element)");
+}
+
+/**
+ * Tests List and SList using different node allocators.
+ */
+static void TestAllocators()
+{
+	const int elements[] = { 0,1,2,3,4,5,6,7,8,9 };
+
+	// Use a pool with small slabs so several slabs are allocated
+	List<int, PoolAllocator<3>> list1(elements);
+	dynamic_assert(10 == list1.size(), "Error in List<T, PoolAllocator<3>>::List(const T (&arr)[])");
+
+	// Nodes removed by pop_front and pop_back are recycled by push_back and push_front
+	for (int i = 0; i < 100; i++)
+	{
+		list1.push_back(list1.pop_front());
+		list1.push_front(list1.pop_back());
+	}
+	dynamic_assert(10 == list1.size(), "Error in List<T, PoolAllocator<3>>::pop_front or List<T, PoolAllocator<3>>::pop_back");
+
+	int index = 0;
+	bool ordered = true;
+	list1.iterate([&](int& element) -> ListIterationAction
+	{
+		ordered = ordered && element == elements[index++];
+		return ListIterationAction::ACTION_CONTINUE;
+	});
+	dynamic_assert(ordered, "Error in List<T, PoolAllocator<3>>, recycled nodes contain unexpected elements");
+
+	// Clearing releases all slabs at once, the list must still be usable afterwards
+	list1.clear();
+	dynamic_assert(list1.empty(), "Error in List<T, PoolAllocator<3>>::clear");
+	list1.push_back(42);
+	dynamic_assert(1 == list1.size() && 42 == list1.pop_front(), "Error in List<T, PoolAllocator<3>>::push_back after clear");
+
+	// Slabs taken over by splice are returned to the heap once all of their blocks are free, slabs with used blocks stay
+	PoolAllocator<4> pool(sizeof(int));
+	int* kept = nullptr;
+	for (int i = 0; i < 1000; i++)
+	{
+		PoolAllocator<4> batch(sizeof(int));
+		int* blocks[4];
+		for (int j = 0; j < 4; j++)
+		{
+			blocks[j] = static_cast<int*>(batch.allocate());
+			*blocks[j] = i;
+		}
+		pool.splice(batch);
+		for (int j = 0 == i ? 1 : 0; j < 4; j++)
+		{
+			pool.deallocate(blocks[j]);
+		}
+		kept = 0 == i ? blocks[0] : kept;
+	}
+	dynamic_assert(pool.slab_count() <= 3 && 0 == *kept, "Error in PoolAllocator<BlocksPerSlab>::splice, unused slabs must be returned to the heap");
+
+	// Nodes of appended lists are removed from a long-lived list while their slabs are returned to the heap
+	List<int, PoolAllocator<4>> queue;
+	for (int i = 0; i < 1000; i++)
+	{
+		List<int, PoolAllocator<4>> batch(elements);
+		queue.append(std::move(batch));
+		for (int j = 0; j < 10; j++)
+		{
+			queue.pop_front();
+		}
+	}
+	dynamic_assert(queue.empty(), "Error in List<T, PoolAllocator<4>>::append with a long-lived list");
+
+	// Test lists allocating every node separately on the heap
+	List<int, HeapAllocator> list2(elements);
+	SList<int, HeapAllocator> slist2(list2);
+	dynamic_assert(slist2 == list2, "Error in SList<T, HeapAllocator>::SList(const List<T, HeapAllocator>& other)");
+	list2.remove(5);
+	slist2.clear();
+	dynamic_assert(9 == list2.size() && slist2.empty(), "Error in List<T, HeapAllocator>::remove or SList<T, HeapAllocator>::clear");
+
+	// Test elements which are not trivially destructible
+	List<std::string, PoolAllocator<2>> list3;
+	list3.push_back("first element which does not fit into the small string buffer");
+	list3.push_back("second element which does not fit into the small string buffer");
+	list3.push_front("third element which does not fit into the small string buffer");
+	list3.remove("second element which does not fit into the small string buffer");
+	dynamic_assert(2 == list3.size(), "Error in List<std::string>::remove");
+	list3.clear();
+	dynamic_assert(list3.empty(), "Error in List<std::string>::clear");
+}
+
+/**
+ * Tests CachingAllocator.
+ */
+static void TestCachingAllocator()
+{
+	// A freed block is allocated again from the magazine of the thread, blocks of the same size class are shared
+	CachingAllocator allocator1(24);
+	CachingAllocator allocator2(32);
+	void* block = allocator1.allocate();
+	allocator1.deallocate(block);
+	CacheStatistics before = CachingAllocator::statistics();
+	dynamic_assert(block == allocator2.allocate(), "Error in CachingAllocator::allocate, a freed block of the same size class was not reused");
+	CacheStatistics after = CachingAllocator::statistics();
+	dynamic_assert(1 == after.m_allocations - before.m_allocations && 1 == after.m_cacheHits - before.m_cacheHits, "Error in CachingAllocator::statistics");
+	allocator2.deallocate(block);
+
+	// Blocks too large for the magazines are allocated on the heap directly
+	CachingAllocator allocator3(4096);
+	before = CachingAllocator::statistics();
+	allocator3.deallocate(allocator3.allocate());
+	after = CachingAllocator::statistics();
+	dynamic_assert(1 == after.m_heapAllocations - before.m_heapAllocations && 1 == after.m_heapFrees - before.m_heapFrees, "Error in CachingAllocator, a large block was not allocated on the heap");
+
+	// A thread-local object constructed before the first allocation of its thread is destroyed after the magazines of
+	// the thread, its destructor bypasses them
+	struct ThreadLocalBlocks
+	{
+		CachingAllocator	m_allocator;
+		void*				m_block;
+
+		ThreadLocalBlocks() : m_allocator(24), m_block(nullptr) {}
+
+		~ThreadLocalBlocks()
+		{
+			m_allocator.deallocate(m_block);
+			m_allocator.deallocate(m_allocator.allocate());
+		}
+	};
+	before = CachingAllocator::statistics();
+	std::thread exiting([]() -> void
+	{
+		static thread_local ThreadLocalBlocks blocks;
+		blocks.m_block = blocks.m_allocator.allocate();
+	});
+	exiting.join();
+	after = CachingAllocator::statistics();
+	dynamic_assert(2 == after.m_allocations - before.m_allocations && 2 == after.m_deallocations - before.m_deallocations && 2 == after.m_heapFrees - before.m_heapFrees, "Error in CachingAllocator, blocks deallocated after the magazines of the thread were destroyed");
+
+	// Nodes freed by a consumer thread are passed to the next producer thread through the depot. After the first round
+	// the blocks and magazines circulate, so no round allocates anything on the heap.
+	const int itemsPerRound = 10000;
+	SList<int, CachingAllocator> slist;
+	for (int round = 0; round < 3; round++)
+	{
+		if (1 == round)
+		{
+			CachingAllocator::reset_statistics();
+		}
+		std::thread producer([&]() -> void
+		{
+			for (int i = 0; i < itemsPerRound; i++)
+			{
+				slist.push_back(i);
+			}
+		});
+		producer.join();
+		std::thread consumer([&]() -> void
+		{
+			int element;
+			while (slist.try_pop_front(element))
+			{
+			}
+		});
+		consumer.join();
+	}
+	CacheStatistics warm = CachingAllocator::statistics();
+	dynamic_assert(slist.empty() && 2 * itemsPerRound == warm.m_allocations && 2 * itemsPerRound == warm.m_deallocations, "Error in SList<T, CachingAllocator>, unexpected count of allocations");
+	dynamic_assert(0 == warm.m_heapAllocations && 0 == warm.m_magazineAllocations && warm.m_cacheHits > warm.m_allocations * 95 / 100, "Error in CachingAllocator, a warm producer/consumer round allocated on the heap");
+
+	// Several threads adding and removing elements concurrently, elements are destroyed by other threads
+	SList<std::string, CachingAllocator> slist2;
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; t++)
+	{
+		threads.push_back(std::thread([&slist2]() -> void
+		{
+			std::string element;
+			for (int i = 0; i < 5000; i++)
+			{
+				slist2.push_back("element which does not fit into the small string buffer");
+				slist2.try_pop_front(element);
+			}
+		}));
+	}
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+	dynamic_assert(slist2.empty(), "Error in SList<std::string, CachingAllocator> for several threads");
+	CachingAllocator::trim();
+}
+
+/**
+ * Tests the thread-safety of SList.
+ */
+static void TestThreadSafety()
+{
+	int result[300];
+	std::thread threads[300];
+	SList<int> slist;
+	
+	// Fill the result array with zeros
+	for(int i = 0; i < 300; i++)
+	{
+		result[i] = 0;
+	}
+
+	auto pushBackThread = [&](int element) -> void
+	{
+		slist.push_back(element);
+	};
+
+	auto pushFrontThread = [&](int element) -> void
+	{
+		slist.push_front(element);
+	};
+	
+	// Fill slist with numbers from 0 to 149 using threads calling push_back
+	for(int i = 0; i < 150; i++)
+	{
+		threads[i] = std::thread(pushBackThread, i);
+	}
+	
+	// Fill slist with numbers from 150 to 299 using threads calling push_front
+	for(int i = 150; i < 300; i++)
+	{
+		threads[i] = std::thread(pushFrontThread, i);
+	}
+	
+	// Wait for all threads to finish
+	for(int i = 0; i < 300; i++)
+	{
+		threads[i].join();
+	}
+	
+	// Fill the result array with values from slist
+	int index = 0;
+	auto listToArray = [&](int& element) -> ListIterationAction
+	{
+		result[index++] = element;
+		return ListIterationAction::ACTION_CONTINUE;
+	};
+	slist.iterate(listToArray);
+	
+	// Check the values of the result array
+	for(int i = 0; i < 300; i++)
+	{
+		bool foundOnce = false;
+		for(int j = 0; j < 300; j++)
+		{
+			dynamic_assert(result[j] >= 0 && result[j] < 300, "Error testing the thread-safety, result arrray contains an unexpected value");
+			if(i == result[j])
+			{
+				dynamic_assert(!foundOnce, "Error testing the thread-safety, result array contains a value more than once");
+				foundOnce = true;
+			}
+		}
+	}
+}
+
+/**
+ * Tests the read-only iterate methods of List and SList as well as SList using RWMutex.
+ */
+static void TestReadOnlyMethods()
+{
+	const int elements[] = { 0,1,2,3,4,5,6,7,8,9 };
+
+	// Prepare lists
+	List<int> list(elements);
+	SList<int, PoolAllocator<>, RWMutex> slist(elements);
+	const List<int>& constList = list;
+	const SList<int, PoolAllocator<>, RWMutex>& constSList = slist;
+
+	// Test the read-only iterate methods taking a function pointer, ACTION_REMOVE must be ignored
+	int sum = 0;
+	List<int>::ConstIterationFunction func = [](const int& element, void* parameter) -> ListIterationAction
+	{
+		*static_cast<int*>(parameter) += element;
+		return ListIterationAction::ACTION_REMOVE;
+	};
+	list.iterate(func, &sum);
+	dynamic_assert(45 == sum && 10 == list.size(), "Error in List<T>::iterate(const typename List<T>::ConstIterationFunction& func, void* parameter)");
+	sum = 0;
+	slist.iterate(func, &sum);
+	dynamic_assert(45 == sum && 10 == slist.size(), "Error in SList<T>::iterate(const typename List<T>::ConstIterationFunction& func, void* parameter)");
+
+	// A ConstIterationFunction passed without parameter to a non-const list isn't taken for a lambda function
+	static int constCalls;
+	constCalls = 0;
+	List<int>::ConstIterationFunction countFunc = [](const int& /*element*/, void* /*parameter*/) -> ListIterationAction
+	{
+		constCalls++;
+		return ListIterationAction::ACTION_REMOVE;
+	};
+	list.iterate(countFunc);
+	slist.iterate(countFunc);
+	dynamic_assert(20 == constCalls && 10 == list.size() && 10 == slist.size(), "Error in List<T>::iterate(const typename List<T>::ConstIterationFunction& func) for a non-const list");
+
+	// Test the read-only iterate methods taking a lambda function
+	int index = 0;
+	auto iterateFunc = [&](const int& element) -> ListIterationAction
+	{
+		if (element == elements[index])
+		{
+			index++;
+			return ListIterationAction::ACTION_CONTINUE;
+		}
+		return ListIterationAction::ACTION_BREAK;
+	};
+	constList.iterate(iterateFunc);
+	dynamic_assert(10 == index, "Error in List<T>::iterate(const Lambda& func) const");
+	index = 0;
+	constSList.iterate(iterateFunc);
+	dynamic_assert(10 == index, "Error in SList<T>::iterate(const Lambda& func) const");
+
+	// Readers compare and iterate the list while writers change it, RWMutex is not recursive so this also makes sure
+	// that SList doesn't lock itself twice
+	SList<int, PoolAllocator<>, RWMutex> other(elements);
+	std::thread threads[5];
+	for (int t = 0; t < 4; t++)
+	{
+		threads[t] = std::thread([&]() -> void
+		{
+			for (int i = 0; i < 200; i++)
+			{
+				int count = 0;
+				constSList.iterate([&](const int& /*element*/) -> ListIterationAction
+				{
+					count++;
+					return ListIterationAction::ACTION_CONTINUE;
+				});
+				dynamic_assert(count >= 10, "Error in SList<T>::iterate(const Lambda& func) const, unexpected count of elements");
+				slist == other;
+			}
+		});
+	}
+	threads[4] = std::thread([&]() -> void
+	{
+		for (int i = 0; i < 200; i++)
+		{
+			slist.push_back(i);
+			slist.pop_back();
+		}
+	});
+	for (int t = 0; t < 5; t++)
+	{
+		threads[t].join();
+	}
+	other = slist;
+	dynamic_assert(slist == other && 10 == slist.size(), "Error testing the thread-safety of SList<T, Allocator, RWMutex>");
+}
+
+/**
+ * Tests AdaptiveMutex and SList using AdaptiveMutex.
+ */
+static void TestAdaptiveMutex()
+{
+	// Test try_lock
+	AdaptiveMutex mutex;
+	dynamic_assert(mutex.try_lock(), "Error in AdaptiveMutex::try_lock for an unlocked mutex");
+	dynamic_assert(!mutex.try_lock(), "Error in AdaptiveMutex::try_lock for a locked mutex");
+	mutex.unlock();
+
+	// Increment a counter from several threads, parked threads must be woken up
+	long counter = 0;
+	std::thread threads[8];
+	for (int t = 0; t < 8; t++)
+	{
+		threads[t] = std::thread([&]() -> void
+		{
+			for (int i = 0; i < 20000; i++)
+			{
+				mutex.lock();
+				counter++;
+				mutex.unlock();
+			}
+		});
+	}
+	for (int t = 0; t < 8; t++)
+	{
+		threads[t].join();
+	}
+	dynamic_assert(8 * 20000 == counter, "Error in AdaptiveMutex::lock or AdaptiveMutex::unlock, the counter was not incremented atomically");
+
+	// AdaptiveMutex is not recursive, so this also makes sure that SList doesn't lock itself twice
+	const int elements[] = { 0,1,2,3,4,5,6,7,8,9 };
+	SList<int, PoolAllocator<>, AdaptiveMutex> slist1(elements);
+	SList<int, PoolAllocator<>, AdaptiveMutex> slist2;
+	slist2 = slist1;
+	dynamic_assert(slist1 == slist2, "Error in SList<T, Allocator, AdaptiveMutex>::operator= or SList<T, Allocator, AdaptiveMutex>::operator==");
+	for (int t = 0; t < 8; t++)
+	{
+		threads[t] = std::thread([&](int element) -> void
+		{
+			for (int i = 0; i < 1000; i++)
+			{
+				slist1.push_back(element);
+				slist1.pop_front();
+			}
+		}, t);
+	}
+	for (int t = 0; t < 8; t++)
+	{
+		threads[t].join();
+	}
+	dynamic_assert(10 == slist1.size(), "Error testing the thread-safety of SList<T, Allocator, AdaptiveMutex>");
+}
+
+/**
+ * Tests BlockingSList.
+ */
+static void TestBlockingSList()
+{
+	// Test the methods waiting for an element with a timeout
+	BlockingSList<int> list1;
+	int element = -1;
+	auto start = std::chrono::steady_clock::now();
+	dynamic_assert(!list1.wait_pop_front(element, 20) && -1 == element, "Error in BlockingSList<T>::wait_pop_front for an empty list");
+	dynamic_assert(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20), "Error in BlockingSList<T>::wait_pop_front, returned before the timeout expired");
+	list1.push_back(1);
+	list1.push_back(2);
+	dynamic_assert(list1.wait_pop_back(element, 20) && 2 == element, "Error in BlockingSList<T>::wait_pop_back");
+	dynamic_assert(list1.wait_pop_front(element) && 1 == element, "Error in BlockingSList<T>::wait_pop_front");
+
+	// Consumers wait for elements of producers, the producers are slowed down by the capacity of the list
+	BlockingSList<int> list2(4);
+	dynamic_assert(4 == list2.capacity(), "Error in BlockingSList<T>::capacity");
+	std::atomic<long> sum(0);
+	std::atomic<size_t> maxSize(0);
+	std::thread producers[3];
+	std::thread consumers[3];
+	for (int t = 0; t < 3; t++)
+	{
+		producers[t] = std::thread([&]() -> void
+		{
+			for (int i = 1; i <= 1000; i++)
+			{
+				list2.push_back(i);
+				size_t size = list2.size();
+				size_t max = maxSize.load();
+				while (size > max && !maxSize.compare_exchange_weak(max, size))
+				{
+				}
+			}
+		});
+		consumers[t] = std::thread([&]() -> void
+		{
+			int value;
+			while (list2.wait_pop_front(value))
+			{
+				sum += value;
+			}
+		});
+	}
+	for (int t = 0; t < 3; t++)
+	{
+		producers[t].join();
+	}
+	// Closing the list lets the consumers return once the list is empty
+	list2.close();
+	for (int t = 0; t < 3; t++)
+	{
+		consumers[t].join();
+	}
+	dynamic_assert(list2.closed() && list2.empty(), "Error in BlockingSList<T>::close");
+	dynamic_assert(3 * 500500 == sum.load(), "Error testing the thread-safety of BlockingSList, elements were lost or duplicated");
+	dynamic_assert(maxSize.load() <= 4, "Error in BlockingSList<T>::push_back, the capacity of the list was exceeded");
+
+	// Closing the list wakes threads waiting for space
+	BlockingSList<int> list3(1);
+	list3.push_back(1);
+	std::thread producer([&]() -> void { list3.push_back(2); });
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	dynamic_assert(1 == list3.size(), "Error in BlockingSList<T>::push_back, the capacity of the list was exceeded");
+	list3.close();
+	producer.join();
+	dynamic_assert(2 == list3.size(), "Error in BlockingSList<T>::close, a waiting producer was not woken up");
+
+	// Appending a list to a list with capacity waits for space like push_back
+	BlockingSList<int> list4(2);
+	List<int> batch;
+	for (int i = 1; i <= 100; i++)
+	{
+		batch.push_back(i);
+	}
+	long batchSum = 0;
+	size_t maxBatchSize = 0;
+	std::thread consumer([&]() -> void
+	{
+		int value;
+		for (int i = 0; i < 100 && list4.wait_pop_front(value); i++)
+		{
+			batchSum += value;
+			maxBatchSize = std::max(maxBatchSize, list4.size());
+		}
+	});
+	list4.append(std::move(batch));
+	consumer.join();
+	dynamic_assert(batch.empty() && list4.empty() && 5050 == batchSum && maxBatchSize <= 2, "Error in BlockingSList<T>::append, the capacity of the list was exceeded");
+}
+
+/**
+ * Tests lists with different lock policies.
+ */
+static void TestLockPolicies()
+{
+	// No list needs virtual methods, so no list carries a vtable pointer
+	dynamic_assert(!std::is_polymorphic<List<int>>::value && !std::is_polymorphic<SList<int>>::value, "Error in BasicList<T>, the class is polymorphic");
+
+	// Lists with different lock policies are copied, moved, compared and swapped
+	int arr[] = { 1, 2, 3 };
+	List<int> list1(arr);
+	BasicList<int, PoolAllocator<>, AdaptiveMutex> slist1(list1);
+	dynamic_assert(3 == slist1.size() && slist1 == list1 && list1 == slist1, "Error in BasicList<T>::BasicList(const BasicList<T, Allocator, OtherLock>& other)");
+	List<int> list2(std::move(slist1));
+	dynamic_assert(3 == list2.size() && slist1.empty() && 0 == slist1.size(), "Error in BasicList<T>::BasicList(BasicList<T, Allocator, OtherLock>&& other)");
+	SList<int> slist2;
+	slist2.push_back(4);
+	slist2.swap(list2);
+	dynamic_assert(3 == slist2.size() && 1 == list2.size() && 4 == list2.pop_front(), "Error in BasicList<T>::swap for lists with different lock policies");
+	slist2 = list1;
+	dynamic_assert(slist2 == list1, "Error in BasicList<T>::operator=(const BasicList<T, Allocator, OtherLock>& other)");
+
+	// The lambda iterate method of a synchronized list is locked
+	SList<int> slist3;
+	std::thread threads[4];
+	for (int t = 0; t < 4; t++)
+	{
+		threads[t] = std::thread([&slist3]() -> void
+		{
+			for (int i = 0; i < 1000; i++)
+			{
+				slist3.push_back(i);
+				slist3.iterate([](int& element) -> ListIterationAction
+				{
+					return 0 == element % 2 ? ListIterationAction::ACTION_REMOVE : ListIterationAction::ACTION_CONTINUE;
+				});
+			}
+		});
+	}
+	for (int t = 0; t < 4; t++)
+	{
+		threads[t].join();
+	}
+	dynamic_assert(2000 == slist3.size(), "Error in BasicList<T>::iterate, a synchronized list is not locked");
+
+	// Methods of BasicList wake threads waiting for BlockingSList
+	BlockingSList<int> blist1;
+	int element = 0;
+	std::thread consumer([&]() -> void { blist1.wait_pop_front(element); });
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	List<int> batch(arr);
+	blist1.append(std::move(batch));
+	consumer.join();
+	dynamic_assert(1 == element && 2 == blist1.size(), "Error in BasicList<T>::append, a waiting consumer of BlockingSList was not woken up");
+	BlockingSList<int> blist2(1);
+	blist2.push_back(1);
+	std::thread producer([&]() -> void { blist2.push_back(2); });
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	blist2.clear();
+	producer.join();
+	dynamic_assert(1 == blist2.size(), "Error in BasicList<T>::clear, a waiting producer of BlockingSList was not woken up");
+}
+
+// Checks if the list of the ProbeElement instances is locked, nullptr if no list is checked
+static std::function<bool()> g_probeLocked;
+// Count of ProbeElement instances with a value, i.e. which were neither moved from nor destructed
+static std::atomic<int> g_probeElements(0);
+// Count of ProbeElement instances destructed while their list was locked
+static std::atomic<int> g_lockedDestructions(0);
+
+/**
+ * Element which counts how often it is destructed while its list is locked.
+ */
+struct ProbeElement
+{
+	int m_value;
+
+	ProbeElement(int value = 0) : m_value(value) { if (m_value) g_probeElements++; }
+	ProbeElement(const ProbeElement& other) : m_value(other.m_value) { if (m_value) g_probeElements++; }
+	ProbeElement(ProbeElement&& other) : m_value(other.m_value) { other.m_value = 0; }
+	ProbeElement& operator=(ProbeElement other) { std::swap(m_value, other.m_value); return *this; }
+	bool operator==(const ProbeElement& other) const { return m_value == other.m_value; }
+
+	~ProbeElement()
+	{
+		if (m_value)
+		{
+			g_probeElements--;
+			if (g_probeLocked && g_probeLocked())
+			{
+				g_lockedDestructions++;
+			}
+		}
+	}
+};
+
+/**
+ * Synchronized list of ProbeElement which can check if it is locked.
+ */
+template<typename Allocator>
+class ProbeList : public BasicList<ProbeElement, Allocator, AdaptiveMutex>
+{
+public:
+	bool locked() const
+	{
+		if (!this->m_lock.try_lock())
+		{
+			return true;
+		}
+		this->m_lock.unlock();
+		return false;
+	}
+};
+
+/**
+ * Checks that clear, remove, iterate and unique of a synchronized list destroy the removed elements after unlocking it.
+ */
+template<typename Allocator>
+static void TestDeferredDestruction(const char* errorMessage)
+{
+	{
+		ProbeList<Allocator> list;
+		for (int i = 1; i <= 100; i++)
+		{
+			list.emplace_back(i);
+		}
+		g_lockedDestructions = 0;
+		g_probeLocked = [&list]() -> bool { return list.locked(); };
+
+		list.remove(ProbeElement(10));
+		list.iterate([](ProbeElement& element) -> ListIterationAction
+		{
+			return 0 == element.m_value % 2 ? ListIterationAction::ACTION_REMOVE : ListIterationAction::ACTION_CONTINUE;
+		});
+		list.push_back(ProbeElement(99));
+		dynamic_assert(1 == list.unique() && 50 == list.size() && 50 == g_probeElements, errorMessage);
+		list.clear();
+		dynamic_assert(list.empty() && 0 == g_probeElements && 0 == g_lockedDestructions, errorMessage);
+
+		// The memory of the destroyed nodes is used again
+		for (int i = 1; i <= 100; i++)
+		{
+			list.emplace_back(i);
+		}
+		list.remove(ProbeElement(1));
+		list.emplace_front(1);
+		dynamic_assert(100 == list.size() && 0 == g_lockedDestructions, errorMessage);
+		g_probeLocked = nullptr;
+	}
+	dynamic_assert(0 == g_probeElements, errorMessage);
+}
+
+/**
+ * Tests that synchronized lists destroy removed elements after unlocking.
+ */
+static void TestDeferredDestruction()
+{
+	TestDeferredDestruction<PoolAllocator<>>("Error in BasicList<T, PoolAllocator<>, AdaptiveMutex>, an element was destroyed while the list was locked");
+	TestDeferredDestruction<HeapAllocator>("Error in BasicList<T, HeapAllocator, AdaptiveMutex>, an element was destroyed while the list was locked");
+
+	// Threads removing elements race with threads clearing, swapping and appending the list, which release or pass the
+	// memory of the nodes still being destroyed
+	SList<std::string> slist1;
+	SList<std::string> slist2;
+	std::thread threads[4];
+	for (int t = 0; t < 4; t++)
+	{
+		threads[t] = std::thread([&slist1, &slist2, t]() -> void
+		{
+			std::string element(64, static_cast<char>('a' + t));
+			for (int i = 0; i < 2000; i++)
+			{
+				slist1.push_back(element);
+				slist1.push_back(element);
+				if (0 == i % 3)
+				{
+					slist1.remove(element);
+				}
+				if (0 == t && 0 == i % 100)
+				{
+					slist1.clear();
+				}
+				if (1 == t && 0 == i % 50)
+				{
+					slist1.swap(slist2);
+				}
+				if (2 == t && 0 == i % 70)
+				{
+					slist2.append(std::move(slist1));
+					slist2.unique();
+				}
+			}
+		});
+	}
+	for (int t = 0; t < 4; t++)
+	{
+		threads[t].join();
+	}
+	slist2.append(std::move(slist1));
+	size_t count = 0;
+	slist2.iterate([&count](const std::string& element) -> ListIterationAction
+	{
+		count += 64 == element.size() ? 1 : 0;
+		return ListIterationAction::ACTION_REMOVE;
+	});
+	dynamic_assert(slist1.empty() && slist2.empty() && 0 < count, "Error in SList<T>, removing elements while the list is cleared, swapped or appended failed");
+
+	// A callback which throws leaves the list unlocked, the elements removed before stay removed and are destroyed,
+	// so the destructor of the list doesn't wait for them
+	{
+		SList<std::string> throwing;
+		for (int i = 0; i < 10; i++)
+		{
+			throwing.push_back(std::string(64, static_cast<char>('a' + i)));
+		}
+		bool thrown = false;
+		try
+		{
+			throwing.iterate([](std::string& element) -> ListIterationAction
+			{
+				if ('d' == element[0])
+				{
+					throw std::runtime_error("callback");
+				}
+				return ListIterationAction::ACTION_REMOVE;
+			});
+		}
+		catch (const std::runtime_error&)
+		{
+			thrown = true;
+		}
+		bool unlocked = false;
+		std::thread([&]() -> void
+		{
+			std::string element;
+			unlocked = throwing.try_lock_pop_front(element) && 'd' == element[0];
+		}).join();
+		dynamic_assert(thrown && unlocked && 6 == throwing.size(), "Error in SList<T>::iterate, the list stayed locked after the callback threw");
+	}
+
+	// The same applies to operator== throwing in remove
+	struct EqualThrowingElement
+	{
+		int m_value;
+
+		EqualThrowingElement(int value = 0) : m_value(value) {}
+		bool operator==(const EqualThrowingElement& other) const
+		{
+			if (other.m_value < 0)
+			{
+				throw std::runtime_error("negative element");
+			}
+			return m_value == other.m_value;
+		}
+	};
+	SList<EqualThrowingElement> comparing;
+	comparing.push_back(EqualThrowingElement(1));
+	comparing.push_back(EqualThrowingElement(-2));
+	comparing.push_back(EqualThrowingElement(1));
+	bool thrown = false;
+	try
+	{
+		comparing.remove(EqualThrowingElement(1));
+	}
+	catch (const std::runtime_error&)
+	{
+		thrown = true;
+	}
+	bool unlocked = false;
+	std::thread([&]() -> void
+	{
+		EqualThrowingElement element;
+		unlocked = comparing.try_lock_pop_front(element) && -2 == element.m_value;
+	}).join();
+	dynamic_assert(thrown && unlocked && 1 == comparing.size(), "Error in SList<T>::remove, the list stayed locked after operator== threw");
+}
+
+/**
+ * Tests LockFreeSList.
+ */
+static void TestLockFreeSList()
+{
+	// Test the methods of a single thread, the list has no capacity limit
+	LockFreeSList<int> list1;
+	dynamic_assert(list1.empty() && 0 == list1.size() && 0 == list1.pop_front() && 0 == list1.pop_back(), "Error in LockFreeSList<T>::LockFreeSList or LockFreeSList<T>::empty");
+	list1.push_back(2);
+	list1.push_back(3);
+	list1.push_front(1);
+	list1.push_front(0);
+	dynamic_assert(4 == list1.size() && !list1.empty(), "Error in LockFreeSList<T>::push_back or LockFreeSList<T>::push_front");
+
+	int front = -1;
+	int back = -1;
+	dynamic_assert(list1.try_pop_front(front) && 0 == front, "Error in LockFreeSList<T>::try_pop_front");
+	dynamic_assert(list1.try_pop_back(back) && 3 == back, "Error in LockFreeSList<T>::try_pop_back");
+	dynamic_assert(2 == list1.pop_back() && 1 == list1.pop_front(), "Error in LockFreeSList<T>::pop_back or LockFreeSList<T>::pop_front");
+	dynamic_assert(!list1.try_pop_front(front) && !list1.try_pop_back(back) && list1.empty() && 0 == front, "Error in LockFreeSList<T>::try_pop_front or LockFreeSList<T>::try_pop_back for an empty list");
+
+	// Removed nodes are reused and the list grows beyond its first segments
+	for (int i = 0; i < 100000; i++)
+	{
+		list1.push_back(i);
+	}
+	bool ordered = 100000 == list1.size();
+	for (int i = 0; i < 50000; i++)
+	{
+		ordered = ordered && i == list1.pop_front() && 99999 - i == list1.pop_back();
+	}
+	dynamic_assert(ordered && list1.empty(), "Error in LockFreeSList<T>, elements are not removed in order");
+
+	// An element which throws while it is copied into the list or moved out of it doesn't block the list
+	LockFreeSList<CopyThrowingElement> throwing;
+	throwing.push_back(CopyThrowingElement(1));
+	bool thrown = false;
+	try
+	{
+		throwing.push_front(CopyThrowingElement(-2));
+	}
+	catch (const std::runtime_error&)
+	{
+		thrown = true;
+	}
+	dynamic_assert(thrown && 1 == throwing.size(), "Error in LockFreeSList<T>::push_front, the element which threw was added");
+	struct AssignThrowingElement
+	{
+		int m_value;
+
+		AssignThrowingElement(int value = 0) : m_value(value) {}
+		AssignThrowingElement& operator=(const AssignThrowingElement& other)
+		{
+			if (other.m_value < 0)
+			{
+				throw std::runtime_error("negative element");
+			}
+			m_value = other.m_value;
+			return *this;
+		}
+	};
+	LockFreeSList<AssignThrowingElement> assigning;
+	assigning.push_back(AssignThrowingElement(1));
+	assigning.push_front(AssignThrowingElement(-3));
+	AssignThrowingElement element;
+	thrown = false;
+	try
+	{
+		assigning.try_pop_front(element);
+	}
+	catch (const std::runtime_error&)
+	{
+		thrown = true;
+	}
+	dynamic_assert(thrown && assigning.try_pop_back(element) && 1 == element.m_value && assigning.empty(), "Error in LockFreeSList<T>::try_pop_front, the element which threw stayed in the list");
+
+	// Elements which are left in the list are destroyed by the destructor of the list
+	{
+		LockFreeSList<std::string> strings;
+		strings.push_back(std::string(64, 'a'));
+		strings.push_front(std::string(64, 'b'));
+	}
+
+	// Same scenario as TestThreadSafety
+	int result[300];
+	std::thread threads[300];
+	LockFreeSList<int> list2;
+	for (int i = 0; i < 150; i++)
+	{
+		threads[i] = std::thread([&](int element) -> void { list2.push_back(element); }, i);
+	}
+	for (int i = 150; i < 300; i++)
+	{
+		threads[i] = std::thread([&](int element) -> void { list2.push_front(element); }, i);
+	}
+	for (int i = 0; i < 300; i++)
+	{
+		threads[i].join();
+		result[i] = 0;
+	}
+	dynamic_assert(300 == list2.size(), "Error testing the thread-safety of LockFreeSList, unexpected size");
+	int value;
+	while (list2.try_pop_front(value))
+	{
+		dynamic_assert(value >= 0 && value < 300 && 0 == result[value]++, "Error testing the thread-safety of LockFreeSList, unexpected or duplicate value");
+	}
+
+	// Producers and consumers working on both ends of the list at the same time, so removed nodes are reused while
+	// other threads still read them
+	const int countPerThread = 20000;
+	LockFreeSList<int> list3;
+	std::atomic<long long> popped(0);
+	std::atomic<long long> sum(0);
+	std::thread producers[4];
+	std::thread consumers[4];
+	for (int i = 0; i < 4; i++)
+	{
+		producers[i] = std::thread([&, i]() -> void
+		{
+			for (int j = 1; j <= countPerThread; j++)
+			{
+				if (i % 2)
+				{
+					list3.push_front(j);
+				}
+				else
+				{
+					list3.push_back(j);
+				}
+			}
+		});
+		consumers[i] = std::thread([&, i]() -> void
+		{
+			int removed;
+			while (popped.load() < 4 * countPerThread)
+			{
+				if (i % 2 ? list3.try_pop_back(removed) : list3.try_pop_front(removed))
+				{
+					sum += removed;
+					popped++;
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+	}
+	for (int i = 0; i < 4; i++)
+	{
+		producers[i].join();
+		consumers[i].join();
+	}
+	const long long expectedSum = 4LL * countPerThread * (countPerThread + 1) / 2;
+	dynamic_assert(expectedSum == sum.load() && list3.empty() && 0 == list3.size(), "Error testing the thread-safety of LockFreeSList, elements were lost or duplicated");
+
+	// Elements added by one thread at the back are removed in the same order at the front
+	LockFreeSList<int> list4;
+	bool fifo = true;
+	std::thread producer([&list4]() -> void
+	{
+		for (int i = 0; i < 100000; i++)
+		{
+			list4.push_back(i);
+		}
+	});
+	for (int expected = 0; expected < 100000; )
+	{
+		if (list4.try_pop_front(value))
+		{
+			fifo = fifo && expected++ == value;
+		}
+	}
+	producer.join();
+	dynamic_assert(fifo && list4.empty(), "Error in LockFreeSList<T>, elements are not removed in the order they were added");
+}
+
+/**
+ * Tests LockCouplingSList.
+ */
+static void TestLockCouplingSList()
+{
+	// Test the methods without concurrent access
+	LockCouplingSList<int> list1;
+	dynamic_assert(list1.empty() && 0 == list1.size(), "Error in LockCouplingSList<T>::LockCouplingSList or LockCouplingSList<T>::empty");
+	list1.push_back(2);
+	list1.push_back(3);
+	list1.push_front(1);
+	list1.push_front(0);
+	list1.push_back(0);
+	dynamic_assert(5 == list1.size(), "Error in LockCouplingSList<T>::push_back or LockCouplingSList<T>::push_front");
+	list1.remove(0);
+	dynamic_assert(3 == list1.size(), "Error in LockCouplingSList<T>::remove");
+	dynamic_assert(1 == list1.pop_front() && 3 == list1.pop_back() && 2 == list1.pop_back(), "Error in LockCouplingSList<T>::pop_front or LockCouplingSList<T>::pop_back");
+	dynamic_assert(list1.empty() && 0 == list1.pop_front() && 0 == list1.pop_back(), "Error in LockCouplingSList<T>::pop_front or LockCouplingSList<T>::pop_back for an empty list");
+
+	for (int i = 0; i < 10; i++)
+	{
+		list1.push_back(i);
+	}
+	int index = 0;
+	bool ordered = true;
+	list1.iterate([&](int& element) -> ListIterationAction
+	{
+		ordered = ordered && element == index++;
+		return element % 2 ? ListIterationAction::ACTION_REMOVE : ListIterationAction::ACTION_CONTINUE;
+	});
+	dynamic_assert(ordered && 10 == index && 5 == list1.size(), "Error in LockCouplingSList<T>::iterate using ListIterationAction::ACTION_REMOVE");
+	index = 0;
+	list1.iterate([&](int& /*element*/) -> ListIterationAction
+	{
+		index++;
+		return static_cast<ListIterationAction>(ListIterationAction::ACTION_REMOVE | ListIterationAction::ACTION_BREAK);
+	});
+	dynamic_assert(1 == index && 4 == list1.size(), "Error in LockCouplingSList<T>::iterate using ListIterationAction::ACTION_BREAK");
+	list1.clear();
+	dynamic_assert(list1.empty(), "Error in LockCouplingSList<T>::clear");
+
+	// Producers and consumers work on both ends of the list while other threads iterate and remove elements
+	LockCouplingSList<int> list2;
+	for (int i = 0; i < 1000; i++)
+	{
+		list2.push_back(-1);
+	}
+	// Pushed elements are positive, so a popped 0 indicates an empty list
+	std::atomic<int> removed(0);
+	std::atomic<int> popped(0);
+	std::thread threads[6];
+	auto countPopped = [&](int element) -> void
+	{
+		if (-1 == element)
+		{
+			removed++;
+		}
+		else if (0 != element)
+		{
+			popped++;
+		}
+	};
+	threads[0] = std::thread([&]() -> void { for (int i = 1; i <= 2000; i++) list2.push_back(i); });
+	threads[1] = std::thread([&]() -> void { for (int i = 1; i <= 2000; i++) list2.push_front(i); });
+	threads[2] = std::thread([&]() -> void { for (int i = 0; i < 500; i++) countPopped(list2.pop_front()); });
+	threads[3] = std::thread([&]() -> void { for (int i = 0; i < 500; i++) countPopped(list2.pop_back()); });
+	for (int t = 4; t < 6; t++)
+	{
+		threads[t] = std::thread([&]() -> void
+		{
+			list2.iterate([&](int& element) -> ListIterationAction
+			{
+				if (-1 == element)
+				{
+					removed++;
+					return ListIterationAction::ACTION_REMOVE;
+				}
+				return ListIterationAction::ACTION_CONTINUE;
+			});
+		});
+	}
+	for (int t = 0; t < 6; t++)
+	{
+		threads[t].join();
+	}
+
+	// Every element -1 is either still in the list or was removed exactly once
+	size_t count = 0;
+	size_t positive = 0;
+	list2.iterate([&](int& element) -> ListIterationAction
+	{
+		count++;
+		if (-1 == element)
+		{
+			removed++;
 		}
+		else
+		{
+			positive++;
+		}
+		return ListIterationAction::ACTION_CONTINUE;
+	});
+	dynamic_assert(count == list2.size(), "Error testing the thread-safety of LockCouplingSList, unexpected size");
+	dynamic_assert(1000 == removed.load(), "Error testing the thread-safety of LockCouplingSList, elements were lost or duplicated");
+	dynamic_assert(4000 - popped.load() == static_cast<int>(positive), "Error testing the thread-safety of LockCouplingSList, elements were lost or duplicated");
+}
+
+#ifdef SLIST_INSTRUMENTATION
+/**
+ * Tests the instrumentation of SList.
+ */
+static void TestInstrumentation()
+{
+	// Test the counts of operations and the peak size
+	SList<int> list1;
+	for (int i = 0; i < 10; i++)
+	{
+		list1.push_back(i);
+	}
+	list1.pop_front();
+	list1.remove(5);
+	list1.iterate([](int& element) -> ListIterationAction { return ListIterationAction::ACTION_CONTINUE; });
+	{
+		SList<int>::LockedView view = list1.locked_view();
+	}
+	list1.clear();
+	ListStatistics statistics = list1.statistics();
+	dynamic_assert(10 == statistics.m_operations[OPERATION_PUSH], "Error in SList<T>::statistics, wrong count of push operations");
+	dynamic_assert(1 == statistics.m_operations[OPERATION_POP], "Error in SList<T>::statistics, wrong count of pop operations");
+	dynamic_assert(1 == statistics.m_operations[OPERATION_REMOVE], "Error in SList<T>::statistics, wrong count of remove operations");
+	dynamic_assert(1 == statistics.m_operations[OPERATION_ITERATE], "Error in SList<T>::statistics, wrong count of iterations");
+	dynamic_assert(1 == statistics.m_operations[OPERATION_VIEW], "Error in SList<T>::statistics, wrong count of locked views");
+	dynamic_assert(1 == statistics.m_operations[OPERATION_CLEAR], "Error in SList<T>::statistics, wrong count of clear operations");
+	dynamic_assert(15 == statistics.m_lockAcquisitions, "Error in SList<T>::statistics, wrong count of lock acquisitions");
+	dynamic_assert(0 == statistics.m_contendedAcquisitions, "Error in SList<T>::statistics, uncontended acquisitions counted as contended");
+	dynamic_assert(10 == statistics.m_peakSize, "Error in SList<T>::statistics, wrong peak size");
+	uint64_t holds = 0;
+	for (size_t i = 0; i < ListStatistics::HISTOGRAM_BUCKETS; i++)
+	{
+		holds += statistics.m_holdHistogram[i];
+	}
+	dynamic_assert(15 == holds, "Error in SList<T>::statistics, wrong count of holds in the histogram");
+	dynamic_assert(statistics.m_maxHoldTime <= statistics.m_holdTime, "Error in SList<T>::statistics, longest hold exceeds the cumulative hold time");
+
+	// Test that reset_statistics sets all counters to zero
+	list1.reset_statistics();
+	statistics = list1.statistics();
+	dynamic_assert(0 == statistics.m_lockAcquisitions && 0 == statistics.m_operations[OPERATION_PUSH] && 0 == statistics.m_peakSize && 0 == statistics.m_holdTime, "Error in SList<T>::reset_statistics");
+
+	// A List isn't synchronized, so it isn't instrumented either
+	List<int> unsynchronized;
+	for (int i = 0; i < 10; i++)
+	{
+		unsynchronized.push_back(i);
+	}
+	unsynchronized.pop_front();
+	statistics = unsynchronized.statistics();
+	dynamic_assert(0 == statistics.m_lockAcquisitions && 0 == statistics.m_operations[OPERATION_PUSH] && 0 == statistics.m_peakSize, "Error in List<T>, the unsynchronized list is instrumented");
+
+	// Test that try_lock_pop counts a failed attempt as contended
+	SList<int> list2;
+	list2.push_back(1);
+	std::atomic<bool> locked(false);
+	std::atomic<bool> done(false);
+	std::thread holder([&]() -> void
+	{
+		SList<int>::LockedView view = list2.locked_view();
+		locked = true;
+		while (!done)
+		{
+			std::this_thread::yield();
+		}
+	});
+	while (!locked)
+	{
+		std::this_thread::yield();
+	}
+	int element = 0;
+	dynamic_assert(!list2.try_lock_pop_front(element), "Error in SList<T>::try_lock_pop_front while the list is locked");
+	done = true;
+	holder.join();
+	statistics = list2.statistics();
+	dynamic_assert(1 <= statistics.m_contendedAcquisitions, "Error in SList<T>::statistics, failed try_lock_pop_front not counted as contended");
+
+	// Test that concurrent pushes are all counted
+	SList<int> list3;
+	std::thread threads[4];
+	for (int t = 0; t < 4; t++)
+	{
+		threads[t] = std::thread([&list3]() -> void
+		{
+			for (int i = 0; i < 1000; i++)
+			{
+				list3.push_back(i);
+			}
+		});
+	}
+	for (int t = 0; t < 4; t++)
+	{
+		threads[t].join();
 	}
+	statistics = list3.statistics();
+	dynamic_assert(4000 == statistics.m_operations[OPERATION_PUSH] && 4000 == statistics.m_lockAcquisitions, "Error in SList<T>::statistics, concurrent operations were lost");
+	dynamic_assert(4000 == statistics.m_peakSize, "Error in SList<T>::statistics, wrong peak size after concurrent pushes");
+	dynamic_assert(statistics.m_maxWaitTime <= statistics.m_waitTime, "Error in SList<T>::statistics, longest wait exceeds the cumulative wait time");
 }
+#endif
 
 /**
  * Main function of the program. Runs all tests.
@@ -378,11 +2952,37 @@ int main(int argc, char* argv[])
 {
 	TestConstructors();
 	TestPushAndPopMethods();
+	TestTryPopMethods();
+	TestBulkOperations();
+	TestSortMethods();
+	TestUnrolledList();
+	TestIterators();
+	TestIndexedList();
+	TestIntrusiveList();
 	TestRemoveMethod();
+	TestSearchMethods();
+	TestSerialization();
 	TestFirstIterateMethod();
 	TestSecondIterateMethod();
 	TestOperators();
+	TestTwoListOperations();
+	TestMoveSemantics();
+	TestAllocators();
+	TestCachingAllocator();
+	TestReadOnlyMethods();
+	TestAdaptiveMutex();
+	TestBlockingSList();
+	TestLockPolicies();
+	TestDeferredDestruction();
 	TestThreadSafety();
+	TestLockFreeSList();
+	TestLockCouplingSList();
+	TestShardedSList();
+	TestFlatCombiningSList();
+	TestSnapshotSList();
+#ifdef SLIST_INSTRUMENTATION
+	TestInstrumentation();
+#endif
 	
 	std::cout << "All tests done!" << std::endl;
 	return 0;